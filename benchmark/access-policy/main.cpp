@@ -0,0 +1,93 @@
+#include <benchmarking.hpp>
+#include <bubble-sort.hpp>
+#include <dynamic-array.hpp>
+#include <heap.hpp>
+#include <insert-sort.hpp>
+#include <random>
+#include <string>
+
+DynamicArray<int> make_values(int count)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> value(0, 1'000'000);
+
+    DynamicArray<int> values(count);
+    for (int i = 0; i < count; i++)
+    {
+        values.append(value(rng));
+    }
+    return values;
+}
+
+// Push every value into a MinHeap and pop half of them back, the heap indexes its DynamicArray in both loops
+int heap_push_pop(const DynamicArray<int>& values)
+{
+    MinHeap<int> heap;
+    for (int value : values)
+    {
+        heap.insert(value);
+    }
+    for (int i = 0; i < values.getSize() / 2; i++)
+    {
+        heap.pop();
+    }
+    return heap.toVector().front();  // The smallest remaining value
+}
+
+template <typename Sort>
+int sort_copy(DynamicArray<int> values, Sort sort)
+{
+    sort(values.begin(), values.end());
+    return values[0] + values[values.getSize() - 1];
+}
+
+int bubble_sort(const DynamicArray<int>& values)
+{
+    return sort_copy(values, [](int* begin, int* end) { bubbleSort(begin, end); });
+}
+
+int insert_sort(const DynamicArray<int>& values)
+{
+    return sort_copy(values, [](int* begin, int* end) { insertSort(begin, end); });
+}
+
+// Insertion sort written against operator[], as index based algorithms over the containers are
+template <typename Access>
+int indexed_insert_sort(const DynamicArray<int>& source)
+{
+    DynamicArray<int, std::allocator<int>, Access> values(source.getSize());
+    values.appendRange(source.begin(), source.end());
+    for (int i = 1; i < values.getSize(); i++)
+    {
+        const int key = values[i];
+        int j = i - 1;
+        while (j >= 0 && values[j] > key)
+        {
+            values[j + 1] = values[j];
+            j--;
+        }
+        values[j + 1] = key;
+    }
+    return values[0] + values[values.getSize() - 1];
+}
+
+int main(int argc, char* argv[])
+{
+    const int heapCount = argc > 1 ? std::stoi(argv[1]) : 2'000'000;
+    const int sortCount = argc > 2 ? std::stoi(argv[2]) : 20'000;
+    const DynamicArray<int> heapValues = make_values(heapCount);
+    const DynamicArray<int> sortValues = make_values(sortCount);
+
+    std::cout << "Default access policy: " << (DefaultAccess::isChecked ? "checked" : "unchecked") << "\n";
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        benchmark_function("MinHeap push/pop " + std::to_string(heapCount), heap_push_pop, heapValues);
+        benchmark_function("bubbleSort " + std::to_string(sortCount), bubble_sort, sortValues);
+        benchmark_function("insertSort " + std::to_string(sortCount), insert_sort, sortValues);
+        benchmark_function("operator[] insertion sort, checked", indexed_insert_sort<CheckedAccess>, sortValues);
+        benchmark_function("operator[] insertion sort, unchecked", indexed_insert_sort<UncheckedAccess>, sortValues);
+    }
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <benchmarking.hpp>
+#include <dynamic-array.hpp>
+#include <heap.hpp>
+#include <list.hpp>
+#include <memory_resource>
+#include <queue.hpp>
+#include <stack.hpp>
+#include <string>
+#include <unordered-map.hpp>
+
+// Every workload builds a container, reads it back and tears it down. With a monotonic arena the teardown
+// is a no-op for the container and the whole arena is released at once when it goes out of scope.
+
+template <typename Allocator, typename... Resource>
+int build_dynamic_array(int n, Resource*... resource)
+{
+    const Allocator allocator{resource...};
+    DynamicArray<int, Allocator> array(allocator);
+    for (int i = 0; i < n; i++)
+    {
+        array.append(i);
+    }
+    return array[n / 2];
+}
+
+template <typename Allocator, typename... Resource>
+int build_list(int n, Resource*... resource)
+{
+    const Allocator allocator{resource...};
+    List<int, Allocator> list(allocator);
+    for (int i = 0; i < n; i++)
+    {
+        list.append(i);
+    }
+    return list.getSize();
+}
+
+template <typename Allocator, typename... Resource>
+int build_queue(int n, Resource*... resource)
+{
+    const Allocator allocator{resource...};
+    Queue<int, List<int, Allocator>> queue(allocator);
+    for (int i = 0; i < n; i++)
+    {
+        queue.push(i);
+    }
+    return queue.back();
+}
+
+template <typename Allocator, typename... Resource>
+int build_stack(int n, Resource*... resource)
+{
+    const Allocator allocator{resource...};
+    Stack<int, DynamicArray<int, Allocator>> stack(allocator);
+    for (int i = 0; i < n; i++)
+    {
+        stack.push(i);
+    }
+    return stack.top();
+}
+
+template <typename Allocator, typename... Resource>
+int build_heap(int n, Resource*... resource)
+{
+    const Allocator allocator{resource...};
+    MinHeap<int, Allocator> heap(allocator);
+    for (int i = n; i > 0; i--)
+    {
+        heap.insert(i);
+    }
+    return heap.toVector().front();
+}
+
+template <typename Allocator, typename... Resource>
+int build_unordered_map(int n, Resource*... resource)
+{
+    // Many small maps, each one filled and destroyed, as in a request scoped computation
+    const Allocator allocator{resource...};
+    int found = 0;
+    for (int round = 0; round < n / 256; round++)
+    {
+        UnorderedMap<int, 16, Allocator> map(allocator);
+        for (int key = 0; key < 256; key++)
+        {
+            map.insert(key, key);
+        }
+        found += map.find(round % 256).value_or(0);
+    }
+    return found;
+}
+
+// Runs a workload on a fresh monotonic arena, the arena is released as a whole at the end
+template <int (*Workload)(int, std::pmr::memory_resource*)>
+int with_arena(int n)
+{
+    std::pmr::monotonic_buffer_resource arena;
+    return Workload(n, &arena);
+}
+
+int main(int argc, char* argv[])
+{
+    using Heap = std::allocator<int>;
+    using Arena = std::pmr::polymorphic_allocator<int>;
+    using PairHeap = std::allocator<std::pair<uint8_t, int>>;
+    using PairArena = std::pmr::polymorphic_allocator<std::pair<uint8_t, int>>;
+
+    const int n = argc > 1 ? std::stoi(argv[1]) : 1'000'000;
+
+    // The first round also pays for page faults and for warming up the allocator free lists,
+    // compare the numbers of the second round.
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << ": build and teardown of " << n << " elements\n";
+
+        benchmark_function("DynamicArray heap", build_dynamic_array<Heap>, n);
+        benchmark_function("DynamicArray arena", with_arena<build_dynamic_array<Arena, std::pmr::memory_resource>>, n);
+
+        benchmark_function("List heap", build_list<Heap>, n);
+        benchmark_function("List arena", with_arena<build_list<Arena, std::pmr::memory_resource>>, n);
+
+        benchmark_function("Queue heap", build_queue<Heap>, n);
+        benchmark_function("Queue arena", with_arena<build_queue<Arena, std::pmr::memory_resource>>, n);
+
+        benchmark_function("Stack heap", build_stack<Heap>, n);
+        benchmark_function("Stack arena", with_arena<build_stack<Arena, std::pmr::memory_resource>>, n);
+
+        benchmark_function("MinHeap heap", build_heap<Heap>, n);
+        benchmark_function("MinHeap arena", with_arena<build_heap<Arena, std::pmr::memory_resource>>, n);
+
+        benchmark_function("UnorderedMap heap", build_unordered_map<PairHeap>, n);
+        benchmark_function(
+            "UnorderedMap arena", with_arena<build_unordered_map<PairArena, std::pmr::memory_resource>>, n);
+    }
+
+    return 0;
+}
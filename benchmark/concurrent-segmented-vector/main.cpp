@@ -0,0 +1,76 @@
+#include <benchmarking.hpp>
+#include <concurrent-segmented-vector.hpp>
+#include <dynamic-array.hpp>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Run work(threadIndex) on threadCount threads and wait for all of them
+template <typename Work>
+void run_threads(int threadCount, Work work)
+{
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back(work, t);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Today's approach: every append takes a mutex around a shared DynamicArray
+int mutex_dynamic_array(int threadCount, int count)
+{
+    DynamicArray<int> values;
+    std::mutex mutex;
+    run_threads(
+        threadCount,
+        [&](int t)
+        {
+            for (int i = t; i < count; i += threadCount)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                values.append(i);
+            }
+        });
+    return values.getSize() + values[values.getSize() / 2];
+}
+
+// Lock-free appends to the segmented vector
+int concurrent_segmented_vector(int threadCount, int count)
+{
+    ConcurrentSegmentedVector<int> values;
+    run_threads(
+        threadCount,
+        [&](int t)
+        {
+            for (int i = t; i < count; i += threadCount)
+            {
+                values.append(i);
+            }
+        });
+    return values.getSize() + values[values.getSize() / 2];
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 20'000'000;
+    std::cout << "Appending " << count << " ints in total, hardware threads: " << std::thread::hardware_concurrency()
+              << "\n";
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        for (int threadCount : {1, 2, 4, 8, 16, 32})
+        {
+            const std::string threads = std::to_string(threadCount) + " threads";
+            benchmark_function("mutex + DynamicArray, " + threads, mutex_dynamic_array, threadCount, count);
+            benchmark_function("ConcurrentSegmentedVector, " + threads, concurrent_segmented_vector, threadCount, count);
+        }
+    }
+
+    return 0;
+}
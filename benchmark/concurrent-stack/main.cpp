@@ -0,0 +1,125 @@
+#include <atomic>
+#include <benchmarking.hpp>
+#include <concurrent-stack.hpp>
+#include <iterator>
+#include <mutex>
+#include <stack.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr int BATCH = 16;
+
+// Run work(threadIndex) on threadCount threads and wait for all of them
+template <typename Work>
+void run_threads(int threadCount, Work work)
+{
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back(work, t);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Today's approach: a Stack under a mutex, used as a shared pool: take an item if there is one, give one back
+int mutex_stack(int threadCount, int operations)
+{
+    Stack<int> stack;
+    std::mutex mutex;
+    std::atomic<long long> sum = 0;
+    run_threads(threadCount,
+                [&](int t)
+                {
+                    long long local = 0;
+                    for (int i = t; i < operations; i += threadCount)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!stack.isEmpty())
+                        {
+                            local += stack.top();
+                            stack.pop();
+                        }
+                        stack.push(i);
+                    }
+                    sum += local;
+                });
+    return static_cast<int>(sum.load() % 1'000'000'007);
+}
+
+int concurrent_stack(int threadCount, int operations)
+{
+    ConcurrentStack<int> stack;
+    std::atomic<long long> sum = 0;
+    run_threads(threadCount,
+                [&](int t)
+                {
+                    long long local = 0;
+                    int value = 0;
+                    for (int i = t; i < operations; i += threadCount)
+                    {
+                        if (stack.pop(value))
+                        {
+                            local += value;
+                        }
+                        stack.push(i);
+                    }
+                    sum += local;
+                });
+    return static_cast<int>(sum.load() % 1'000'000'007);
+}
+
+// Work is handed over in batches: BATCH pushes with one pushAll, then one popAll takes whatever is there
+int concurrent_stack_batches(int threadCount, int operations)
+{
+    ConcurrentStack<int> stack;
+    std::atomic<long long> sum = 0;
+    run_threads(threadCount,
+                [&](int t)
+                {
+                    long long local = 0;
+                    int batch[BATCH];
+                    std::vector<int> drained;
+                    for (int i = t * BATCH; i < operations; i += threadCount * BATCH)
+                    {
+                        for (int k = 0; k < BATCH; k++)
+                        {
+                            batch[k] = i + k;
+                        }
+                        stack.pushAll(batch, batch + BATCH);
+                        drained.clear();
+                        stack.popAll(std::back_inserter(drained));
+                        for (int value : drained)
+                        {
+                            local += value;
+                        }
+                    }
+                    sum += local;
+                });
+    return static_cast<int>(sum.load() % 1'000'000'007);
+}
+
+int main(int argc, char* argv[])
+{
+    const int operations = argc > 1 ? std::stoi(argv[1]) : 10'000'000;
+    std::cout << operations << " operations in total, hardware threads: " << std::thread::hardware_concurrency()
+              << "\n";
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        for (int threadCount : {1, 2, 4, 8, 16, 32, 64})
+        {
+            const std::string threads = ", " + std::to_string(threadCount) + " threads";
+            benchmark_function("mutex + Stack pop/push" + threads, mutex_stack, threadCount, operations);
+            benchmark_function("ConcurrentStack pop/push" + threads, concurrent_stack, threadCount, operations);
+            benchmark_function("ConcurrentStack pushAll/popAll of " + std::to_string(BATCH) + threads,
+                               concurrent_stack_batches, threadCount, operations);
+        }
+    }
+
+    return 0;
+}
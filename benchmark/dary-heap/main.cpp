@@ -0,0 +1,175 @@
+#include <benchmarking.hpp>
+#include <dary-heap.hpp>
+#include <functional>
+#include <heap.hpp>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+using MinPriorityQueue = std::priority_queue<int, std::vector<int>, std::greater<int>>;
+
+// Build a heap of all the values: MinHeap only inserts one by one, the others heapify the range
+int min_heap_build(const std::vector<int>& values)
+{
+    MinHeap<int> heap;
+    for (int value : values)
+    {
+        heap.insert(value);
+    }
+    return heap.toVector().front();
+}
+
+int priority_queue_build(const std::vector<int>& values)
+{
+    MinPriorityQueue queue(std::greater<int>(), std::vector<int>(values.begin(), values.end()));
+    return queue.top();
+}
+
+template <int D>
+int dary_heap_build(const std::vector<int>& values)
+{
+    DaryHeap<int, D> heap(values.begin(), values.end());
+    return heap.top();
+}
+
+// Push every value, then pop them all (a heap sort)
+int min_heap_fill_drain(const std::vector<int>& values)
+{
+    MinHeap<int> heap;
+    for (int value : values)
+    {
+        heap.insert(value);
+    }
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        heap.pop();
+    }
+    return static_cast<int>(heap.toVector().size());
+}
+
+int priority_queue_fill_drain(const std::vector<int>& values)
+{
+    MinPriorityQueue queue;
+    for (int value : values)
+    {
+        queue.push(value);
+    }
+    long long check = 0;
+    while (!queue.empty())
+    {
+        check += queue.top();
+        queue.pop();
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+template <int D>
+int dary_heap_fill_drain(const std::vector<int>& values)
+{
+    DaryHeap<int, D> heap;
+    for (int value : values)
+    {
+        heap.push(value);
+    }
+    long long check = 0;
+    while (!heap.isEmpty())
+    {
+        check += heap.top();
+        heap.pop();
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+// Steady state: on a heap of all the values, pop the top and push a larger value, as an event queue does
+int min_heap_mix(const std::vector<int>& values)
+{
+    MinHeap<int> heap;
+    for (int value : values)
+    {
+        heap.insert(value);
+    }
+    for (int value : values)
+    {
+        heap.pop();
+        heap.insert(value + 1'000'000);
+    }
+    return heap.toVector().front();
+}
+
+int priority_queue_mix(const std::vector<int>& values)
+{
+    MinPriorityQueue queue(std::greater<int>(), std::vector<int>(values.begin(), values.end()));
+    for (int value : values)
+    {
+        queue.pop();
+        queue.push(value + 1'000'000);
+    }
+    return queue.top();
+}
+
+template <int D>
+int dary_heap_mix(const std::vector<int>& values)
+{
+    DaryHeap<int, D> heap(values.begin(), values.end());
+    for (int value : values)
+    {
+        heap.pop();
+        heap.push(value + 1'000'000);
+    }
+    return heap.top();
+}
+
+// The same mix with the pop and the push fused into one sift
+template <int D>
+int dary_heap_replace_top(const std::vector<int>& values)
+{
+    DaryHeap<int, D> heap(values.begin(), values.end());
+    for (int value : values)
+    {
+        heap.replaceTop(value + 1'000'000);
+    }
+    return heap.top();
+}
+
+int main(int argc, char* argv[])
+{
+    // 1e8 elements take several GB and minutes per round, pass it explicitly
+    const int maxCount = argc > 1 ? std::stoi(argv[1]) : 10'000'000;
+
+    std::mt19937 rng(42);
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        for (int count = 100'000; count <= maxCount; count *= 10)
+        {
+            std::vector<int> values(count);
+            for (int& value : values)
+            {
+                value = static_cast<int>(rng() % 1'000'000);
+            }
+            const std::string suffix = ", " + std::to_string(count) + " ints";
+
+            benchmark_function("MinHeap build by inserts" + suffix, min_heap_build, values);
+            benchmark_function("std::priority_queue build" + suffix, priority_queue_build, values);
+            benchmark_function("DaryHeap<2> build" + suffix, dary_heap_build<2>, values);
+            benchmark_function("DaryHeap<4> build" + suffix, dary_heap_build<4>, values);
+            benchmark_function("DaryHeap<8> build" + suffix, dary_heap_build<8>, values);
+
+            benchmark_function("MinHeap fill + drain" + suffix, min_heap_fill_drain, values);
+            benchmark_function("std::priority_queue fill + drain" + suffix, priority_queue_fill_drain, values);
+            benchmark_function("DaryHeap<2> fill + drain" + suffix, dary_heap_fill_drain<2>, values);
+            benchmark_function("DaryHeap<4> fill + drain" + suffix, dary_heap_fill_drain<4>, values);
+            benchmark_function("DaryHeap<8> fill + drain" + suffix, dary_heap_fill_drain<8>, values);
+
+            benchmark_function("MinHeap pop/push mix" + suffix, min_heap_mix, values);
+            benchmark_function("std::priority_queue pop/push mix" + suffix, priority_queue_mix, values);
+            benchmark_function("DaryHeap<2> pop/push mix" + suffix, dary_heap_mix<2>, values);
+            benchmark_function("DaryHeap<4> pop/push mix" + suffix, dary_heap_mix<4>, values);
+            benchmark_function("DaryHeap<8> pop/push mix" + suffix, dary_heap_mix<8>, values);
+            benchmark_function("DaryHeap<4> replaceTop mix" + suffix, dary_heap_replace_top<4>, values);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <benchmarking.hpp>
+#include <delete-duplicates.hpp>
+#include <dynamic-array.hpp>
+#include <list.hpp>
+#include <random>
+#include <string>
+#include <unordered_set>
+
+// Random values in [0, unique), so most of the array is duplicates scattered over the whole range
+DynamicArray<int> make_values(int count, int unique)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> value(0, unique - 1);
+
+    DynamicArray<int> values(count);
+    for (int i = 0; i < count; i++)
+    {
+        values.append(value(rng));
+    }
+    return values;
+}
+
+// The previous implementation: erase every duplicate where it is found, shifting the tail each time
+int erase_each_duplicate(DynamicArray<int> values)
+{
+    std::unordered_set<int> seen;
+    int pos = 0;
+    while (pos < values.getSize())
+    {
+        if (!seen.insert(values[pos]).second)
+        {
+            values.erase(pos);
+        }
+        else
+        {
+            pos++;
+        }
+    }
+    return values.getSize() + values[values.getSize() - 1];
+}
+
+// deleteDuplicates, which compacts the array in a single pass with removeIf
+int compact_once(DynamicArray<int> values)
+{
+    deleteDuplicates(values);
+    return values.getSize() + values[values.getSize() - 1];
+}
+
+List<int> to_list(const DynamicArray<int>& values)
+{
+    List<int> list;
+    for (const int value : values)
+    {
+        list.append(value);
+    }
+    return list;
+}
+
+// The previous List path: erase each duplicate by its position, which walks from the head every time
+int erase_each_duplicate_by_position(List<int> values)
+{
+    std::unordered_set<int> seen;
+    auto it = values.begin();
+    int pos = 0;
+    while (it != values.end())
+    {
+        if (!seen.insert(*it).second)
+        {
+            it = values.erase(pos);
+        }
+        else
+        {
+            ++it;
+            pos++;
+        }
+    }
+    return values.getSize();
+}
+
+// deleteDuplicates, which unlinks each duplicate through its iterator
+int unlink_duplicates(List<int> values)
+{
+    deleteDuplicates(values);
+    return values.getSize();
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 10'000'000;
+    const int unique = count / 10;
+    // The erase loop is quadratic, it only runs on a prefix small enough to finish
+    const int smallCount = std::min(count, 100'000);
+
+    const DynamicArray<int> small = make_values(smallCount, smallCount / 10);
+    const DynamicArray<int> large = make_values(count, unique);
+    const List<int> smallList = to_list(small);
+    const List<int> largeList = to_list(make_values(count / 10, unique / 10));
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        benchmark_function("erase each duplicate, " + std::to_string(smallCount), erase_each_duplicate, small);
+        benchmark_function("deleteDuplicates, " + std::to_string(smallCount), compact_once, small);
+        benchmark_function("deleteDuplicates, " + std::to_string(count), compact_once, large);
+        benchmark_function(
+            "List erase each duplicate by position, " + std::to_string(smallCount), erase_each_duplicate_by_position,
+            smallList);
+        benchmark_function("List deleteDuplicates, " + std::to_string(smallCount), unlink_duplicates, smallList);
+        benchmark_function("List deleteDuplicates, " + std::to_string(count / 10), unlink_duplicates, largeList);
+    }
+
+    return 0;
+}
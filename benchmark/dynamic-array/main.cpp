@@ -0,0 +1,93 @@
+#include <benchmarking.hpp>
+#include <dynamic-array.hpp>
+#include <string>
+#include <vector>
+
+// 64 bytes of plain data, trivially copyable
+struct Pod64
+{
+    long long fields[8];
+};
+
+// Append n ints starting from the default capacity, so every doubling is exercised
+template <typename Container>
+int append_ints(int n)
+{
+    Container container;
+    for (int i = 0; i < n; i++)
+    {
+        container.push_back(i);
+    }
+    return container[n / 2];  // Read the data back so the appends cannot be optimized away
+}
+
+// Strings longer than the small string buffer, so copying them on growth would allocate
+template <typename Container>
+int append_strings(int n)
+{
+    const std::string text(64, 'x');
+    Container container;
+    for (int i = 0; i < n; i++)
+    {
+        container.push_back(text);
+    }
+    return container.size() + container[n / 2].size();
+}
+
+template <typename Container>
+int append_pods(int n)
+{
+    Container container;
+    for (int i = 0; i < n; i++)
+    {
+        container.push_back(Pod64{{i, i, i, i, i, i, i, i}});
+    }
+    return static_cast<int>(container[n / 2].fields[7]);
+}
+
+// Adapts DynamicArray to the push_back/size names used by the workloads above
+template <typename T>
+struct DynamicArrayAdapter
+{
+    DynamicArray<T> array;
+
+    void push_back(const T& value)
+    {
+        array.append(value);
+    }
+    void push_back(T&& value)
+    {
+        array.append(std::move(value));
+    }
+    int size() const
+    {
+        return array.getSize();
+    }
+    const T& operator[](int index) const
+    {
+        return array[index];
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    const int n = argc > 1 ? std::stoi(argv[1]) : 1'000'000;
+
+    // The first round also pays for page faults and for warming up the allocator free lists,
+    // compare the numbers of the second round.
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << ": appending " << n << " elements\n";
+
+        benchmark_function("DynamicArray<int>", append_ints<DynamicArrayAdapter<int>>, n);
+        benchmark_function("std::vector<int>", append_ints<std::vector<int>>, n);
+
+        benchmark_function("DynamicArray<std::string>", append_strings<DynamicArrayAdapter<std::string>>, n);
+        benchmark_function("std::vector<std::string>", append_strings<std::vector<std::string>>, n);
+
+        benchmark_function("DynamicArray<Pod64>", append_pods<DynamicArrayAdapter<Pod64>>, n);
+        benchmark_function("std::vector<Pod64>", append_pods<std::vector<Pod64>>, n);
+    }
+
+    return 0;
+}
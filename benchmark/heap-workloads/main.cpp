@@ -0,0 +1,326 @@
+#include <benchmarking.hpp>
+#include <heap.hpp>
+#include <limits>
+#include <pairing-heap.hpp>
+#include <radix-heap.hpp>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using Adjacency = std::vector<std::vector<std::pair<int, int>>>;  // (neighbor, weight)
+using Item = std::pair<int, int>;                                 // (distance or time, id)
+
+static int checksum(const std::vector<int>& values)
+{
+    long long check = 0;
+    for (int value : values)
+    {
+        check = (check + value) % 1'000'000'007;
+    }
+    return static_cast<int>(check);
+}
+
+// A sparse connected undirected graph: a ring through every vertex plus 3 random edges per vertex
+static Adjacency makeSparseGraph(int numVertices, std::mt19937& rng)
+{
+    Adjacency graph(numVertices);
+    auto addEdge = [&](int u, int v) {
+        const int weight = static_cast<int>(rng() % 1000) + 1;
+        graph[u].emplace_back(v, weight);
+        graph[v].emplace_back(u, weight);
+    };
+    for (int u = 0; u < numVertices; u++)
+    {
+        addEdge(u, (u + 1) % numVertices);
+        for (int k = 0; k < 3; k++)
+        {
+            addEdge(u, static_cast<int>(rng() % numVertices));
+        }
+    }
+    return graph;
+}
+
+////////////////////// Dijkstra-like: shortest paths from vertex 0
+
+// Without decrease-key: push a duplicate on every improvement and skip the stale entries
+int dijkstra_min_heap(const Adjacency& graph)
+{
+    std::vector<int> distances(graph.size(), std::numeric_limits<int>::max());
+    MinHeap<Item> heap;
+    distances[0] = 0;
+    heap.insert({0, 0});
+    while (!heap.isEmpty())
+    {
+        const auto [distance, u] = heap.top();
+        heap.pop();
+        if (distance > distances[u])
+        {
+            continue;
+        }
+        for (const auto& [v, weight] : graph[u])
+        {
+            if (distance + weight < distances[v])
+            {
+                distances[v] = distance + weight;
+                heap.insert({distances[v], v});
+            }
+        }
+    }
+    return checksum(distances);
+}
+
+// One node per vertex, moved up with decreaseKey
+int dijkstra_pairing_heap(const Adjacency& graph)
+{
+    std::vector<int> distances(graph.size(), std::numeric_limits<int>::max());
+    std::vector<PairingHeap<Item>::Handle> handles(graph.size());
+    std::vector<bool> settled(graph.size(), false);
+    PairingHeap<Item> heap;
+    distances[0] = 0;
+    handles[0] = heap.insert({0, 0});
+    while (!heap.isEmpty())
+    {
+        const int u = heap.top().second;
+        heap.pop();
+        settled[u] = true;
+        for (const auto& [v, weight] : graph[u])
+        {
+            const int distance = distances[u] + weight;
+            if (settled[v] || distance >= distances[v])
+            {
+                continue;
+            }
+            if (distances[v] == std::numeric_limits<int>::max())
+            {
+                handles[v] = heap.insert({distance, v});
+            }
+            else
+            {
+                heap.decreaseKey(handles[v], {distance, v});
+            }
+            distances[v] = distance;
+        }
+    }
+    return checksum(distances);
+}
+
+// Without decrease-key, like the MinHeap version: the distances popped never decrease, as the radix heap requires
+int dijkstra_radix_heap(const Adjacency& graph)
+{
+    std::vector<int> distances(graph.size(), std::numeric_limits<int>::max());
+    RadixHeap<unsigned, int> heap;
+    distances[0] = 0;
+    heap.insert(0, 0);
+    while (!heap.isEmpty())
+    {
+        const auto [distance, u] = heap.top();
+        heap.pop();
+        if (static_cast<int>(distance) > distances[u])
+        {
+            continue;
+        }
+        for (const auto& [v, weight] : graph[u])
+        {
+            const int newDistance = static_cast<int>(distance) + weight;
+            if (newDistance < distances[v])
+            {
+                distances[v] = newDistance;
+                heap.insert(static_cast<unsigned>(newDistance), v);
+            }
+        }
+    }
+    return checksum(distances);
+}
+
+////////////////////// Event simulation: pop the next event, schedule the next one of its source (the hold model)
+
+static std::vector<int> makeDelays(int count, std::mt19937& rng)
+{
+    std::vector<int> delays(count);
+    for (int& delay : delays)
+    {
+        delay = static_cast<int>(rng() % 1000) + 1;
+    }
+    return delays;
+}
+
+int events_min_heap(const std::vector<int>& delays, int pending)
+{
+    MinHeap<Item> heap;
+    for (int source = 0; source < pending; source++)
+    {
+        heap.insert({delays[source], source});
+    }
+    long long check = 0;
+    for (std::size_t step = pending; step < delays.size(); step++)
+    {
+        const auto [time, source] = heap.top();
+        heap.pop();
+        check += source;
+        heap.insert({time + delays[step], source});
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+int events_pairing_heap(const std::vector<int>& delays, int pending)
+{
+    PairingHeap<Item> heap;
+    for (int source = 0; source < pending; source++)
+    {
+        heap.insert({delays[source], source});
+    }
+    long long check = 0;
+    for (std::size_t step = pending; step < delays.size(); step++)
+    {
+        const auto [time, source] = heap.top();
+        heap.pop();
+        check += source;
+        heap.insert({time + delays[step], source});
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+// Events at the same time come out in another order than (time, source), so the checksum differs
+int events_radix_heap(const std::vector<int>& delays, int pending)
+{
+    RadixHeap<unsigned, int> heap;
+    for (int source = 0; source < pending; source++)
+    {
+        heap.insert(static_cast<unsigned>(delays[source]), source);
+    }
+    long long check = 0;
+    for (std::size_t step = pending; step < delays.size(); step++)
+    {
+        const auto [time, source] = heap.top();
+        heap.pop();
+        check += source;
+        heap.insert(time + static_cast<unsigned>(delays[step]), source);
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+////////////////////// Meld-heavy: heaps of 64 values melded pairwise into one, then the 64 smallest values popped
+
+constexpr int MELD_HEAP_SIZE = 64;
+
+// MinHeap has no meld: the smaller heap is inserted into the larger one
+int meld_min_heap(const std::vector<int>& values)
+{
+    std::vector<MinHeap<int>> heaps(values.size() / MELD_HEAP_SIZE);
+    for (std::size_t i = 0; i < heaps.size() * MELD_HEAP_SIZE; i++)
+    {
+        heaps[i / MELD_HEAP_SIZE].insert(values[i]);
+    }
+    for (std::size_t width = 1; width < heaps.size(); width *= 2)
+    {
+        for (std::size_t i = 0; i + width < heaps.size(); i += 2 * width)
+        {
+            for (int value : heaps[i + width].toVector())
+            {
+                heaps[i].insert(value);
+            }
+            heaps[i + width] = MinHeap<int>();
+        }
+    }
+    long long check = 0;
+    for (long long rank = 0; rank < MELD_HEAP_SIZE && !heaps[0].isEmpty(); rank++)
+    {
+        check += rank * heaps[0].top();
+        heaps[0].pop();
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+int meld_pairing_heap(const std::vector<int>& values)
+{
+    std::vector<PairingHeap<int>> heaps(values.size() / MELD_HEAP_SIZE);
+    for (std::size_t i = 0; i < heaps.size() * MELD_HEAP_SIZE; i++)
+    {
+        heaps[i / MELD_HEAP_SIZE].insert(values[i]);
+    }
+    for (std::size_t width = 1; width < heaps.size(); width *= 2)
+    {
+        for (std::size_t i = 0; i + width < heaps.size(); i += 2 * width)
+        {
+            heaps[i].meld(heaps[i + width]);
+        }
+    }
+    long long check = 0;
+    for (long long rank = 0; rank < MELD_HEAP_SIZE && !heaps[0].isEmpty(); rank++)
+    {
+        check += rank * heaps[0].top();
+        heaps[0].pop();
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+// RadixHeap has no meld either; every heap here is fresh, so the other heap is inserted as MinHeap does
+int meld_radix_heap(const std::vector<int>& values)
+{
+    std::vector<RadixHeap<unsigned>> heaps(values.size() / MELD_HEAP_SIZE);
+    for (std::size_t i = 0; i < heaps.size() * MELD_HEAP_SIZE; i++)
+    {
+        heaps[i / MELD_HEAP_SIZE].insert(static_cast<unsigned>(values[i]));
+    }
+    for (std::size_t width = 1; width < heaps.size(); width *= 2)
+    {
+        for (std::size_t i = 0; i + width < heaps.size(); i += 2 * width)
+        {
+            for (unsigned value : heaps[i + width].toVector())
+            {
+                heaps[i].insert(value);
+            }
+            heaps[i + width].clear();
+        }
+    }
+    long long check = 0;
+    for (long long rank = 0; rank < MELD_HEAP_SIZE && !heaps[0].isEmpty(); rank++)
+    {
+        check += rank * heaps[0].topKey();
+        heaps[0].pop();
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+int main()
+{
+    std::mt19937 rng(42);
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        for (int numVertices : {100'000, 1'000'000})
+        {
+            const Adjacency graph = makeSparseGraph(numVertices, rng);
+            const std::string suffix =
+                ", V = " + std::to_string(numVertices) + ", E = " + std::to_string(4 * numVertices);
+            benchmark_function("Dijkstra MinHeap (lazy)" + suffix, dijkstra_min_heap, graph);
+            benchmark_function("Dijkstra PairingHeap (decreaseKey)" + suffix, dijkstra_pairing_heap, graph);
+            benchmark_function("Dijkstra RadixHeap (lazy)" + suffix, dijkstra_radix_heap, graph);
+        }
+
+        const std::vector<int> delays = makeDelays(5'000'000, rng);
+        for (int pending : {1'000, 100'000, 1'000'000})
+        {
+            const std::string suffix = ", " + std::to_string(pending) + " pending, 5e6 events";
+            benchmark_function("Events MinHeap" + suffix, events_min_heap, delays, pending);
+            benchmark_function("Events PairingHeap" + suffix, events_pairing_heap, delays, pending);
+            benchmark_function("Events RadixHeap" + suffix, events_radix_heap, delays, pending);
+        }
+
+        for (int count : {100'000, 1'000'000})
+        {
+            std::vector<int> values(count);
+            for (int& value : values)
+            {
+                value = static_cast<int>(rng() % 1'000'000);
+            }
+            const std::string suffix = ", " + std::to_string(count) + " ints in heaps of 64";
+            benchmark_function("Meld + pop 64 MinHeap" + suffix, meld_min_heap, values);
+            benchmark_function("Meld + pop 64 PairingHeap" + suffix, meld_pairing_heap, values);
+            benchmark_function("Meld + pop 64 RadixHeap" + suffix, meld_radix_heap, values);
+        }
+    }
+
+    return 0;
+}
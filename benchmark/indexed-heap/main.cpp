@@ -0,0 +1,159 @@
+#include <benchmarking.hpp>
+#include <functional>
+#include <limits>
+#include <optimization-problems-gm.hpp>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A sparse connected undirected graph: a ring through every vertex plus edgesPerVertex random edges per vertex. The
+// matrix keeps the last of parallel edges and the list keeps all of them, so their results differ slightly
+static WeightedEdgeList makeSparseGraph(int numVertices, int edgesPerVertex, std::mt19937& rng)
+{
+    WeightedEdgeList edges;
+    for (int u = 0; u < numVertices; u++)
+    {
+        edges.emplace_back(u, (u + 1) % numVertices, static_cast<int>(rng() % 1000) + 1);
+        for (int k = 0; k < edgesPerVertex; k++)
+        {
+            const int v = static_cast<int>(rng() % numVertices);
+            if (v != u)
+            {
+                edges.emplace_back(u, v, static_cast<int>(rng() % 1000) + 1);
+            }
+        }
+    }
+    return edges;
+}
+
+static WeightAdjacencyList toAdjacencyList(const WeightedEdgeList& edges, int numVertices)
+{
+    WeightAdjacencyList graph(numVertices);
+    for (const auto& [u, v, w] : edges)
+    {
+        graph[u].emplace_back(v, w);
+        graph[v].emplace_back(u, w);
+    }
+    return graph;
+}
+
+static AdjacencyMatrix toAdjacencyMatrix(const WeightedEdgeList& edges, int numVertices)
+{
+    AdjacencyMatrix graph(numVertices, std::vector<int>(numVertices, 0));
+    for (const auto& [u, v, w] : edges)
+    {
+        graph[u][v] = w;
+        graph[v][u] = w;
+    }
+    return graph;
+}
+
+static int checksum(const std::vector<int>& distances)
+{
+    long long check = 0;
+    for (int distance : distances)
+    {
+        check = (check + distance) % 1'000'000'007;
+    }
+    return static_cast<int>(check);
+}
+
+int dijkstra_matrix(const AdjacencyMatrix& graph)
+{
+    return checksum(dijkstraMethod(graph, 0));
+}
+
+int dijkstra_indexed_heap(const WeightAdjacencyList& graph)
+{
+    return checksum(dijkstraMethod(graph, 0));
+}
+
+// The usual alternative without decrease-key: push a duplicate on every improvement and skip stale entries
+int dijkstra_lazy_priority_queue(const WeightAdjacencyList& graph)
+{
+    using Item = std::pair<int, int>;  // (distance, vertex)
+    std::vector<int> distances(graph.size(), std::numeric_limits<int>::max());
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> queue;
+    distances[0] = 0;
+    queue.emplace(0, 0);
+    while (!queue.empty())
+    {
+        const auto [distance, u] = queue.top();
+        queue.pop();
+        if (distance > distances[u])
+        {
+            continue;
+        }
+        for (const auto& [v, weight] : graph[u])
+        {
+            if (distance + weight < distances[v])
+            {
+                distances[v] = distance + weight;
+                queue.emplace(distances[v], v);
+            }
+        }
+    }
+    return checksum(distances);
+}
+
+int prim_matrix(const AdjacencyMatrix& graph)
+{
+    const AdjacencyMatrix mst = primsMethod(graph);
+    long long total = 0;
+    for (const auto& row : mst)
+    {
+        for (int weight : row)
+        {
+            total += weight;
+        }
+    }
+    return static_cast<int>(total / 2 % 1'000'000'007);
+}
+
+int prim_indexed_heap(const WeightAdjacencyList& graph)
+{
+    long long total = 0;
+    for (const auto& [parent, v, weight] : primsMethod(graph))
+    {
+        total += weight;
+    }
+    return static_cast<int>(total % 1'000'000'007);
+}
+
+int main(int argc, char* argv[])
+{
+    // The O(V^2) matrix versions stop here: a 1e6 x 1e6 matrix would take 4 TB
+    const int maxMatrixVertices = argc > 1 ? std::stoi(argv[1]) : 5'000;
+    // The matrix Prim rescans the rows of every vertex in the tree at each step, O(V^3): 2 minutes at V = 5000
+    const int maxMatrixPrimVertices = 2'000;
+    const int edgesPerVertex = 3;
+
+    std::mt19937 rng(42);
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        for (int numVertices : {2'000, 5'000, 100'000, 1'000'000})
+        {
+            const WeightedEdgeList edges = makeSparseGraph(numVertices, edgesPerVertex, rng);
+            const std::string suffix = ", V = " + std::to_string(numVertices) + ", E = " + std::to_string(edges.size());
+            const WeightAdjacencyList list = toAdjacencyList(edges, numVertices);
+
+            if (numVertices <= maxMatrixVertices)
+            {
+                const AdjacencyMatrix matrix = toAdjacencyMatrix(edges, numVertices);
+                benchmark_function("Dijkstra O(V^2) matrix scan" + suffix, dijkstra_matrix, matrix);
+                if (numVertices <= maxMatrixPrimVertices)
+                {
+                    benchmark_function("Prim matrix scan" + suffix, prim_matrix, matrix);
+                }
+            }
+            benchmark_function("Dijkstra IndexedHeap" + suffix, dijkstra_indexed_heap, list);
+            benchmark_function("Dijkstra lazy std::priority_queue" + suffix, dijkstra_lazy_priority_queue, list);
+            benchmark_function("Prim IndexedHeap" + suffix, prim_indexed_heap, list);
+        }
+    }
+
+    return 0;
+}
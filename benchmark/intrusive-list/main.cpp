@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <benchmarking.hpp>
+#include <cstdint>
+#include <intrusive-list.hpp>
+#include <list.hpp>
+#include <random>
+#include <string>
+#include <unordered-map.hpp>
+#include <vector>
+
+// The objects are allocated up front, as they would be in a pool: the containers only have to remember them. A
+// List<Task*> still needs a node per membership, an IntrusiveList links the hook embedded in the task.
+
+struct Task : IntrusiveListHook<>
+{
+    uint8_t key{0};
+    int payload[15]{};
+};
+
+std::vector<Task> make_tasks(int count)
+{
+    std::vector<Task> tasks(count);
+    for (int i = 0; i < count; i++)
+    {
+        tasks[i].key = static_cast<uint8_t>(i);
+        tasks[i].payload[0] = i;
+    }
+    return tasks;
+}
+
+std::vector<int> shuffled_indices(int count)
+{
+    std::vector<int> indices(count);
+    for (int i = 0; i < count; i++)
+    {
+        indices[i] = i;
+    }
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(42));
+    return indices;
+}
+
+// Round robin: the task at the front runs and goes to the back
+int pointer_list_rotate(int operations, int count)
+{
+    std::vector<Task> tasks = make_tasks(count);
+    List<Task*> list;
+    for (Task& task : tasks)
+    {
+        list.append(&task);
+    }
+    long long sum = 0;
+    for (int i = 0; i < operations; i++)
+    {
+        Task* task = *list.begin();
+        list.erase(list.begin());
+        sum += task->payload[0];
+        list.append(task);
+    }
+    return static_cast<int>(sum % 1'000'000);
+}
+
+int intrusive_list_rotate(int operations, int count)
+{
+    std::vector<Task> tasks = make_tasks(count);
+    IntrusiveList<Task> list;
+    for (Task& task : tasks)
+    {
+        list.append(task);
+    }
+    long long sum = 0;
+    for (int i = 0; i < operations; i++)
+    {
+        Task& task = *list.begin();
+        list.erase(list.begin());
+        sum += task.payload[0];
+        list.append(task);
+    }
+    return static_cast<int>(sum % 1'000'000);
+}
+
+// Tasks are cancelled in random order and rescheduled, the List<Task*> keeps an iterator per task to be fair
+int pointer_list_cancel(int rounds, int count)
+{
+    std::vector<Task> tasks = make_tasks(count);
+    const std::vector<int> order = shuffled_indices(count);
+    std::vector<ListIterator<Task*>> positions(count);
+    List<Task*> list;
+    int size = 0;
+    for (int round = 0; round < rounds; round++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            positions[i] = list.insert(list.end(), &tasks[i]);
+        }
+        size += list.getSize();
+        for (int i : order)
+        {
+            list.erase(positions[i]);
+        }
+    }
+    return size;
+}
+
+int intrusive_list_cancel(int rounds, int count)
+{
+    std::vector<Task> tasks = make_tasks(count);
+    const std::vector<int> order = shuffled_indices(count);
+    IntrusiveList<Task> list;
+    int size = 0;
+    for (int round = 0; round < rounds; round++)
+    {
+        for (Task& task : tasks)
+        {
+            list.append(task);
+        }
+        size += list.getSize();
+        for (int i : order)
+        {
+            list.erase(tasks[i]);
+        }
+    }
+    return size;
+}
+
+int pointer_map_insert_erase(int rounds, int count)
+{
+    std::vector<Task> tasks = make_tasks(count);
+    UnorderedMap<Task*, 64> map;
+    int found = 0;
+    for (int round = 0; round < rounds; round++)
+    {
+        for (Task& task : tasks)
+        {
+            map.insert(task.key, &task);
+        }
+        for (Task& task : tasks)
+        {
+            found += map.find(task.key).has_value() ? 1 : 0;
+            map.erase(task.key);
+        }
+    }
+    return found;
+}
+
+int intrusive_map_insert_erase(int rounds, int count)
+{
+    std::vector<Task> tasks = make_tasks(count);
+    IntrusiveUnorderedMap<Task, &Task::key, 64> map;
+    int found = 0;
+    for (int round = 0; round < rounds; round++)
+    {
+        for (Task& task : tasks)
+        {
+            map.insert(task);
+        }
+        for (Task& task : tasks)
+        {
+            found += map.find(task.key) != nullptr ? 1 : 0;
+            map.erase(task);
+        }
+    }
+    return found;
+}
+
+int main(int argc, char* argv[])
+{
+    const int operations = argc > 1 ? std::stoi(argv[1]) : 10'000'000;
+    const int tasks = 100'000;
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << ": " << operations << " operations, " << tasks << " tasks\n";
+
+        benchmark_function("List<Task*> rotate", pointer_list_rotate, operations, tasks);
+        benchmark_function("IntrusiveList<Task> rotate", intrusive_list_rotate, operations, tasks);
+        benchmark_function("List<Task*> cancel in random order", pointer_list_cancel, operations / tasks, tasks);
+        benchmark_function("IntrusiveList<Task> cancel in random order", intrusive_list_cancel, operations / tasks,
+                           tasks);
+        benchmark_function("UnorderedMap<Task*> insert/erase, 256 keys", pointer_map_insert_erase,
+                           operations / 256, 256);
+        benchmark_function("IntrusiveUnorderedMap<Task> insert/erase, 256 keys", intrusive_map_insert_erase,
+                           operations / 256, 256);
+    }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <benchmarking.hpp>
+#include <list.hpp>
+#include <queue.hpp>
+#include <string>
+#include <unordered-map.hpp>
+
+// Steady state workloads: the containers keep a bounded size while elements keep coming and going, so every
+// operation after the warm up can reuse a node released by a previous one.
+
+int queue_push_pop(int operations, int window)
+{
+    Queue<int, List<int>> queue;
+    for (int i = 0; i < window; i++)
+    {
+        queue.push(i);
+    }
+    long long sum = 0;
+    for (int i = 0; i < operations; i++)
+    {
+        sum += queue.front();
+        queue.pop();
+        queue.push(i);
+    }
+    return static_cast<int>(sum % 1'000'000);
+}
+
+int list_churn(int operations, int window)
+{
+    List<std::string> list;
+    for (int i = 0; i < window; i++)
+    {
+        list.append("item");
+    }
+    for (int i = 0; i < operations; i++)
+    {
+        list.erase(0);
+        list.append("item");
+    }
+    return list.getSize();
+}
+
+int map_insert_erase(int operations, int keys)
+{
+    UnorderedMap<int, 64> map;
+    int found = 0;
+    for (int i = 0; i < operations; i++)
+    {
+        const auto key = static_cast<uint8_t>(i % keys);
+        if (i / keys % 2 == 0)
+        {
+            map.insert(key, i);
+        }
+        else
+        {
+            found += map.find(key).has_value() ? 1 : 0;
+            map.erase(key);
+        }
+    }
+    return found;
+}
+
+int main(int argc, char* argv[])
+{
+    const int operations = argc > 1 ? std::stoi(argv[1]) : 1'000'000;
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << ": " << operations << " operations\n";
+
+        benchmark_function("Queue push/pop, 16 queued", queue_push_pop, operations, 16);
+        benchmark_function("Queue push/pop, 100000 queued", queue_push_pop, operations, 100'000);
+        benchmark_function("List<std::string> erase/append", list_churn, operations, 1'000);
+        benchmark_function("UnorderedMap insert/erase, 256 keys", map_insert_erase, operations, 256);
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <benchmarking.hpp>
+#include <dynamic-array.hpp>
+#include <list.hpp>
+#include <quick-sort.hpp>
+#include <random>
+#include <sort-list.hpp>
+#include <string>
+
+template <typename T>
+List<T> make_list(int count, T (*make)(std::mt19937&))
+{
+    std::mt19937 rng(42);
+    List<T> list;
+    for (int i = 0; i < count; i++)
+    {
+        list.append(make(rng));
+    }
+    return list;
+}
+
+int random_int(std::mt19937& rng)
+{
+    return static_cast<int>(rng() % 1'000'000'000);
+}
+
+std::string random_string(std::mt19937& rng)
+{
+    return "key-" + std::to_string(rng()) + "-padding-past-the-small-string-buffer";
+}
+
+template <typename T>
+int checksum(const List<T>& list)
+{
+    return list.isEmpty() ? 0 : list.getSize() + static_cast<int>(std::hash<T>()(*list.begin()) % 1000);
+}
+
+// Relink the nodes with the natural merge sort of List
+template <typename T>
+int sort_list(List<T>& list)
+{
+    sortList(list);
+    return checksum(list);
+}
+
+// Copy the values to a DynamicArray, sort it and copy them back over the nodes
+template <typename T>
+int sort_through_array(List<T>& list)
+{
+    DynamicArray<T> values(list.getSize());
+    for (const T& value : list)
+    {
+        values.append(value);
+    }
+    std::sort(values.begin(), values.end());
+    int index = 0;
+    for (T& value : list)
+    {
+        value = values[index++];
+    }
+    return checksum(list);
+}
+
+// The iterator based quickSort, whose iterator comparisons walk the list
+int quick_sort_list(List<int>& list)
+{
+    quickSort(list.begin(), list.end());
+    return checksum(list);
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 1'000'000;
+    const int small = 5'000;
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << ": " << count << " elements\n";
+
+        List<int> ints = make_list(count, random_int);
+        benchmark_function("sortList, List<int>", sort_list<int>, ints);
+        ints = make_list(count, random_int);
+        benchmark_function("DynamicArray copy/sort/copy, List<int>", sort_through_array<int>, ints);
+        benchmark_function("sortList, List<int> already sorted", sort_list<int>, ints);
+
+        List<std::string> strings = make_list(count / 4, random_string);
+        benchmark_function("sortList, List<std::string> (n / 4)", sort_list<std::string>, strings);
+        strings = make_list(count / 4, random_string);
+        benchmark_function("DynamicArray copy/sort/copy, List<std::string> (n / 4)",
+                           sort_through_array<std::string>, strings);
+
+        List<int> few = make_list(small, random_int);
+        benchmark_function("quickSort, List<int> of 5000", quick_sort_list, few);
+        few = make_list(small, random_int);
+        benchmark_function("sortList, List<int> of 5000", sort_list<int>, few);
+    }
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include <benchmarking.hpp>
+#include <cstdint>
+#include <dynamic-array.hpp>
+#include <mapped-dynamic-array.hpp>
+#include <string>
+
+// Append count elements one by one, as a loader filling a huge array would
+template <typename Container>
+int append_all(Container& container, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        container.append(i);
+    }
+    return container[container.getSize() - 1];
+}
+
+// Read count elements at pseudo random positions, every read is likely a cache and TLB miss
+template <typename Container>
+int random_reads(const Container& container, int count)
+{
+    std::uint64_t state = 88172645463325252ULL;
+    const std::uint64_t size = static_cast<std::uint64_t>(container.getSize());
+    int checksum = 0;
+    for (int i = 0; i < count; i++)
+    {
+        state ^= state << 13;  // xorshift64
+        state ^= state >> 7;
+        state ^= state << 17;
+        checksum += container[static_cast<int>(state % size)];
+    }
+    return checksum;
+}
+
+template <typename Container>
+void run(const std::string& name, int count)
+{
+    Container container;
+    benchmark_function(name + " append", [&]() { return append_all(container, count); });
+    benchmark_function(name + " random reads", [&]() { return random_reads(container, count); });
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 100'000'000;
+    std::cout << "Appending and randomly reading " << count << " ints\n";
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        run<DynamicArray<int>>("DynamicArray<int>", count);
+        run<MappedDynamicArray<int>>("MappedDynamicArray<int>", count);
+    }
+
+    return 0;
+}
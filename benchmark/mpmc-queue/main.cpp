@@ -0,0 +1,106 @@
+#include <atomic>
+#include <benchmarking.hpp>
+#include <mpmc-queue.hpp>
+#include <mutex>
+#include <queue.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr int CAPACITY = 4096;
+
+// Start pairs producers, each pushing its share of count, and pairs consumers sharing everything they pop
+template <typename Push, typename TryPop>
+int run_pairs(int pairs, int count, Push push, TryPop tryPop)
+{
+    std::atomic<int> remaining = count;
+    std::atomic<long long> sum = 0;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < pairs; p++)
+    {
+        threads.emplace_back(
+            [&, p]
+            {
+                for (int i = p; i < count; i += pairs)
+                {
+                    push(i);
+                }
+            });
+        threads.emplace_back(
+            [&]
+            {
+                long long local = 0;
+                int value = 0;
+                while (remaining.load(std::memory_order_relaxed) > 0)
+                {
+                    if (tryPop(value))
+                    {
+                        local += value;
+                        remaining.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                sum += local;
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    return static_cast<int>(sum.load() % 1'000'000'007);
+}
+
+// Today's approach: a Queue shared under a mutex
+int mutex_queue(int pairs, int count)
+{
+    Queue<int> queue;
+    std::mutex mutex;
+    return run_pairs(
+        pairs, count,
+        [&](int value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push(value);
+        },
+        [&](int& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.isEmpty())
+            {
+                return false;
+            }
+            value = queue.front();
+            queue.pop();
+            return true;
+        });
+}
+
+int mpmc_queue(int pairs, int count)
+{
+    MpmcQueue<int> queue(CAPACITY);
+    return run_pairs(
+        pairs, count, [&](int value) { queue.push(value); }, [&](int& value) { return queue.tryPop(value); });
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 10'000'000;
+    std::cout << "Handing off " << count << " ints in total, hardware threads: " << std::thread::hardware_concurrency()
+              << "\n";
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        for (int pairs : {1, 2, 4, 8, 16, 32})
+        {
+            const std::string suffix = ", " + std::to_string(pairs) + " producer/consumer pairs";
+            benchmark_function("mutex + Queue" + suffix, mutex_queue, pairs, count);
+            benchmark_function("MpmcQueue" + suffix, mpmc_queue, pairs, count);
+        }
+    }
+
+    return 0;
+}
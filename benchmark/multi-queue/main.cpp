@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <atomic>
+#include <benchmarking.hpp>
+#include <heap.hpp>
+#include <multi-queue.hpp>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+constexpr int PENDING = 100'000;  // Elements in the queue while the threads work
+
+// Run work(threadIndex) on threadCount threads and wait for all of them
+template <typename Work>
+void run_threads(int threadCount, Work work)
+{
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back(work, t);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Today's approach: one MinHeap under a mutex
+class LockedMinHeap
+{
+public:
+    void push(long long value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mHeap.insert(value);
+    }
+
+    bool tryPop(long long& value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mHeap.isEmpty())
+        {
+            return false;
+        }
+        value = mHeap.top();
+        mHeap.pop();
+        return true;
+    }
+
+private:
+    std::mutex mMutex;
+    MinHeap<long long> mHeap;
+};
+
+////////////////////// Throughput: every thread pops the most urgent item and pushes a later one (a scheduler loop)
+
+template <typename Queue>
+int pop_push(Queue& queue, int threadCount, int operations)
+{
+    for (int i = 0; i < PENDING; i++)
+    {
+        queue.push(i);
+    }
+    std::atomic<long long> sum = 0;
+    run_threads(threadCount,
+                [&](int t)
+                {
+                    long long local = 0;
+                    long long value = 0;
+                    for (int i = t; i < operations; i += threadCount)
+                    {
+                        if (queue.tryPop(value))
+                        {
+                            local += value % 1000;
+                            queue.push(value + 1 + i % 1000);
+                        }
+                    }
+                    sum += local;
+                });
+    return static_cast<int>(sum.load() % 1'000'000'007);
+}
+
+int locked_min_heap(int threadCount, int operations)
+{
+    LockedMinHeap queue;
+    return pop_push(queue, threadCount, operations);
+}
+
+int multi_queue(int threadCount, int operations, int queuesPerThread)
+{
+    MultiQueue<long long> queue(threadCount, queuesPerThread);
+    return pop_push(queue, threadCount, operations);
+}
+
+////////////////////// Quality: the rank error of the pops while the threads drain a queue of distinct keys
+
+// Counts of keys still in the queue, by key (a Fenwick tree)
+class RemainingKeys
+{
+public:
+    explicit RemainingKeys(int count) : mTree(count + 1, 0)
+    {
+        for (int key = 0; key < count; key++)
+        {
+            add(key, 1);
+        }
+    }
+
+    void add(int key, int delta)
+    {
+        for (int i = key + 1; i < static_cast<int>(mTree.size()); i += i & -i)
+        {
+            mTree[i] += delta;
+        }
+    }
+
+    // The number of keys left smaller than key
+    int countBelow(int key) const
+    {
+        int count = 0;
+        for (int i = key; i > 0; i -= i & -i)
+        {
+            count += mTree[i];
+        }
+        return count;
+    }
+
+private:
+    std::vector<int> mTree;
+};
+
+// Drain a shuffled 0..PENDING-1, stamp each pop with a global ticket right after it, then replay the pops in ticket
+// order to get the rank of each key among the keys left
+template <typename Queue>
+void report_rank_error(const std::string& name, Queue& queue, int threadCount)
+{
+    std::vector<int> keys(PENDING);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+    for (int key : keys)
+    {
+        queue.push(key);
+    }
+
+    std::atomic<int> tickets = 0;
+    std::vector<int> byTicket(PENDING);
+    run_threads(threadCount,
+                [&](int)
+                {
+                    long long value = 0;
+                    while (queue.tryPop(value))
+                    {
+                        byTicket[tickets.fetch_add(1)] = static_cast<int>(value);
+                    }
+                });
+
+    RemainingKeys remaining(PENDING);
+    long long rankSum = 0;
+    int rankMax = 0;
+    for (int key : byTicket)
+    {
+        const int rank = remaining.countBelow(key);
+        rankSum += rank;
+        rankMax = std::max(rankMax, rank);
+        remaining.add(key, -1);
+    }
+    std::cout << name << " rank error: mean " << static_cast<double>(rankSum) / PENDING << ", max " << rankMax
+              << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    const int operations = argc > 1 ? std::stoi(argv[1]) : 4'000'000;
+    std::cout << operations << " pop/push in total on " << PENDING
+              << " pending elements, hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        for (int threadCount : {1, 2, 4, 8, 16, 32, 64})
+        {
+            const std::string threads = ", " + std::to_string(threadCount) + " threads";
+            benchmark_function("mutex + MinHeap pop/push" + threads, locked_min_heap, threadCount, operations);
+            benchmark_function("MultiQueue c=2 pop/push" + threads, multi_queue, threadCount, operations, 2);
+            benchmark_function("MultiQueue c=4 pop/push" + threads, multi_queue, threadCount, operations, 4);
+
+            // The mutex is only exact up to the threads preempted between their pop and their ticket
+            LockedMinHeap locked;
+            report_rank_error("mutex + MinHeap" + threads, locked, threadCount);
+            MultiQueue<long long> twoPerThread(threadCount, 2);
+            report_rank_error("MultiQueue c=2" + threads, twoPerThread, threadCount);
+            MultiQueue<long long> fourPerThread(threadCount, 4);
+            report_rank_error("MultiQueue c=4" + threads, fourPerThread, threadCount);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <benchmarking.hpp>
+#include <dynamic-array.hpp>
+#include <filesystem>
+#include <fstream>
+#include <persistent-dynamic-array.hpp>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// The dataset: a cheap function of the index, so every loader can be checked against it
+int value_at(int index)
+{
+    return index * 7 + 3;
+}
+
+// Read a handful of elements spread over the whole array, as a service answering its first requests would
+template <typename Container>
+int first_requests(const Container& container)
+{
+    int checksum = 0;
+    const int step = container.getSize() / 1000;
+    for (int i = 0; i < container.getSize(); i += step)
+    {
+        checksum += container[i];
+    }
+    return checksum;
+}
+
+// Evict the files from the page cache so every start reads from disk (needs root, skipped otherwise)
+bool drop_page_cache()
+{
+    sync();
+    std::ofstream dropCaches("/proc/sys/vm/drop_caches");
+    dropCaches << "1" << std::endl;
+    return static_cast<bool>(dropCaches);
+}
+
+// Rebuild the dataset from scratch
+int rebuild(int count)
+{
+    DynamicArray<int> values(count);
+    for (int i = 0; i < count; i++)
+    {
+        values.append(value_at(i));
+    }
+    return first_requests(values);
+}
+
+// Load a raw dump of the dataset into a DynamicArray
+int load_dump(const std::string& path, int count)
+{
+    DynamicArray<int> values(count);
+    std::ifstream input(path, std::ios::binary);
+    std::vector<int> chunk(1 << 20);
+    while (values.getSize() < count)
+    {
+        const int chunkSize = std::min(static_cast<int>(chunk.size()), count - values.getSize());
+        input.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunkSize * sizeof(int)));
+        values.appendRange(chunk.begin(), chunk.begin() + chunkSize);
+    }
+    return first_requests(values);
+}
+
+// Map the persistent array and read its last element: only the header and one page come from disk
+int open_persistent(const std::string& path)
+{
+    PersistentDynamicArray<int> values(path);
+    return values[values.getSize() - 1];
+}
+
+// Map the persistent array and serve the first requests, every one of them faults its page in from disk
+int open_persistent_and_serve(const std::string& path)
+{
+    PersistentDynamicArray<int> values(path);
+    return first_requests(values);
+}
+
+// Map the persistent array and touch every element, the cost when the whole dataset is needed
+int open_persistent_and_scan(const std::string& path)
+{
+    PersistentDynamicArray<int> values(path);
+    int checksum = 0;
+    for (int value : values)
+    {
+        checksum += value;
+    }
+    return checksum;
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 500'000'000;  // 2 GB of ints
+    const std::filesystem::path directory = argc > 2 ? argv[2] : std::filesystem::temp_directory_path();
+    const std::string dumpPath = (directory / "persistent-benchmark.dump").string();
+    const std::string persistentPath = (directory / "persistent-benchmark.array").string();
+
+    // Setup: write the same dataset as a raw dump and as a persistent array
+    std::filesystem::remove(persistentPath);
+    {
+        PersistentDynamicArray<int> values(persistentPath);
+        std::ofstream dump(dumpPath, std::ios::binary);
+        for (int i = 0; i < count; i++)
+        {
+            values.append(value_at(i));
+            const int value = value_at(i);
+            dump.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+        values.flush();
+    }
+    std::cout << "Starting with " << count << " ints (" << count * sizeof(int) / (1 << 20) << " MiB)\n";
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        benchmark_function("Rebuild DynamicArray", rebuild, count);
+
+        const bool cold = drop_page_cache();
+        std::cout << (cold ? "(page cache dropped)\n" : "(page cache not dropped, warm start)\n");
+        benchmark_function("Load dump into DynamicArray", load_dump, dumpPath, count);
+
+        drop_page_cache();
+        benchmark_function("Open PersistentDynamicArray", open_persistent, persistentPath);
+
+        drop_page_cache();
+        benchmark_function("Open PersistentDynamicArray and serve", open_persistent_and_serve, persistentPath);
+
+        drop_page_cache();
+        benchmark_function("Open PersistentDynamicArray and scan", open_persistent_and_scan, persistentPath);
+    }
+
+    std::filesystem::remove(dumpPath);
+    std::filesystem::remove(persistentPath);
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <benchmarking.hpp>
+#include <list.hpp>
+#include <queue.hpp>
+#include <ring-buffer.hpp>
+#include <string>
+
+constexpr int OPERATIONS = 10'000'000;
+
+// Steady state: the queue keeps window elements while one is pushed for every one popped
+template <typename Container>
+int push_pop_window(int window)
+{
+    Queue<int, Container> queue;
+    for (int i = 0; i < window; i++)
+    {
+        queue.push(i);
+    }
+    long long sum = 0;
+    for (int i = 0; i < OPERATIONS; i++)
+    {
+        sum += queue.front();
+        queue.pop();
+        queue.push(i);
+    }
+    return static_cast<int>(sum % 1'000'000'007);
+}
+
+// Bursts: the queue is filled with burst elements, then drained, as a BFS does level by level
+template <typename Container>
+int push_pop_bursts(int burst)
+{
+    Queue<int, Container> queue;
+    long long sum = 0;
+    for (int round = 0; round < OPERATIONS / burst; round++)
+    {
+        for (int i = 0; i < burst; i++)
+        {
+            queue.push(round + i);
+        }
+        while (!queue.isEmpty())
+        {
+            sum += queue.front();
+            queue.pop();
+        }
+    }
+    return static_cast<int>(sum % 1'000'000'007);
+}
+
+int main()
+{
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        for (int window : {16, 1024, 65536})
+        {
+            const std::string suffix = ", window " + std::to_string(window) + ", 10M push/pop";
+            benchmark_function("Queue<RingBuffer>" + suffix, push_pop_window<RingBuffer<int>>, window);
+            benchmark_function("Queue<List>" + suffix, push_pop_window<List<int>>, window);
+        }
+        for (int burst : {64, 4096, 1 << 20})
+        {
+            const std::string suffix = ", bursts of " + std::to_string(burst) + ", 10M push/pop";
+            benchmark_function("Queue<RingBuffer>" + suffix, push_pop_bursts<RingBuffer<int>>, burst);
+            benchmark_function("Queue<List>" + suffix, push_pop_bursts<List<int>>, burst);
+        }
+    }
+
+    return 0;
+}
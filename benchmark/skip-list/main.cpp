@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <avl-binary-search-tree.hpp>
+#include <benchmarking.hpp>
+#include <random>
+#include <skip-list.hpp>
+#include <string>
+#include <vector>
+
+// Random distinct keys: the multiples of 3 below 3 * count, shuffled, so lookups of other numbers miss
+std::vector<int> make_keys(int count)
+{
+    std::vector<int> keys(count);
+    for (int i = 0; i < count; i++)
+    {
+        keys[i] = i * 3;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+    return keys;
+}
+
+std::vector<int> make_lookups(int count, int range)
+{
+    std::mt19937 rng(7);
+    std::vector<int> lookups(count);
+    for (int& key : lookups)
+    {
+        key = static_cast<int>(rng() % range);
+    }
+    return lookups;
+}
+
+int skip_list_insert(SkipList<int>& list, const std::vector<int>& keys)
+{
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+    return list.getSize();
+}
+
+// insertBST, in random order the tree stays O(log n) deep; insertAVL recomputes the heights of the whole tree
+int bst_insert(AVLNode<int>*& root, const std::vector<int>& keys)
+{
+    for (int key : keys)
+    {
+        insertBST(root, key);
+    }
+    return root != nullptr ? 1 : 0;
+}
+
+int avl_insert(const std::vector<int>& keys)
+{
+    AVLNode<int>* root = nullptr;
+    for (int key : keys)
+    {
+        insertAVL(root, key);
+    }
+    const int height = root->height;
+    delete root;
+    return height;
+}
+
+int skip_list_lookup(const SkipList<int>& list, const std::vector<int>& lookups)
+{
+    int found = 0;
+    for (int key : lookups)
+    {
+        found += list.contains(key) ? 1 : 0;
+    }
+    return found;
+}
+
+int bst_lookup(AVLNode<int>* root, const std::vector<int>& lookups)
+{
+    int found = 0;
+    for (int key : lookups)
+    {
+        found += searchBST(root, key) != nullptr ? 1 : 0;
+    }
+    return found;
+}
+
+int skip_list_scan(const SkipList<int>& list, const std::vector<int>& starts, int width)
+{
+    long long sum = 0;
+    for (int start : starts)
+    {
+        list.scan(start, start + width, [&sum](int key) { sum += key; });
+    }
+    return static_cast<int>(sum % 1'000'000);
+}
+
+// In order traversal of the keys in [low, high), skipping the subtrees outside of the range
+void bst_range(AVLNode<int>* node, int low, int high, long long& sum)
+{
+    while (node != nullptr)
+    {
+        if (node->data < low)
+        {
+            node = node->rightChild;
+        }
+        else if (node->data >= high)
+        {
+            node = node->leftChild;
+        }
+        else
+        {
+            bst_range(node->leftChild, low, high, sum);
+            sum += node->data;
+            node = node->rightChild;
+        }
+    }
+}
+
+int bst_scan(AVLNode<int>* root, const std::vector<int>& starts, int width)
+{
+    long long sum = 0;
+    for (int start : starts)
+    {
+        bst_range(root, start, start + width, sum);
+    }
+    return static_cast<int>(sum % 1'000'000);
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 1'000'000;
+    const std::vector<int> keys = make_keys(count);
+    const std::vector<int> lookups = make_lookups(1'000'000, 3 * count);
+    const std::vector<int> starts = make_lookups(100'000, 3 * count);
+    const int width = 300;  // 100 keys per scan
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << ": " << count << " keys\n";
+
+        SkipList<int> list;
+        AVLNode<int>* root = nullptr;
+        benchmark_function("SkipList insert", skip_list_insert, list, keys);
+        benchmark_function("insertBST insert", bst_insert, root, keys);
+        benchmark_function("SkipList lookup, 1000000", skip_list_lookup, list, lookups);
+        benchmark_function("searchBST lookup, 1000000", bst_lookup, root, lookups);
+        benchmark_function("SkipList scan, 100000 ranges of 100", skip_list_scan, list, starts, width);
+        benchmark_function("BST scan, 100000 ranges of 100", bst_scan, root, starts, width);
+        delete root;
+    }
+
+    const std::vector<int> few(keys.begin(), keys.begin() + std::min(count, 5'000));
+    benchmark_function("insertAVL insert, 5000", avl_insert, few);
+
+    return 0;
+}
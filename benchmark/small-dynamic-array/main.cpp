@@ -0,0 +1,78 @@
+#include <benchmarking.hpp>
+#include <dynamic-array.hpp>
+#include <random>
+#include <small-dynamic-array.hpp>
+#include <stack.hpp>
+#include <vector>
+
+// Sizes of the arrays built by the workloads: 90% of them hold at most 8 elements, the rest 16 to 64.
+std::vector<int> make_sizes(int count)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> tiny(0, 8);
+    std::uniform_int_distribution<int> large(16, 64);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    std::vector<int> sizes;
+    for (int i = 0; i < count; i++)
+    {
+        sizes.push_back(percent(rng) < 90 ? tiny(rng) : large(rng));
+    }
+    return sizes;
+}
+
+// Build a short lived array for every size, fill it and read it back
+template <typename Container>
+int build_many(const std::vector<int>& sizes)
+{
+    int checksum = 0;
+    for (int size : sizes)
+    {
+        Container container;
+        for (int i = 0; i < size; i++)
+        {
+            container.append(i);
+        }
+        for (int value : container)
+        {
+            checksum += value;
+        }
+    }
+    return checksum;
+}
+
+// Use the array as the backing of a short lived Stack, as parentheses matching does
+template <typename Container>
+int stack_many(const std::vector<int>& sizes)
+{
+    int checksum = 0;
+    for (int size : sizes)
+    {
+        Stack<int, Container> stack;
+        for (int i = 0; i < size; i++)
+        {
+            stack.push(i);
+        }
+        while (!stack.isEmpty())
+        {
+            checksum += stack.top();
+            stack.pop();
+        }
+    }
+    return checksum;
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 1'000'000;
+    const std::vector<int> sizes = make_sizes(count);
+    std::cout << "Building " << count << " arrays, 90% of them with at most 8 elements\n";
+
+    benchmark_function("DynamicArray<int>", build_many<DynamicArray<int>>, sizes);
+    benchmark_function("SmallDynamicArray<int, 16>", build_many<SmallDynamicArray<int, 16>>, sizes);
+
+    benchmark_function("Stack over DynamicArray<int>", stack_many<DynamicArray<int>>, sizes);
+    benchmark_function("Stack over SmallDynamicArray<int, 16>", stack_many<SmallDynamicArray<int, 16>>, sizes);
+
+    return 0;
+}
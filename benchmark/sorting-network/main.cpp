@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <benchmarking.hpp>
+#include <dynamic-array.hpp>
+#include <insert-sort.hpp>
+#include <merge-elements.hpp>
+#include <quick-sort.hpp>
+#include <random>
+#include <sorting-network.hpp>
+#include <static-array.hpp>
+#include <string>
+#include <vector>
+
+constexpr int BATCHES = 1'000'000;
+
+template <typename T, int N>
+std::vector<StaticArray<T, N>> make_batches(std::mt19937& rng)
+{
+    std::vector<StaticArray<T, N>> batches(BATCHES);
+    for (auto& batch : batches)
+    {
+        for (T& value : batch)
+        {
+            value = static_cast<T>(rng() % 1'000'000);
+        }
+    }
+    return batches;
+}
+
+// Weigh every element by its position, so that the whole order is needed
+template <typename Array>
+long long weigh(const Array& array)
+{
+    long long weight = 0;
+    for (int i = 0; i < array.getSize(); i++)
+    {
+        weight += static_cast<long long>(array[i]) * (i + 1);
+    }
+    return weight;
+}
+
+// Sort a copy of every batch, so that each sort sees unsorted data
+template <typename T, int N>
+int sort_static(const std::vector<StaticArray<T, N>>& batches)
+{
+    long long check = 0;
+    for (const auto& batch : batches)
+    {
+        StaticArray<T, N> copy = batch;
+        sortStatic(copy);
+        check += weigh(copy);
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+template <typename T, int N>
+int insert_sort(const std::vector<StaticArray<T, N>>& batches)
+{
+    long long check = 0;
+    for (const auto& batch : batches)
+    {
+        StaticArray<T, N> copy = batch;
+        insertSort(copy.begin(), copy.end());
+        check += weigh(copy);
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+template <typename T, int N>
+int std_sort(const std::vector<StaticArray<T, N>>& batches)
+{
+    long long check = 0;
+    for (const auto& batch : batches)
+    {
+        StaticArray<T, N> copy = batch;
+        std::sort(copy.begin(), copy.end());
+        check += weigh(copy);
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+// Merge every batch, sorted, with the next one
+template <int N>
+int merge_network(const std::vector<StaticArray<int, N>>& sorted)
+{
+    long long check = 0;
+    for (int i = 0; i + 1 < BATCHES; i++)
+    {
+        const auto merged = mergeElements<int, N, N>(sorted[i], sorted[i + 1]);
+        check += weigh(merged);
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+// The branchy merge loop mergeElements uses past SORTING_NETWORK_MAX_SIZE elements
+template <int N>
+int merge_loop(const std::vector<StaticArray<int, N>>& sorted)
+{
+    long long check = 0;
+    for (int i = 0; i + 1 < BATCHES; i++)
+    {
+        StaticArray<int, 2 * N> merged;
+        std::merge(sorted[i].begin(), sorted[i].end(), sorted[i + 1].begin(), sorted[i + 1].end(), merged.begin());
+        check += weigh(merged);
+    }
+    return static_cast<int>(check % 1'000'000'007);
+}
+
+int quick_sort(DynamicArray<int>& array)
+{
+    quickSort(array.begin(), array.end());
+    return array[array.getSize() / 2];
+}
+
+template <int N>
+void run(std::mt19937& rng)
+{
+    const auto batches = make_batches<int, N>(rng);
+    const std::string suffix = ", " + std::to_string(BATCHES) + " batches of " + std::to_string(N) + " ints";
+    benchmark_function("sortStatic" + suffix, sort_static<int, N>, batches);
+    benchmark_function("insertSort" + suffix, insert_sort<int, N>, batches);
+    benchmark_function("std::sort" + suffix, std_sort<int, N>, batches);
+
+    const auto floats = make_batches<float, N>(rng);
+    const std::string floatSuffix = ", " + std::to_string(BATCHES) + " batches of " + std::to_string(N) + " floats";
+    benchmark_function("sortStatic" + floatSuffix, sort_static<float, N>, floats);
+    benchmark_function("insertSort" + floatSuffix, insert_sort<float, N>, floats);
+}
+
+template <int N>
+void run_merge(std::mt19937& rng)
+{
+    auto sorted = make_batches<int, N>(rng);
+    for (auto& batch : sorted)
+    {
+        std::sort(batch.begin(), batch.end());
+    }
+    const std::string suffix = ", " + std::to_string(BATCHES) + " pairs of " + std::to_string(N) + " ints";
+    benchmark_function("mergeElements network" + suffix, merge_network<N>, sorted);
+    benchmark_function("std::merge loop" + suffix, merge_loop<N>, sorted);
+}
+
+int main()
+{
+    std::mt19937 rng(42);
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        run<4>(rng);
+        run<8>(rng);
+        run<16>(rng);
+        run<32>(rng);
+        run_merge<4>(rng);
+        run_merge<8>(rng);
+        run_merge<16>(rng);
+
+        DynamicArray<int> array(BATCHES);
+        for (int i = 0; i < BATCHES; i++)
+        {
+            array.append(static_cast<int>(rng() % 1'000'000'000));
+        }
+        benchmark_function("quickSort, 1000000 ints", quick_sort, array);
+    }
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <benchmarking.hpp>
+#include <chrono>
+#include <mutex>
+#include <queue.hpp>
+#include <spsc-queue.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr int CAPACITY = 4096;
+constexpr int BATCH = 64;
+
+// Today's approach: a Queue shared under a mutex, the consumer retries while it is empty
+int mutex_queue(int count)
+{
+    Queue<int> queue;
+    std::mutex mutex;
+    std::thread producer(
+        [&]
+        {
+            for (int i = 0; i < count; i++)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push(i);
+            }
+        });
+
+    long long sum = 0;
+    for (int received = 0; received < count;)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (queue.isEmpty())
+        {
+            lock.unlock();
+            std::this_thread::yield();
+            continue;
+        }
+        sum += queue.front();
+        queue.pop();
+        received++;
+    }
+    producer.join();
+    return static_cast<int>(sum % 1'000'000'007);
+}
+
+// One element per operation
+int spsc_queue(int count)
+{
+    SpscQueue<int> queue(CAPACITY);
+    std::thread producer(
+        [&]
+        {
+            for (int i = 0; i < count; i++)
+            {
+                queue.push(i);
+            }
+        });
+
+    long long sum = 0;
+    int value = 0;
+    for (int received = 0; received < count;)
+    {
+        if (queue.tryPop(value))
+        {
+            sum += value;
+            received++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    return static_cast<int>(sum % 1'000'000'007);
+}
+
+// BATCH elements per operation, one publication each
+int spsc_queue_batches(int count)
+{
+    SpscQueue<int> queue(CAPACITY);
+    std::thread producer(
+        [&]
+        {
+            int batch[BATCH];
+            for (int next = 0; next < count;)
+            {
+                const int size = std::min(BATCH, count - next);
+                for (int i = 0; i < size; i++)
+                {
+                    batch[i] = next + i;
+                }
+                for (int pushed = 0; pushed < size;)
+                {
+                    const int done = queue.tryPushN(batch + pushed, size - pushed);
+                    if (done == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    pushed += done;
+                }
+                next += size;
+            }
+        });
+
+    long long sum = 0;
+    int batch[BATCH];
+    for (int received = 0; received < count;)
+    {
+        const int popped = queue.tryPopN(batch, BATCH);
+        if (popped == 0)
+        {
+            std::this_thread::yield();
+        }
+        for (int i = 0; i < popped; i++)
+        {
+            sum += batch[i];
+        }
+        received += popped;
+    }
+    producer.join();
+    return static_cast<int>(sum % 1'000'000'007);
+}
+
+long long now_nanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// One element in flight at a time: the handoff time is from the push to the pop of its timestamp
+int spsc_handoff_latency(int samples)
+{
+    SpscQueue<long long> queue(CAPACITY);
+    std::thread producer(
+        [&]
+        {
+            for (int i = 0; i < samples; i++)
+            {
+                queue.push(now_nanoseconds());
+                while (!queue.isEmpty())
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+    std::vector<long long> latencies;
+    latencies.reserve(samples);
+    long long stamp = 0;
+    while (static_cast<int>(latencies.size()) < samples)
+    {
+        if (queue.tryPop(stamp))
+        {
+            latencies.push_back(now_nanoseconds() - stamp);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    const long long p50 = latencies[latencies.size() / 2];
+    const long long p99 = latencies[latencies.size() * 99 / 100];
+    std::cout << "    handoff p50: " << p50 << " ns, p99: " << p99 << " ns\n";
+    return static_cast<int>(p99);
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 50'000'000;
+    std::cout << "Handing off " << count << " ints, hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        benchmark_function("mutex + Queue", mutex_queue, count);
+        benchmark_function("SpscQueue", spsc_queue, count);
+        benchmark_function("SpscQueue, batches of " + std::to_string(BATCH), spsc_queue_batches, count);
+        benchmark_function("SpscQueue handoff latency, 100000 samples", spsc_handoff_latency, 100'000);
+    }
+
+    return 0;
+}
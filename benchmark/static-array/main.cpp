@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <benchmarking.hpp>
+#include <memory>
+#include <numeric>
+#include <static-array.hpp>
+#include <string>
+#include <vector>
+
+// Every operation touches about 256M elements, whatever the size of the array
+constexpr long long ELEMENTS_PER_OPERATION = 1LL << 28;
+
+template <typename T, int size>
+using AlignedArray = StaticArray<T, size, DefaultAccess, SIMD_ALIGNMENT>;
+
+template <typename T, int size>
+int array_fill(AlignedArray<T, size>& array)
+{
+    long long check = 0;
+    for (long long rep = 0; rep < ELEMENTS_PER_OPERATION / size; rep++)
+    {
+        array.fill(T(rep % 100));
+        check += static_cast<long long>(array[static_cast<int>(rep % size)]);
+    }
+    return static_cast<int>(check);
+}
+
+template <typename T>
+int vector_fill(std::vector<T>& vector)
+{
+    const long long size = static_cast<long long>(vector.size());
+    long long check = 0;
+    for (long long rep = 0; rep < ELEMENTS_PER_OPERATION / size; rep++)
+    {
+        std::fill(vector.begin(), vector.end(), T(rep % 100));
+        check += static_cast<long long>(vector[rep % size]);
+    }
+    return static_cast<int>(check);
+}
+
+template <typename T, int size>
+int array_equal(AlignedArray<T, size>& array, AlignedArray<T, size>& other)
+{
+    int equal = 0;
+    for (long long rep = 0; rep < ELEMENTS_PER_OPERATION / size; rep++)
+    {
+        other[size - 1] = T(rep % 2);  // Differ in the last element every other time
+        equal += array == other ? 1 : 0;
+    }
+    return equal;
+}
+
+template <typename T>
+int vector_equal(std::vector<T>& vector, std::vector<T>& other)
+{
+    const long long size = static_cast<long long>(vector.size());
+    int equal = 0;
+    for (long long rep = 0; rep < ELEMENTS_PER_OPERATION / size; rep++)
+    {
+        other.back() = T(rep % 2);
+        equal += std::equal(vector.begin(), vector.end(), other.begin()) ? 1 : 0;
+    }
+    return equal;
+}
+
+template <typename T, int size>
+int array_reduce(AlignedArray<T, size>& array)
+{
+    double check = 0;
+    for (long long rep = 0; rep < ELEMENTS_PER_OPERATION / size; rep++)
+    {
+        array[static_cast<int>(rep % size)] = T(rep % 7);
+        check += static_cast<double>(array.sum()) + static_cast<double>(array.min() + array.max());
+    }
+    return static_cast<int>(static_cast<long long>(check) % 1'000'000'007);
+}
+
+template <typename T>
+int vector_reduce(std::vector<T>& vector)
+{
+    const long long size = static_cast<long long>(vector.size());
+    double check = 0;
+    for (long long rep = 0; rep < ELEMENTS_PER_OPERATION / size; rep++)
+    {
+        vector[rep % size] = T(rep % 7);
+        const auto [min, max] = std::minmax_element(vector.begin(), vector.end());
+        check += static_cast<double>(std::accumulate(vector.begin(), vector.end(), T{})) +
+                 static_cast<double>(*min + *max);
+    }
+    return static_cast<int>(static_cast<long long>(check) % 1'000'000'007);
+}
+
+template <typename T, int size>
+int array_transform(AlignedArray<T, size>& array, const AlignedArray<T, size>& other)
+{
+    for (long long rep = 0; rep < ELEMENTS_PER_OPERATION / size; rep++)
+    {
+        array.transform(other, [](T value, T operand) { return T(value * 3 + operand); });
+    }
+    return static_cast<int>(array[size / 2]);
+}
+
+template <typename T>
+int vector_transform(std::vector<T>& vector, const std::vector<T>& other)
+{
+    const long long size = static_cast<long long>(vector.size());
+    for (long long rep = 0; rep < ELEMENTS_PER_OPERATION / size; rep++)
+    {
+        std::transform(vector.begin(), vector.end(), other.begin(), vector.begin(),
+                       [](T value, T operand) { return T(value * 3 + operand); });
+    }
+    return static_cast<int>(vector[size / 2]);
+}
+
+template <typename T, int size>
+void run(const std::string& type)
+{
+    // Heap allocated, a 1M element array does not fit on the stack
+    auto array = std::make_unique<AlignedArray<T, size>>();
+    auto other = std::make_unique<AlignedArray<T, size>>();
+    std::vector<T> vector(size);
+    std::vector<T> otherVector(size);
+    for (int i = 0; i < size; i++)
+    {
+        (*array)[i] = (*other)[i] = vector[i] = otherVector[i] = T(i % 10);
+    }
+
+    const std::string suffix = ", " + type + " x " + std::to_string(size);
+    benchmark_function("StaticArray::fill" + suffix, array_fill<T, size>, *array);
+    benchmark_function("std::fill vector" + suffix, vector_fill<T>, vector);
+
+    array->fill(T(1));
+    other->fill(T(1));
+    std::fill(vector.begin(), vector.end(), T(1));
+    std::fill(otherVector.begin(), otherVector.end(), T(1));
+    benchmark_function("StaticArray::operator==" + suffix, array_equal<T, size>, *array, *other);
+    benchmark_function("std::equal vector" + suffix, vector_equal<T>, vector, otherVector);
+
+    benchmark_function("StaticArray::sum+min+max" + suffix, array_reduce<T, size>, *array);
+    benchmark_function("std::accumulate+minmax_element" + suffix, vector_reduce<T>, vector);
+
+    benchmark_function("StaticArray::transform" + suffix, array_transform<T, size>, *array, *other);
+    benchmark_function("std::transform vector" + suffix, vector_transform<T>, vector, otherVector);
+}
+
+int main()
+{
+#if DSA_SIMD_WIDTH == 32
+    std::cout << "Vector kernels: AVX2\n";
+#elif DSA_SIMD_WIDTH == 16
+    std::cout << "Vector kernels: SSE2\n";
+#else
+    std::cout << "Vector kernels: none\n";
+#endif
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        run<float, 4096>("float");
+        run<float, 65536>("float");
+        run<float, 1 << 20>("float");
+        run<int, 4096>("int");
+        run<int, 65536>("int");
+        run<int, 1 << 20>("int");
+    }
+
+    return 0;
+}
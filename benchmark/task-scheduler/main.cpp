@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <benchmarking.hpp>
+#include <divide-and-conquer.hpp>
+#include <parallel-sort.hpp>
+#include <quick-sort.hpp>
+#include <random>
+#include <string>
+#include <task-scheduler.hpp>
+#include <thread>
+#include <vector>
+
+// Weigh a sample of the elements by their position, so that the whole order is needed
+int weigh(const std::vector<int>& data)
+{
+    long long weight = 0;
+    for (std::size_t i = 0; i < data.size(); i += 997)
+    {
+        weight = (weight + static_cast<long long>(data[i]) * static_cast<long long>(i + 1)) % 1'000'000'007;
+    }
+    return static_cast<int>(weight);
+}
+
+// Every sort works on a copy, so that each one sees unsorted data
+int quick_sort(const std::vector<int>& data)
+{
+    std::vector<int> copy = data;
+    quickSort(copy.begin(), copy.end());
+    return weigh(copy);
+}
+
+int parallel_quick_sort(TaskScheduler& scheduler, const std::vector<int>& data)
+{
+    std::vector<int> copy = data;
+    parallelQuickSort(scheduler, copy.begin(), copy.end());
+    return weigh(copy);
+}
+
+int merge_k_sort(const std::vector<std::vector<int>>& vectors)
+{
+    return weigh(*mergeKSort<true>(vectors));
+}
+
+int parallel_merge_k_sort(TaskScheduler& scheduler, const std::vector<std::vector<int>>& vectors)
+{
+    return weigh(*parallelMergeKSort(scheduler, vectors));
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = argc > 1 ? std::stoi(argv[1]) : 10'000'000;
+    const int lists = argc > 2 ? std::stoi(argv[2]) : 1024;
+    const int hardwareThreads = TaskScheduler::getDefaultWorkerCount();
+    std::cout << "Sorting " << count << " ints, merging " << lists << " sorted lists of the same total size"
+              << ", hardware threads: " << hardwareThreads << "\n";
+
+    std::mt19937 rng(42);
+    std::vector<int> data(count);
+    for (int& value : data)
+    {
+        value = static_cast<int>(rng() % 1'000'000'000);
+    }
+    std::vector<std::vector<int>> vectors(lists);
+    for (int i = 0; i < count; i++)
+    {
+        vectors[i % lists].push_back(data[i]);
+    }
+    for (std::vector<int>& vector : vectors)
+    {
+        std::sort(vector.begin(), vector.end());
+    }
+
+    // Up to the hardware threads, and at least 8 workers to show oversubscription on small machines
+    std::vector<int> workerCounts;
+    for (int workers = 1; workers <= std::max(hardwareThreads, 8); workers *= 2)
+    {
+        workerCounts.push_back(workers);
+    }
+    if (workerCounts.back() != hardwareThreads && hardwareThreads > 8)
+    {
+        workerCounts.push_back(hardwareThreads);
+    }
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << "\n";
+        benchmark_function("quickSort", quick_sort, data);
+        benchmark_function("mergeKSort<true>", merge_k_sort, vectors);
+        for (int workers : workerCounts)
+        {
+            TaskScheduler scheduler(workers);
+            const std::string suffix = ", " + std::to_string(workers) + " workers";
+            benchmark_function("parallelQuickSort" + suffix, parallel_quick_sort, scheduler, data);
+            benchmark_function("parallelMergeKSort" + suffix, parallel_merge_k_sort, scheduler, vectors);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <benchmarking.hpp>
+#include <dynamic-array.hpp>
+#include <list.hpp>
+#include <string>
+#include <unrolled-list.hpp>
+
+// The same workloads on the three sequence containers: a sequential scan, inserts and erases at random positions
+// (each one has to find its position first), and a mix of both.
+
+unsigned nextRandom(unsigned& state)
+{
+    state = state * 1103515245 + 12345;
+    return state >> 8;
+}
+
+template <typename Container>
+Container build(int n)
+{
+    Container container;
+    for (int i = 0; i < n; i++)
+    {
+        container.append(i);
+    }
+    return container;
+}
+
+template <typename Container>
+long long sum(const Container& container)
+{
+    long long total = 0;
+    for (const int value : container)
+    {
+        total += value;
+    }
+    return total;
+}
+
+template <typename Container>
+int scan(int n, int rounds)
+{
+    Container container = build<Container>(n);
+    long long total = 0;
+    for (int round = 0; round < rounds; round++)
+    {
+        *container.begin() = round;  // Keeps the compiler from reusing the sum of the previous round
+        total += sum(container);
+    }
+    return static_cast<int>(total % 1'000'000);
+}
+
+template <typename Container>
+int insert_erase(int n, int operations)
+{
+    Container container = build<Container>(n);
+    unsigned state = 42;
+    for (int i = 0; i < operations; i++)
+    {
+        container.insert(i, static_cast<int>(nextRandom(state) % (container.getSize() + 1)));
+        container.erase(static_cast<int>(nextRandom(state) % container.getSize()));
+    }
+    return container.getSize();
+}
+
+// One scan every 100 updates, like an index that is read far more than it is modified
+template <typename Container>
+int mixed(int n, int operations)
+{
+    Container container = build<Container>(n);
+    unsigned state = 42;
+    long long total = 0;
+    for (int i = 0; i < operations; i++)
+    {
+        if (i % 100 == 0)
+        {
+            total += sum(container);
+        }
+        container.insert(i, static_cast<int>(nextRandom(state) % (container.getSize() + 1)));
+        container.erase(static_cast<int>(nextRandom(state) % container.getSize()));
+    }
+    return static_cast<int>(total % 1'000'000);
+}
+
+int main(int argc, char* argv[])
+{
+    const int n = argc > 1 ? std::stoi(argv[1]) : 100'000;
+
+    for (int round = 1; round <= 2; round++)
+    {
+        std::cout << "Round " << round << ": " << n << " elements\n";
+
+        benchmark_function("Scan x1000 List", scan<List<int>>, n, 1000);
+        benchmark_function("Scan x1000 UnrolledList", scan<UnrolledList<int>>, n, 1000);
+        benchmark_function("Scan x1000 DynamicArray", scan<DynamicArray<int>>, n, 1000);
+
+        benchmark_function("Insert/erase x10000 List", insert_erase<List<int>>, n, 10'000);
+        benchmark_function("Insert/erase x10000 UnrolledList", insert_erase<UnrolledList<int>>, n, 10'000);
+        benchmark_function("Insert/erase x10000 DynamicArray", insert_erase<DynamicArray<int>>, n, 10'000);
+
+        benchmark_function("Mixed x10000 List", mixed<List<int>>, n, 10'000);
+        benchmark_function("Mixed x10000 UnrolledList", mixed<UnrolledList<int>>, n, 10'000);
+        benchmark_function("Mixed x10000 DynamicArray", mixed<DynamicArray<int>>, n, 10'000);
+    }
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <unordered_map>
+#include <iterator>
+#include <unordered_set>
 #include <useful-concepts.hpp>
 
 /**
@@ -8,8 +9,9 @@
  *
  * This function iterates through the given container and removes any duplicate elements, ensuring
  * that only the first occurrence of each value is kept. The container must support custom begin
- * and end iterators as well as a method to get its size. The erase operation may cause elements to shift
- * in dynamic containers such as vectors or arrays.
+ * and end iterators as well as a method to get its size. Containers that provide `removeIf` (such as
+ * DynamicArray) are compacted in a single pass, containers that erase through an iterator (such as List) unlink
+ * each duplicate as they go; other containers erase each duplicate by its position.
  *
  * @tparam T The type of the container, which must satisfy the requirements:
  *           - HasCustomBeginEnd<T>: The container provides custom begin and end iterators.
@@ -17,20 +19,19 @@
  *
  * @param container The container from which duplicate elements will be removed.
  *
- * @note This function uses an unordered map to track seen elements and removes duplicates in linear time,
- *       making it efficient for containers that support fast `erase` operations. However, for dynamic arrays
- *       or vectors, the `erase` operation might trigger shifting of elements, which could impact performance.
+ * @note This function uses an unordered set to track seen elements. For containers with `removeIf`, the
+ *       kept elements are shifted at most once each, so dynamic arrays are deduplicated in linear time.
  *
  * ### Time Complexity
  * - **Worst-case:** O(n), where `n` is the size of the container. Each element is visited once, and
- *   the insertion and lookup operations in the unordered map are on average O(1).
- * - **Note:** If the container involves shifting elements during `erase`, the overall time complexity could
- *   degrade to O(n^2) in the worst case for dynamic arrays/vectors, where n is the number of elements.
+ *   the insertion and lookup operations in the unordered set are on average O(1).
+ * - **Note:** Containers with neither `removeIf` nor iterator `erase` degrade to O(n^2) in the worst case, their
+ *   `erase` either shifts elements or walks to the position.
  *
  * ### Space Complexity
- * - **Worst-case:** O(n), where `n` is the size of the container, as the unordered map stores
+ * - **Worst-case:** O(n), where `n` is the size of the container, as the unordered set stores
  *   all unique elements from the container.
- * - **Best-case:** O(n), if all elements are unique, as the unordered map will store each element.
+ * - **Best-case:** O(n), if all elements are unique, as the unordered set will store each element.
  */
 template <typename T>
 void deleteDuplicates(T& container) requires HasCustomBeginEnd<T>&& HasGetSize<T>
@@ -40,22 +41,34 @@ void deleteDuplicates(T& container) requires HasCustomBeginEnd<T>&& HasGetSize<T
         return;
     }
 
-    std::unordered_map<typename T::value_type, bool> seen;
+    std::unordered_set<typename T::value_type> seen;
 
-    auto it = container.begin();
-    ssize_t pos = 0;
-    while (it != container.end())
+    if constexpr (HasRemoveIf<T>)
     {
-        const typename T::value_type& value = *it;
-        if (seen[value])
+        container.removeIf([&seen](const typename T::value_type& value) { return !seen.insert(value).second; });
+    }
+    else if constexpr (HasIteratorErase<T>)
+    {
+        for (auto it = container.begin(); it != container.end();)
         {
-            it = container.erase(pos);
+            it = seen.insert(*it).second ? std::next(it) : container.erase(it);
         }
-        else
+    }
+    else
+    {
+        auto it = container.begin();
+        ssize_t pos = 0;
+        while (it != container.end())
         {
-            seen[value] = true;
-            it++;
-            pos++;
+            if (!seen.insert(*it).second)
+            {
+                it = container.erase(pos);
+            }
+            else
+            {
+                it++;
+                pos++;
+            }
         }
     }
 }
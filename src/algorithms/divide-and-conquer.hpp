@@ -68,6 +68,37 @@ std::optional<int> binarySearch(const std::vector<int>& data, int target)
     return recursiveSearch(0, static_cast<int>(data.size()) - 1);
 }
 
+/**
+ * @brief Merges two sorted integer vectors into a new sorted vector (the combine step of mergeKSort()).
+ *
+ * @complexity O(n + m) time and space for vectors of n and m elements.
+ */
+inline std::vector<int> mergeTwoSorted(const std::vector<int>& v1, const std::vector<int>& v2)
+{
+    std::vector<int> result;
+    result.reserve(v1.size() + v2.size());
+    size_t i = 0, j = 0;
+
+    while (i < v1.size() && j < v2.size())
+    {
+        if (v1[i] < v2[j])
+        {
+            result.push_back(v1[i++]);
+        }
+        else
+        {
+            result.push_back(v2[j++]);
+        }
+    }
+
+    while (i < v1.size())
+        result.push_back(v1[i++]);
+    while (j < v2.size())
+        result.push_back(v2[j++]);
+
+    return result;
+}
+
 /**
  * @brief Merges K sorted integer vectors into a single sorted vector.
  *
@@ -95,31 +126,6 @@ std::optional<std::vector<int>> mergeKSort(const std::vector<std::vector<int>>&
         return vectors[0];
     }
 
-    // Helper function to merge two sorted vectors
-    static auto mergeTwo = [](const std::vector<int>& v1, const std::vector<int>& v2) -> std::vector<int> {
-        std::vector<int> result;
-        size_t i = 0, j = 0;
-
-        while (i < v1.size() && j < v2.size())
-        {
-            if (v1[i] < v2[j])
-            {
-                result.push_back(v1[i++]);
-            }
-            else
-            {
-                result.push_back(v2[j++]);
-            }
-        }
-
-        while (i < v1.size())
-            result.push_back(v1[i++]);
-        while (j < v2.size())
-            result.push_back(v2[j++]);
-
-        return result;
-    };
-
     if constexpr (!RECURSIVE_MODE)
     {
         std::vector<std::vector<int>> current = vectors;
@@ -129,7 +135,7 @@ std::optional<std::vector<int>> mergeKSort(const std::vector<std::vector<int>>&
             std::vector<std::vector<int>> next;
             for (size_t i = 0; i + 1 < current.size(); i += 2)
             {
-                next.push_back(mergeTwo(current[i], current[i + 1]));
+                next.push_back(mergeTwoSorted(current[i], current[i + 1]));
             }
             if (current.size() % 2 == 1)
             {
@@ -151,7 +157,7 @@ std::optional<std::vector<int>> mergeKSort(const std::vector<std::vector<int>>&
             int mid = (left + right) / 2;
             std::vector<int> leftMerged = recursiveMerge(left, mid);
             std::vector<int> rightMerged = recursiveMerge(mid + 1, right);
-            return mergeTwo(leftMerged, rightMerged);
+            return mergeTwoSorted(leftMerged, rightMerged);
         };
 
         return recursiveMerge(0, vectors.size() - 1);
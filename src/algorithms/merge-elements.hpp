@@ -1,6 +1,7 @@
 #pragma once
 
 #include <useful-concepts.hpp>
+#include <sorting-network.hpp>
 #include <static-array.hpp>
 
 /**
@@ -72,7 +73,8 @@ template <typename T>
  * @brief Specialization of mergeElements for StaticArray.
  *
  * This specialization merges two StaticArrays into a new StaticArray in sorted order.
- * It is optimized for StaticArray types that have known sizes at compile time.
+ * It is optimized for StaticArray types that have known sizes at compile time: up to SORTING_NETWORK_MAX_SIZE
+ * elements in total, the arrays are merged by a merging network generated for their sizes, without branches.
  *
  * @tparam T The type of elements in the StaticArray.
  * @tparam N1 The size of the first StaticArray.
@@ -93,6 +95,11 @@ template <typename T, size_t N1, size_t N2>
     const StaticArray<T, N1>& staticArray1, const StaticArray<T, N2>& staticArray2)
 {
     StaticArray<T, N1 + N2> result;
+    if constexpr (N1 + N2 <= SORTING_NETWORK_MAX_SIZE)
+    {
+        mergeNetwork<N1, N2>(staticArray1.begin(), staticArray2.begin(), result.begin());
+        return result;
+    }
 
     auto i = staticArray1.begin();
     auto j = staticArray2.begin();
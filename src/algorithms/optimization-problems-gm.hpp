@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <cassert>
 #include <graph.hpp>
+#include <indexed-heap.hpp>
 #include <limits>
 
 /*
@@ -244,6 +245,59 @@ AdjacencyMatrix primsMethod(const AdjacencyMatrix& graph)
     return result;
 }
 
+/**
+ * @brief Computes the Minimum Spanning Tree (MST) of a weighted undirected graph using Prim's algorithm with an
+ * indexed heap.
+ *
+ * Every vertex outside the tree is in the heap with the weight of its lightest edge to the tree, and the vertex on top
+ * joins the tree next. When a vertex joins, the keys of its neighbors decrease in place, so the heap never holds more
+ * than one entry per vertex. This replaces the scan over all vertices of the adjacency matrix version by a heap
+ * operation, for sparse graphs of any size.
+ *
+ * @param graph The input graph as a weighted adjacency list: graph[u] holds (v, weight) for each edge, listed in both
+ *              directions.
+ * @return WeightedEdgeList The edges (parent, vertex, weight) of the MST of the component of vertex 0, in the order
+ *         they joined the tree; empty if the graph is empty.
+ *
+ * @complexity Time: O((V + E) log V). Space: O(V).
+ */
+inline WeightedEdgeList primsMethod(const WeightAdjacencyList& graph)
+{
+    WeightedEdgeList result;
+    const int numVertices = static_cast<int>(graph.size());
+    if (numVertices == 0)
+    {
+        return result;
+    }
+
+    std::vector<int> parent(numVertices, -1);
+    std::vector<bool> inMST(numVertices, false);
+    IndexedHeap<int> heap(numVertices);
+    heap.push(0, 0);
+
+    while (!heap.isEmpty())
+    {
+        const int u = heap.topId();
+        const int weight = heap.topKey();
+        heap.pop();
+        inMST[u] = true;
+        if (parent[u] >= 0)
+        {
+            result.emplace_back(parent[u], u, weight);
+        }
+
+        for (const auto& [v, edgeWeight] : graph[u])
+        {
+            if (!inMST[v] && heap.pushOrDecreaseKey(v, edgeWeight))
+            {
+                parent[v] = u;
+            }
+        }
+    }
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////
 
 ////////////////////// Single Source Shortest Path (Dijkstra) ////////////////////////////
@@ -305,4 +359,55 @@ std::vector<int> dijkstraMethod(const AdjacencyMatrix& graph, int source)
     return distances;
 }
 
+/**
+ * @brief Computes the shortest distances from a source vertex using Dijkstra's algorithm with an indexed heap.
+ *
+ * The vertices reached but not settled are in the heap with their tentative distance, and the vertex on top is the
+ * next one settled. A shorter path to a vertex decreases its key in place, so the heap holds at most one entry per
+ * vertex. This replaces the scan over all vertices of the adjacency matrix version by a heap operation, for sparse
+ * graphs of any size.
+ *
+ * @param graph The input graph as a weighted adjacency list: graph[u] holds (v, weight) for each edge from u, with
+ *              non-negative weights.
+ * @param source The vertex the distances are measured from.
+ * @return std::vector<int> The distance of every vertex, std::numeric_limits<int>::max() if unreachable; empty if the
+ *         graph is empty or the source is out of range.
+ *
+ * @complexity Time: O((V + E) log V). Space: O(V).
+ */
+inline std::vector<int> dijkstraMethod(const WeightAdjacencyList& graph, int source)
+{
+    const int INF{std::numeric_limits<int>::max()};
+
+    if (graph.empty() || source < 0 || source >= static_cast<int>(graph.size()))
+    {
+        return {};
+    }
+
+    std::vector<int> distances(graph.size(), INF);
+    std::vector<bool> settled(graph.size(), false);
+    IndexedHeap<int> heap(static_cast<int>(graph.size()));
+    distances[source] = 0;
+    heap.push(source, 0);
+
+    while (!heap.isEmpty())
+    {
+        const int u = heap.topId();
+        heap.pop();
+        settled[u] = true;
+
+        for (const auto& [v, weight] : graph[u])
+        {
+            const int newDistance = distances[u] + weight;
+            if (!settled[v] && newDistance < distances[v])
+            {
+                distances[v] = newDistance;
+                heap.pushOrDecreaseKey(v, newDistance);
+            }
+        }
+    }
+
+    return distances;
+}
+
 ///////////////////////////////////////////////////////////
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <divide-and-conquer.hpp>
+#include <functional>  // for std::function
+#include <iterator>  // for std::random_access_iterator, std::next
+#include <optional>
+#include <quick-sort.hpp>
+#include <task-scheduler.hpp>
+#include <vector>
+
+/**
+ * @brief parallelQuickSort() sorts partitions of at most this many elements with quickSort(), without spawning tasks.
+ */
+inline constexpr int PARALLEL_QUICK_SORT_CUTOFF = 4096;
+
+/**
+ * @brief Partitions [begin, end) down to PARALLEL_QUICK_SORT_CUTOFF elements, spawning the lower partitions.
+ */
+template <std::random_access_iterator Iterator>
+void parallelQuickSortSplit(TaskGroup& group, Iterator begin, Iterator end)
+{
+    while (end - begin > PARALLEL_QUICK_SORT_CUTOFF)
+    {
+        Iterator pivot = quickSortPartition(begin, end);
+        group.spawn([&group, begin, pivot] { parallelQuickSortSplit(group, begin, pivot); });
+        begin = std::next(pivot);
+    }
+    quickSort(begin, end);
+}
+
+/**
+ * @brief Sorts a range of elements using the QuickSort algorithm on the workers of a scheduler.
+ *
+ * Each partitioning step spawns the sort of the lower partition as a task and goes on with the upper one, down to
+ * PARALLEL_QUICK_SORT_CUTOFF elements, then sorts with quickSort(). The partitions are disjoint, so the tasks need no
+ * synchronization beyond the final join. The result is the one of quickSort().
+ *
+ * @tparam Iterator Random access iterator type.
+ * @param scheduler The scheduler running the tasks.
+ * @param begin Iterator pointing to the beginning of the range.
+ * @param end Iterator pointing to one past the last element of the range.
+ *
+ * @note The first partitioning step runs on one worker, so the speedup is bounded by about log n on p workers when
+ * n is large: O(n) of the O(n log n) work is sequential.
+ * @complexity Time: O(n log n / p + n) average on p workers, O(n^2) worst. Space: O(log n) stack and tasks.
+ */
+template <std::random_access_iterator Iterator>
+void parallelQuickSort(TaskScheduler& scheduler, Iterator begin, Iterator end)
+{
+    scheduler.run(
+        [&]
+        {
+            TaskGroup group(scheduler);
+            parallelQuickSortSplit(group, begin, end);
+            group.sync();
+        });
+}
+
+/**
+ * @brief Merges K sorted integer vectors into a single sorted vector on the workers of a scheduler.
+ *
+ * The recursive divide-and-conquer of mergeKSort<true>(), where each split spawns the merge of the left half as a task,
+ * merges the right half and syncs before combining both.
+ *
+ * @param scheduler The scheduler running the tasks.
+ * @param vectors A vector of sorted integer vectors to be merged.
+ * @return std::optional<std::vector<int>> A single merged and sorted vector if input is non-empty;
+ *         std::nullopt otherwise.
+ *
+ * @note Time complexity: O(N log K / p + N) on p workers: the last merge, of all N elements, runs on one worker.
+ *       Space complexity: O(N) for the output vector and temporary merged results.
+ */
+inline std::optional<std::vector<int>> parallelMergeKSort(
+    TaskScheduler& scheduler, const std::vector<std::vector<int>>& vectors)
+{
+    if (vectors.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::function<std::vector<int>(int, int)> recursiveMerge = [&](int left, int right) -> std::vector<int> {
+        if (left == right)
+        {
+            return vectors[left];
+        }
+
+        int mid = (left + right) / 2;
+        std::vector<int> leftMerged;
+        TaskGroup group(scheduler);
+        group.spawn([&] { leftMerged = recursiveMerge(left, mid); });
+        std::vector<int> rightMerged = recursiveMerge(mid + 1, right);
+        group.sync();
+        return mergeTwoSorted(leftMerged, rightMerged);
+    };
+
+    return scheduler.run([&] { return recursiveMerge(0, static_cast<int>(vectors.size()) - 1); });
+}
@@ -1,23 +1,22 @@
 #pragma once
 
+#include <iterator>  // for std::random_access_iterator
+#include <sorting-network.hpp>
+
 /**
- * @brief Sorts a range of elements using the QuickSort algorithm.
- *
- * @tparam Iterator Random access iterator type.
- * @param begin Iterator pointing to the beginning of the range.
- * @param end Iterator pointing to one past the last element of the range.
+ * @brief Partitions of at most this many elements are sorted by a sorting network (random access ranges only).
+ */
+inline constexpr int QUICK_SORT_NETWORK_SIZE = 16;
+
+/**
+ * @brief Partitions a range of at least 2 elements around its first element (the step of quickSort()).
  *
- * @note This version uses Lomuto partitioning and is not stable.
- * @complexity Time: O(n log n) average, O(n^2) worst (if elements are already sorted). Space: O(log n) recursion stack.
+ * @return Iterator to the pivot, in its sorted position: the elements before it are not greater, the elements after it
+ * are greater.
  */
 template <typename Iterator>
-void quickSort(Iterator begin, Iterator end)
+Iterator quickSortPartition(Iterator begin, Iterator end)
 {
-    if (begin == end || std::next(begin) == end)  // 0 or 1 element
-    {
-        return;
-    }
-
     // Choose pivot as first element
     auto pivotValue = *begin;
 
@@ -46,8 +45,39 @@ void quickSort(Iterator begin, Iterator end)
 
     // Place pivot in its correct position
     std::swap(*begin, *right);
+    return right;
+}
+
+/**
+ * @brief Sorts a range of elements using the QuickSort algorithm.
+ *
+ * @tparam Iterator Random access iterator type.
+ * @param begin Iterator pointing to the beginning of the range.
+ * @param end Iterator pointing to one past the last element of the range.
+ *
+ * @note This version uses Lomuto partitioning and is not stable. Random access partitions of at most
+ * QUICK_SORT_NETWORK_SIZE elements are sorted by the branch-free sorting network of their size.
+ * @complexity Time: O(n log n) average, O(n^2) worst (if elements are already sorted). Space: O(log n) recursion stack.
+ */
+template <typename Iterator>
+void quickSort(Iterator begin, Iterator end)
+{
+    if constexpr (std::random_access_iterator<Iterator>)
+    {
+        if (end - begin <= QUICK_SORT_NETWORK_SIZE)
+        {
+            sortNetworkRange<QUICK_SORT_NETWORK_SIZE>(begin, end);
+            return;
+        }
+    }
+    if (begin == end || std::next(begin) == end)  // 0 or 1 element
+    {
+        return;
+    }
+
+    Iterator pivot = quickSortPartition(begin, end);
 
     // Recursively sort the partitions
-    quickSort(begin, right);
-    quickSort(std::next(right), end);
+    quickSort(begin, pivot);
+    quickSort(std::next(pivot), end);
 }
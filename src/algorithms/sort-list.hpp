@@ -0,0 +1,29 @@
+#pragma once
+
+#include <functional>
+#include <useful-concepts.hpp>
+
+/**
+ * @brief Sorts a linked list by relinking its nodes, with the merge sort of the container.
+ *
+ * The iterator based sorts (quickSort, insertSort, ...) swap values through the iterators: on a List every
+ * distance and comparison of iterators walks the list, which makes them far slower than on an array. sortList
+ * uses the container's own sort() instead, for List a bottom-up natural merge sort that only relinks nodes.
+ *
+ * @tparam T The type of the container, which must provide sort(compare) (HasSort<T>), such as List.
+ * @tparam Compare The type of the ordering.
+ *
+ * @param container The container to sort.
+ * @param compare The ordering to sort by (std::less by default).
+ *
+ * @note The sort is stable, values are never copied and iterators to the elements stay valid.
+ *
+ * @complexity
+ * Time: O(n log n) worst case, O(n) on sorted input.
+ * Space: O(1), no allocation.
+ */
+template <typename T, typename Compare = std::less<>>
+void sortList(T& container, Compare compare = Compare()) requires HasSort<T>
+{
+    container.sort(compare);
+}
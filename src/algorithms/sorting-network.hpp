@@ -0,0 +1,357 @@
+#pragma once
+
+#include <array>        // for std::array
+#include <bit>          // for std::bit_cast
+#include <cstddef>      // for std::size_t
+#include <cstdint>      // for std::uint32_t, std::uint64_t
+#include <functional>   // for std::less
+#include <iterator>     // for std::iter_value_t
+#include <static-array.hpp>
+#include <type_traits>  // for std::is_arithmetic_v, std::conditional_t
+#include <utility>      // for std::swap, std::index_sequence
+
+/**
+ * @brief The largest number of elements of the sorting and merging networks.
+ *
+ * A network is unrolled into straight-line code, Batcher's networks have O(n log^2 n) comparators: past a few dozen
+ * elements the code outgrows the branches it saves.
+ */
+inline constexpr int SORTING_NETWORK_MAX_SIZE = 32;
+
+/**
+ * @brief One compare-exchange step of a network: after it, the element at low is not greater than the one at high.
+ */
+struct Comparator
+{
+    int low;
+    int high;
+};
+
+/**
+ * @brief Generate Batcher's odd-even merge sort network of n elements.
+ *
+ * The network sorts any input with 5, 19, 63 and 191 comparators for 4, 8, 16 and 32 elements, the best known
+ * networks having 5, 19, 60 and 185.
+ *
+ * @param n The number of elements.
+ * @param comparators Where the comparators are written, or nullptr to only count them.
+ * @return The number of comparators.
+ */
+constexpr int batcherSortComparators(int n, Comparator* comparators)
+{
+    int count = 0;
+    for (int p = 1; p < n; p <<= 1)
+    {
+        for (int k = p; k >= 1; k >>= 1)
+        {
+            for (int j = k % p; j + k < n; j += 2 * k)
+            {
+                for (int i = 0; i < k && i < n - j - k; ++i)
+                {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                    {
+                        if (comparators != nullptr)
+                        {
+                            comparators[count] = {i + j, i + j + k};
+                        }
+                        ++count;
+                    }
+                }
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief The positions of the elements of a run of a merging network, in the order of their values.
+ */
+struct NetworkRun
+{
+    std::array<int, SORTING_NETWORK_MAX_SIZE> positions{};
+    int size{0};
+};
+
+/**
+ * @brief Generate Batcher's odd-even merging network of two sorted runs of any sizes.
+ *
+ * The odd elements of both runs are merged, the even elements as well, recursively, and one last column of
+ * comparators fixes the interleaving of the two results. With runs of different sizes the merged elements do not
+ * end up in the order of their positions, the returned run tells where each one is.
+ *
+ * @param first The positions of the first sorted run.
+ * @param second The positions of the second sorted run.
+ * @param comparators Where the comparators are written, or nullptr to only count them.
+ * @param count The number of comparators written so far, updated.
+ * @return The positions of the merged elements, from the smallest to the largest.
+ */
+constexpr NetworkRun batcherMergeComparators(const NetworkRun& first, const NetworkRun& second,
+                                             Comparator* comparators, int& count)
+{
+    if (first.size == 0 || second.size == 0)
+    {
+        return first.size == 0 ? second : first;
+    }
+    if (first.size == 1 && second.size == 1)
+    {
+        if (comparators != nullptr)
+        {
+            comparators[count] = {first.positions[0], second.positions[0]};
+        }
+        ++count;
+        return {{first.positions[0], second.positions[0]}, 2};
+    }
+
+    // Split both runs in their elements of even and odd index
+    NetworkRun split[2][2];
+    for (int i = 0; i < first.size; ++i)
+    {
+        NetworkRun& run = split[i % 2][0];
+        run.positions[run.size++] = first.positions[i];
+    }
+    for (int i = 0; i < second.size; ++i)
+    {
+        NetworkRun& run = split[i % 2][1];
+        run.positions[run.size++] = second.positions[i];
+    }
+    const NetworkRun even = batcherMergeComparators(split[0][0], split[0][1], comparators, count);
+    const NetworkRun odd = batcherMergeComparators(split[1][0], split[1][1], comparators, count);
+
+    NetworkRun merged;
+    for (int i = 0; i < even.size || i < odd.size; ++i)
+    {
+        if (i < even.size)
+        {
+            merged.positions[merged.size++] = even.positions[i];
+        }
+        if (i < odd.size)
+        {
+            merged.positions[merged.size++] = odd.positions[i];
+        }
+    }
+    for (int i = 1; i + 1 < merged.size; i += 2)
+    {
+        if (comparators != nullptr)
+        {
+            comparators[count] = {merged.positions[i], merged.positions[i + 1]};
+        }
+        ++count;
+    }
+    return merged;
+}
+
+/**
+ * @brief The sorting network of N elements, generated at compile time.
+ *
+ * @tparam N The number of elements, at most SORTING_NETWORK_MAX_SIZE.
+ */
+template <int N>
+struct SortingNetwork
+{
+    static_assert(N >= 0 && N <= SORTING_NETWORK_MAX_SIZE, "Sorting networks are for small fixed-size batches.");
+
+    static constexpr int COUNT = batcherSortComparators(N, nullptr);  ///< Number of comparators.
+
+    static constexpr std::array<Comparator, COUNT> COMPARATORS = []
+    {
+        std::array<Comparator, COUNT> comparators{};
+        batcherSortComparators(N, comparators.data());
+        return comparators;
+    }();
+};
+
+/**
+ * @brief The network merging a sorted run of N1 elements, at positions [0, N1), with a sorted run of N2 elements, at
+ * positions [N1, N1 + N2), generated at compile time.
+ *
+ * @tparam N1 The size of the first run.
+ * @tparam N2 The size of the second run, N1 + N2 is at most SORTING_NETWORK_MAX_SIZE.
+ */
+template <int N1, int N2>
+struct MergingNetwork
+{
+    static_assert(N1 >= 0 && N2 >= 0 && N1 + N2 <= SORTING_NETWORK_MAX_SIZE,
+                  "Merging networks are for small fixed-size batches.");
+
+private:
+    static constexpr NetworkRun run(int begin, int size)
+    {
+        NetworkRun run;
+        for (int i = 0; i < size; ++i)
+        {
+            run.positions[run.size++] = begin + i;
+        }
+        return run;
+    }
+
+    static constexpr int countComparators()
+    {
+        int count = 0;
+        batcherMergeComparators(run(0, N1), run(N1, N2), nullptr, count);
+        return count;
+    }
+
+public:
+    static constexpr int COUNT = countComparators();  ///< Number of comparators.
+
+    static constexpr std::array<Comparator, COUNT> COMPARATORS = []
+    {
+        std::array<Comparator, COUNT> comparators{};
+        int count = 0;
+        batcherMergeComparators(run(0, N1), run(N1, N2), comparators.data(), count);
+        return comparators;
+    }();
+
+    /// ORDER[k] is the position of the k-th smallest element once the comparators ran.
+    static constexpr std::array<int, N1 + N2> ORDER = []
+    {
+        int count = 0;
+        const NetworkRun merged = batcherMergeComparators(run(0, N1), run(N1, N2), nullptr, count);
+        std::array<int, N1 + N2> order{};
+        for (int i = 0; i < N1 + N2; ++i)
+        {
+            order[i] = merged.positions[i];
+        }
+        return order;
+    }();
+};
+
+/**
+ * @brief Order two elements with one comparison.
+ *
+ * Arithmetic elements are selected rather than swapped under a branch, which compiles to conditional moves or
+ * min/max instructions: the outcome of a comparison of unsorted data is not predictable.
+ */
+template <int Low, int High, typename Iterator, typename Compare>
+constexpr void compareExchange(Iterator first, Compare& compare)
+{
+    auto& low = first[Low];
+    auto& high = first[High];
+    using T = std::iter_value_t<Iterator>;
+    if constexpr (std::is_floating_point_v<T> && (sizeof(T) == 4 || sizeof(T) == 8))
+    {
+        // The compilers branch on a floating point selection, the bits are selected as integers instead
+        using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        const bool swap = compare(high, low);
+        const auto a = std::bit_cast<Bits>(low);
+        const auto b = std::bit_cast<Bits>(high);
+        low = std::bit_cast<T>(swap ? b : a);
+        high = std::bit_cast<T>(swap ? a : b);
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+    {
+        const auto a = low;
+        const auto b = high;
+        const bool swap = compare(b, a);
+        low = swap ? b : a;
+        high = swap ? a : b;
+    }
+    else if (compare(high, low))
+    {
+        using std::swap;
+        swap(low, high);
+    }
+}
+
+// Run the comparators of the network in order, unrolled, each with its positions as template arguments
+template <typename Network, typename Iterator, typename Compare, std::size_t... Indices>
+constexpr void applyNetwork([[maybe_unused]] Iterator first, [[maybe_unused]] Compare& compare,
+                            std::index_sequence<Indices...>)
+{
+    (compareExchange<Network::COMPARATORS[Indices].low, Network::COMPARATORS[Indices].high>(first, compare), ...);
+}
+
+/**
+ * @brief Sort N elements with the sorting network of N, unrolled at compile time.
+ *
+ * Not stable.
+ *
+ * @tparam N The number of elements, at most SORTING_NETWORK_MAX_SIZE.
+ * @param first A random access iterator to the first of the N elements.
+ * @param compare The strict weak ordering of the elements.
+ *
+ * @complexity O(N log^2 N) comparisons, whatever the order of the input, without a data dependent branch for
+ * arithmetic elements.
+ */
+template <int N, typename Iterator, typename Compare = std::less<>>
+constexpr void sortNetwork(Iterator first, Compare compare = {})
+{
+    using Network = SortingNetwork<N>;
+    applyNetwork<Network>(first, compare, std::make_index_sequence<Network::COUNT>{});
+}
+
+/**
+ * @brief Sort a range of at most MaxSize elements with the sorting network of its size.
+ *
+ * The base case of the recursive sorts: the size is only known at run time, it selects one of the MaxSize + 1
+ * unrolled networks.
+ *
+ * @tparam MaxSize The largest size of the range, at most SORTING_NETWORK_MAX_SIZE.
+ * @param begin A random access iterator to the first element of the range.
+ * @param end An iterator past the last element of the range.
+ * @param compare The strict weak ordering of the elements.
+ *
+ * @complexity O(n log^2 n) comparisons.
+ */
+template <int MaxSize, typename Iterator, typename Compare = std::less<>>
+constexpr void sortNetworkRange(Iterator begin, Iterator end, Compare compare = {})
+{
+    const auto size = end - begin;
+    [&]<std::size_t... Sizes>(std::index_sequence<Sizes...>)
+    {
+        (void)((size == static_cast<decltype(size)>(Sizes) ? (sortNetwork<Sizes>(begin, compare), true) : false) ||
+               ...);
+    }(std::make_index_sequence<MaxSize + 1>{});
+}
+
+/**
+ * @brief Sort a StaticArray of at most SORTING_NETWORK_MAX_SIZE elements with a sorting network.
+ *
+ * @param array The array to sort.
+ * @param compare The strict weak ordering of the elements.
+ *
+ * @complexity O(N log^2 N) comparisons, see sortNetwork().
+ */
+template <typename T, int N, typename Access, std::size_t Alignment, typename Compare = std::less<>>
+constexpr void sortStatic(StaticArray<T, N, Access, Alignment>& array, Compare compare = {})
+{
+    sortNetwork<N>(array.begin(), compare);
+}
+
+/**
+ * @brief Merge two sorted runs of N1 and N2 elements with a merging network.
+ *
+ * Not stable. The elements are merged in a local buffer, then written in order to the output.
+ *
+ * @tparam N1 The size of the first run.
+ * @tparam N2 The size of the second run, N1 + N2 is at most SORTING_NETWORK_MAX_SIZE.
+ * @param first A random access iterator to the first sorted run.
+ * @param second A random access iterator to the second sorted run.
+ * @param output An iterator to the N1 + N2 merged elements.
+ * @param compare The strict weak ordering of the elements.
+ *
+ * @complexity O((N1 + N2) log(N1 + N2)) comparisons.
+ */
+template <int N1, int N2, typename Iterator1, typename Iterator2, typename OutputIterator,
+          typename Compare = std::less<>>
+constexpr void mergeNetwork(Iterator1 first, Iterator2 second, OutputIterator output, Compare compare = {})
+{
+    using Network = MergingNetwork<N1, N2>;
+    using T = std::iter_value_t<Iterator1>;
+
+    StaticArray<T, N1 + N2, UncheckedAccess> buffer;
+    for (int i = 0; i < N1; ++i)
+    {
+        buffer[i] = first[i];
+    }
+    for (int i = 0; i < N2; ++i)
+    {
+        buffer[N1 + i] = second[i];
+    }
+    applyNetwork<Network>(buffer.begin(), compare, std::make_index_sequence<Network::COUNT>{});
+    for (int position : Network::ORDER)
+    {
+        *output = std::move(buffer[position]);
+        ++output;
+    }
+}
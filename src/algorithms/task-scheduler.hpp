@@ -0,0 +1,477 @@
+#pragma once
+
+#include <algorithm>           // for std::max
+#include <atomic>              // for std::atomic
+#include <cache-line.hpp>
+#include <chrono>              // for std::chrono::milliseconds
+#include <condition_variable>  // for std::condition_variable
+#include <cstddef>             // for std::size_t
+#include <cstdint>             // for std::uint64_t
+#include <exception>           // for std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <memory>              // for std::unique_ptr, std::make_unique
+#include <mutex>               // for std::mutex, std::lock_guard, std::unique_lock
+#include <stdexcept>           // for std::invalid_argument, std::logic_error
+#include <thread>              // for std::thread, std::this_thread::yield
+#include <type_traits>         // for std::decay_t
+#include <utility>             // for std::forward, std::exchange
+#include <vector>
+#include <work-stealing-deque.hpp>
+
+class TaskGroup;
+
+/**
+ * @brief A pool of worker threads running fork-join tasks by work stealing.
+ *
+ * Every worker owns a WorkStealingDeque of tasks. A task spawned by a TaskGroup goes to the bottom of the deque of the
+ * thread spawning it, and that thread takes its own tasks back newest first, while the cache still holds their data.
+ * A worker out of tasks steals the oldest task of a random other worker: the oldest tasks are the biggest pieces of a
+ * divide-and-conquer, so one steal hands over a lot of work and the workers rarely meet on the same deque.
+ *
+ * A scheduler of n workers starts n - 1 threads. The thread calling run() is the first worker for the duration of the
+ * call, so a scheduler of one worker runs everything on the calling thread. Idle threads spin briefly, then sleep until
+ * a task is spawned.
+ *
+ * The parallel algorithms (parallelFor() here, parallelQuickSort() and parallelMergeKSort() in parallel-sort.hpp) take
+ * a scheduler, so a program keeps one and shares its threads between them.
+ */
+class TaskScheduler
+{
+public:
+    /**
+     * @brief Start the worker threads.
+     *
+     * @param workerCount The number of workers, the calling thread of run() included.
+     *
+     * @throws std::invalid_argument if the number of workers is not positive.
+     */
+    explicit TaskScheduler(int workerCount = getDefaultWorkerCount())
+    {
+        if (workerCount <= 0)
+        {
+            throw std::invalid_argument("TaskScheduler needs at least one worker");
+        }
+        for (int i = 0; i < workerCount; ++i)
+        {
+            mWorkers.push_back(std::make_unique<Worker>(this, 0x9E3779B97F4A7C15ull * (i + 1)));
+        }
+        for (int i = 1; i < workerCount; ++i)
+        {
+            mThreads.emplace_back([this, i] { workerLoop(*mWorkers[i]); });
+        }
+    }
+
+    ~TaskScheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mSleepMutex);
+            mStopping.store(true, std::memory_order_release);
+        }
+        mWake.notify_all();
+        for (std::thread& thread : mThreads)
+        {
+            thread.join();
+        }
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief Call a function on the calling thread as the first worker, so that it can spawn tasks.
+     *
+     * Calls from a task of the scheduler call the function directly. Calls from other threads run one at a time.
+     *
+     * @param function The function to call.
+     * @return What the function returns.
+     */
+    template <typename Function>
+    decltype(auto) run(Function&& function)
+    {
+        if (getCurrentWorker() != nullptr)
+        {
+            return std::forward<Function>(function)();
+        }
+
+        std::lock_guard<std::mutex> lock(mRunMutex);
+        CurrentWorkerScope scope(mWorkers[0].get());
+        return std::forward<Function>(function)();
+    }
+
+    /**
+     * @return The number of workers, the calling thread of run() included.
+     */
+    [[nodiscard]] int getWorkerCount() const noexcept
+    {
+        return static_cast<int>(mWorkers.size());
+    }
+
+    /**
+     * @return The number of hardware threads, or 1 if it is not known.
+     */
+    static int getDefaultWorkerCount() noexcept
+    {
+        return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+private:
+    friend class TaskGroup;
+
+    static constexpr int SPINS_BEFORE_SLEEP = 64;                  ///< Failed searches before sleeping.
+    static constexpr std::chrono::milliseconds SLEEP_TIMEOUT{10};  ///< Bound on a missed wake-up.
+
+    /**
+     * @brief A spawned function and the group waiting for it.
+     */
+    struct Task
+    {
+        virtual ~Task() = default;
+        virtual void execute() = 0;
+
+        TaskGroup* group{nullptr};
+    };
+
+    template <typename Function>
+    struct FunctionTask final : Task
+    {
+        explicit FunctionTask(Function function) : function(std::move(function))
+        {
+        }
+        void execute() override
+        {
+            function();
+        }
+
+        Function function;
+    };
+
+    /**
+     * @brief The deque of a worker and the state of its choice of victims, on cache lines of its own.
+     */
+    struct alignas(CACHE_LINE_SIZE) Worker
+    {
+        Worker(TaskScheduler* scheduler, std::uint64_t seed) : scheduler(scheduler), seed(seed)
+        {
+        }
+
+        TaskScheduler* scheduler;
+        WorkStealingDeque<Task*> deque;
+        std::uint64_t seed;  ///< State of the xorshift generator choosing the first victim.
+    };
+
+    /**
+     * @brief Makes a worker the current one of the calling thread until the end of the scope.
+     */
+    struct CurrentWorkerScope
+    {
+        explicit CurrentWorkerScope(Worker* worker) : previous(std::exchange(sCurrentWorker, worker))
+        {
+        }
+        ~CurrentWorkerScope()
+        {
+            sCurrentWorker = previous;
+        }
+        CurrentWorkerScope(const CurrentWorkerScope&) = delete;
+        CurrentWorkerScope& operator=(const CurrentWorkerScope&) = delete;
+
+        Worker* previous;
+    };
+
+    /**
+     * @return The worker of this scheduler the calling thread is, or nullptr.
+     */
+    Worker* getCurrentWorker() const noexcept
+    {
+        return sCurrentWorker != nullptr && sCurrentWorker->scheduler == this ? sCurrentWorker : nullptr;
+    }
+
+    /**
+     * @brief Run one task: the newest of the worker, otherwise one stolen from another worker.
+     *
+     * @return True if a task was run, false if none was found.
+     */
+    bool runOneTask(Worker& worker)
+    {
+        Task* task = nullptr;
+        if (!worker.deque.pop(task) && !stealTask(worker, task))
+        {
+            return false;
+        }
+        execute(task);
+        return true;
+    }
+
+    /**
+     * @brief Steal the oldest task of one of the other workers, trying each once from a random one.
+     */
+    bool stealTask(Worker& thief, Task*& task)
+    {
+        const std::size_t count = mWorkers.size();
+        if (count == 1)
+        {
+            return false;
+        }
+        thief.seed ^= thief.seed << 13;
+        thief.seed ^= thief.seed >> 7;
+        thief.seed ^= thief.seed << 17;
+        const std::size_t first = thief.seed % count;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Worker& victim = *mWorkers[(first + i) % count];
+            if (&victim != &thief && victim.deque.steal(task))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Defined after TaskGroup
+    void execute(Task* task);
+
+    /**
+     * @brief Wake a sleeping thread, if any, for a task just spawned.
+     */
+    void notifySpawn()
+    {
+        if (mSleeping.load(std::memory_order_seq_cst) > 0)
+        {
+            std::lock_guard<std::mutex> lock(mSleepMutex);
+            mWake.notify_one();
+        }
+    }
+
+    /**
+     * @brief Run tasks until the scheduler is destroyed.
+     */
+    void workerLoop(Worker& worker)
+    {
+        CurrentWorkerScope scope(&worker);
+        int idle = 0;
+        while (!mStopping.load(std::memory_order_acquire))
+        {
+            if (runOneTask(worker))
+            {
+                idle = 0;
+                continue;
+            }
+            if (++idle < SPINS_BEFORE_SLEEP)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // A spawn between the last search and the sleep may not be seen: the timeout bounds the delay, and the
+            // spawning thread runs the task itself meanwhile if nobody else does
+            std::unique_lock<std::mutex> lock(mSleepMutex);
+            mSleeping.fetch_add(1, std::memory_order_seq_cst);
+            if (!mStopping.load(std::memory_order_relaxed))
+            {
+                mWake.wait_for(lock, SLEEP_TIMEOUT);
+            }
+            mSleeping.fetch_sub(1, std::memory_order_relaxed);
+            idle = 0;
+        }
+    }
+
+    static inline thread_local Worker* sCurrentWorker = nullptr;  ///< The worker the calling thread is, if any.
+
+    std::vector<std::unique_ptr<Worker>> mWorkers;  ///< The first one is the thread calling run().
+    std::vector<std::thread> mThreads;
+    std::mutex mRunMutex;  ///< Held by the thread calling run().
+
+    std::mutex mSleepMutex;
+    std::condition_variable mWake;
+    std::atomic<int> mSleeping{0};  ///< The number of threads sleeping or about to.
+    std::atomic<bool> mStopping{false};
+};
+
+/**
+ * @brief A set of tasks spawned on a TaskScheduler and waited for together (fork-join).
+ *
+ * spawn() pushes a task on the deque of the calling worker, where an idle worker may steal it, and sync() waits
+ * until every task of the group finished. The waiting thread does not block: it runs its own tasks and steals others
+ * meanwhile, so a task may itself create a group, spawn and sync, to any depth.
+ *
+ * The first exception thrown by a task is rethrown by sync(); the tasks of the group not started yet are then
+ * skipped. The destructor waits for the tasks as well, so that they never outlive the data they refer to.
+ *
+ * @code
+ * scheduler.run([&] {
+ *     TaskGroup group(scheduler);
+ *     group.spawn([&] { left = compute(first, middle); });
+ *     right = compute(middle, last);
+ *     group.sync();
+ * });
+ * @endcode
+ */
+class TaskGroup
+{
+public:
+    explicit TaskGroup(TaskScheduler& scheduler) : mScheduler(scheduler)
+    {
+    }
+
+    ~TaskGroup()
+    {
+        wait();
+    }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * @brief Spawn a task running a function, that any worker may run until sync().
+     *
+     * @param function The function, moved or copied into the task.
+     *
+     * @throws std::logic_error if the calling thread is not running a task or a run() of the scheduler.
+     *
+     * @complexity O(1) amortized: one allocation and one push on the deque of the worker.
+     */
+    template <typename Function>
+    void spawn(Function&& function)
+    {
+        TaskScheduler::Worker* worker = mScheduler.getCurrentWorker();
+        if (worker == nullptr)
+        {
+            throw std::logic_error("TaskGroup::spawn must be called from TaskScheduler::run or a task");
+        }
+
+        auto task = std::make_unique<TaskScheduler::FunctionTask<std::decay_t<Function>>>(
+            std::forward<Function>(function));
+        task->group = this;
+        mPending.fetch_add(1, std::memory_order_relaxed);
+        try
+        {
+            worker->deque.push(task.get());
+        }
+        catch (...)
+        {
+            mPending.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+        task.release();
+        mScheduler.notifySpawn();
+    }
+
+    /**
+     * @brief Wait until every task spawned so far finished, running tasks meanwhile.
+     *
+     * @throws The first exception thrown by a task since the last sync().
+     */
+    void sync()
+    {
+        wait();
+        if (mFailed.load(std::memory_order_relaxed))
+        {
+            mFailed.store(false, std::memory_order_relaxed);
+            std::rethrow_exception(std::exchange(mException, nullptr));
+        }
+    }
+
+private:
+    friend class TaskScheduler;
+
+    void wait() noexcept
+    {
+        TaskScheduler::Worker* worker = mScheduler.getCurrentWorker();
+        while (mPending.load(std::memory_order_acquire) > 0)
+        {
+            if (!mScheduler.runOneTask(*worker))
+            {
+                std::this_thread::yield();  // The remaining tasks run on other workers
+            }
+        }
+    }
+
+    /**
+     * @brief Keep the exception of a task if it is the first one.
+     */
+    void fail(std::exception_ptr exception) noexcept
+    {
+        if (!mFailed.exchange(true, std::memory_order_relaxed))
+        {
+            mException = std::move(exception);
+        }
+    }
+
+    TaskScheduler& mScheduler;
+    std::atomic<int> mPending{0};  ///< The number of tasks spawned and not finished.
+    std::atomic<bool> mFailed{false};
+    std::exception_ptr mException;  ///< Written by the first failing task, read after the tasks finished.
+};
+
+inline void TaskScheduler::execute(Task* task)
+{
+    TaskGroup& group = *task->group;
+    if (!group.mFailed.load(std::memory_order_relaxed))
+    {
+        try
+        {
+            task->execute();
+        }
+        catch (...)
+        {
+            group.fail(std::current_exception());
+        }
+    }
+    delete task;
+    // Last access to the group: the thread in sync() may destroy it as soon as it sees the count drop
+    group.mPending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Split [first, last) in halves down to the grain size, spawning the upper halves in the group.
+ */
+template <typename Function>
+void parallelForSplit(TaskGroup& group, int first, int last, int grainSize, const Function& body)
+{
+    while (last - first > grainSize)
+    {
+        const int middle = first + (last - first) / 2;
+        group.spawn([&group, middle, last, grainSize, &body]
+                    { parallelForSplit(group, middle, last, grainSize, body); });
+        last = middle;
+    }
+    for (int i = first; i < last; ++i)
+    {
+        body(i);
+    }
+}
+
+/**
+ * @brief Call a function for every index of [first, last) on the workers of a scheduler.
+ *
+ * The range is split in halves recursively, so that a worker stealing a task takes half of the remaining work of its
+ * victim.
+ *
+ * @param scheduler The scheduler running the calls.
+ * @param first The first index.
+ * @param last The index after the last one.
+ * @param body The function, called with each index, from any worker and in no particular order.
+ * @param grainSize The largest number of indices a task calls the function for, by default about an eighth of the
+ * share of a worker.
+ *
+ * @throws The first exception thrown by the function; the calls not started yet are skipped.
+ *
+ * @complexity O(n) calls of the function, O(n / grainSize) tasks.
+ */
+template <typename Function>
+void parallelFor(TaskScheduler& scheduler, int first, int last, const Function& body, int grainSize = 0)
+{
+    if (first >= last)
+    {
+        return;
+    }
+    if (grainSize <= 0)
+    {
+        grainSize = std::max(1, (last - first) / (8 * scheduler.getWorkerCount()));
+    }
+    scheduler.run(
+        [&]
+        {
+            TaskGroup group(scheduler);
+            parallelForSplit(group, first, last, grainSize, body);
+            group.sync();
+        });
+}
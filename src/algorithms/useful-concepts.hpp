@@ -56,3 +56,59 @@ concept HasValueTypeInt = requires
     typename T::value_type;  ///< Ensure T has a member type `value_type`
 }
 &&std::is_same_v<typename T::value_type, int>;
+
+/**
+ * @brief Concept to check for the presence of removeIf().
+ *
+ * This concept ensures that the type T has a member function `removeIf()` that accepts a predicate on
+ * `const typename T::value_type&`.
+ *
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept HasRemoveIf = requires(T t, bool (*predicate)(const typename T::value_type&))
+{
+    {t.removeIf(predicate)};  ///< Ensure removeIf() exists and accepts a predicate
+};
+
+/**
+ * @brief Concept to check for the presence of erase() taking an iterator.
+ *
+ * This concept ensures that the type T has a member function `erase()` that accepts an iterator returned by
+ * `begin()` and returns an iterator to the next element, as List does in constant time.
+ *
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept HasIteratorErase = requires(T t)
+{
+    {t.erase(t.begin())} -> std::same_as<decltype(t.begin())>;  ///< Ensure erase() accepts an iterator
+};
+
+/**
+ * @brief Concept to check for the presence of removeFirst().
+ *
+ * This concept ensures that the type T has a member function `removeFirst()` removing its first element without
+ * shifting the others, as RingBuffer does in constant time.
+ *
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept HasRemoveFirst = requires(T t)
+{
+    {t.removeFirst()};  ///< Ensure removeFirst() exists
+};
+
+/**
+ * @brief Concept to check for the presence of sort().
+ *
+ * This concept ensures that the type T has a member function `sort()` ordering its own elements, as List does by
+ * relinking its nodes.
+ *
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept HasSort = requires(T t)
+{
+    {t.sort()};  ///< Ensure sort() exists
+};
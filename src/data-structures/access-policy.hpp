@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdexcept>    // for std::out_of_range
+#include <type_traits>  // for std::conditional_t
+
+/**
+ * @brief Selects whether element access is bounds-checked by default.
+ *
+ * Defaults to checked access in debug builds and unchecked access when NDEBUG is defined. Define
+ * DSA_CHECKED_ACCESS to 0 or 1 (e.g. with target_compile_definitions) to override it, as the tests do to keep
+ * the out of range checks in release builds.
+ */
+#ifndef DSA_CHECKED_ACCESS
+#ifdef NDEBUG
+#define DSA_CHECKED_ACCESS 0
+#else
+#define DSA_CHECKED_ACCESS 1
+#endif
+#endif
+
+/**
+ * @brief Access policy that validates every index and throws std::out_of_range when it is out of bounds.
+ */
+struct CheckedAccess
+{
+    static constexpr bool isChecked = true;
+
+    /**
+     * @brief Throw if the index is not within [0, size).
+     *
+     * @param index The index being accessed.
+     * @param size The number of accessible elements.
+     * @param message The message of the exception.
+     *
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    static constexpr void checkIndex(long long index, long long size, const char* message)
+    {
+        if (index < 0 || index >= size)
+        {
+            throw std::out_of_range(message);
+        }
+    }
+};
+
+/**
+ * @brief Access policy without any bounds check, an out of bounds index is undefined behavior.
+ *
+ * Removes the branch from indexing loops, so they can be inlined and auto-vectorized like raw pointer loops.
+ */
+struct UncheckedAccess
+{
+    static constexpr bool isChecked = false;
+
+    static constexpr void checkIndex(long long /*index*/, long long /*size*/, const char* /*message*/) noexcept
+    {
+    }
+};
+
+/**
+ * @brief The access policy used when none is given: CheckedAccess if DSA_CHECKED_ACCESS is set, UncheckedAccess
+ * otherwise.
+ */
+using DefaultAccess = std::conditional_t<DSA_CHECKED_ACCESS, CheckedAccess, UncheckedAccess>;
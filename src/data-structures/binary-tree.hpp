@@ -53,7 +53,7 @@ void traverseLevelOrder(NodeType* node, Visitor&& visit)
         return;
     }
 
-    Queue<NodeType*> queue;
+    Queue<NodeType*, RingBuffer<NodeType*>> queue;  // Contiguous, a level is pushed without allocating per node
     queue.push(node);
 
     while (!queue.isEmpty())
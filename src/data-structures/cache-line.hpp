@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>  // for std::size_t
+
+/**
+ * @brief The size of a cache line, to align the data written by different threads on lines of their own.
+ *
+ * 64 bytes on the usual targets. std::hardware_destructive_interference_size is not provided by every library, and
+ * GCC warns when it is used in a header since its value depends on the tuning flags.
+ */
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <access-policy.hpp>
+#include <atomic>       // for std::atomic
+#include <bit>          // for std::bit_width
+#include <cache-line.hpp>
+#include <climits>      // for INT_MAX
+#include <cstddef>      // for std::byte, std::size_t
+#include <cstdint>      // for std::uint64_t
+#include <cstdlib>      // for std::calloc, std::free
+#include <iterator>     // for std::forward_iterator_tag
+#include <new>          // for std::bad_alloc, std::launder, placement new
+#include <stdexcept>    // for std::length_error
+#include <type_traits>  // for std::is_trivially_destructible_v
+#include <utility>      // for std::forward, std::move
+
+/**
+ * @brief An append-only vector that many threads can append to concurrently without a lock.
+ *
+ * The elements live in segments that are never resized or moved: segment k holds FirstSegmentSize << k elements,
+ * so 32 segment pointers cover the whole int index range and an index maps to its segment with a couple of bit
+ * operations. Appending takes the next index from an atomic counter (a compare-and-swap, once the segment of the
+ * index is known to exist), constructs the element and publishes it with a per-slot state. The thread that reaches
+ * the middle of a segment allocates the next one, so appends rarely find their segment missing; if they do, the
+ * segment is installed with a compare-and-swap before the index is taken, so a failed allocation reserves nothing.
+ *
+ * Element addresses are stable, so a published element can be read wait-free while other threads keep appending.
+ * An element is published once append() returned its index; other threads can see it either through a
+ * happens-before relation with the appending thread (e.g. after joining it) or by observing isPublished().
+ *
+ * The index is reserved before the element is constructed, so a constructor that throws leaves a hole: the slot is
+ * marked failed instead of published and the exception reaches the caller of append(). So does a failure to
+ * allocate the next segment ahead of time. A reader waiting for an index stops when isFailed() is true, and the
+ * iterators skip the holes.
+ *
+ * @tparam T The type of elements in the vector.
+ * @tparam FirstSegmentSize The number of elements in the first segment, a power of two.
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined). Checks are against the reserved size.
+ */
+template <typename T, int FirstSegmentSize = 1024, typename Access = DefaultAccess>
+class ConcurrentSegmentedVector
+{
+    static_assert(FirstSegmentSize > 0 && (FirstSegmentSize & (FirstSegmentSize - 1)) == 0,
+                  "The first segment size must be a power of two.");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Segments come from calloc, T cannot be over-aligned.");
+
+    static constexpr std::uint8_t PENDING = 0;    ///< Reserved, the element is being constructed.
+    static constexpr std::uint8_t PUBLISHED = 1;  ///< The element is constructed.
+    static constexpr std::uint8_t FAILED = 2;     ///< The constructor threw, the slot holds no element.
+
+    /**
+     * @brief Storage of one element and the state telling whether it has been constructed.
+     *
+     * Slot is a trivial type, so a segment is just zeroed memory: calloc maps fresh zero pages lazily, which makes
+     * allocating even the largest segments O(1). The state is accessed atomically through std::atomic_ref.
+     */
+    struct Slot
+    {
+        alignas(T) std::byte storage[sizeof(T)];
+        std::uint8_t state;
+
+        [[nodiscard]] std::uint8_t getState() const noexcept
+        {
+            return std::atomic_ref<const std::uint8_t>(state).load(std::memory_order_acquire);
+        }
+        [[nodiscard]] bool isPublished() const noexcept
+        {
+            return getState() == PUBLISHED;
+        }
+        void setState(std::uint8_t value) noexcept
+        {
+            std::atomic_ref<std::uint8_t>(state).store(value, std::memory_order_release);
+        }
+
+        T* get() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+        const T* get() const noexcept
+        {
+            return std::launder(reinterpret_cast<const T*>(storage));
+        }
+    };
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Forward iterator over the elements, for use once no thread is appending anymore.
+     */
+    template <typename Vector, typename Value>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator() = default;
+        Iterator(Vector* vector, int index) : mVector(vector), mIndex(index)
+        {
+            skipFailed();
+        }
+
+        reference operator*() const
+        {
+            return *mVector->slot(mIndex).get();
+        }
+        pointer operator->() const
+        {
+            return mVector->slot(mIndex).get();
+        }
+        Iterator& operator++()
+        {
+            mIndex++;
+            skipFailed();
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+        bool operator==(const Iterator& other) const
+        {
+            return mIndex == other.mIndex;
+        }
+
+    private:
+        // Step over the slots whose constructor threw
+        void skipFailed() noexcept
+        {
+            const int size = mVector->getSize();
+            while (mIndex < size && mVector->slot(mIndex).getState() == FAILED)
+            {
+                mIndex++;
+            }
+        }
+
+        Vector* mVector{nullptr};
+        int mIndex{0};
+    };
+
+    using iterator = Iterator<ConcurrentSegmentedVector, T>;
+    using const_iterator = Iterator<const ConcurrentSegmentedVector, const T>;
+
+    ConcurrentSegmentedVector()
+    {
+        getOrCreateSegment(0);
+    }
+
+    ~ConcurrentSegmentedVector()
+    {
+        for (int segment = 0; segment < SEGMENT_COUNT; ++segment)
+        {
+            Slot* slots = mSegments[segment].load(std::memory_order_acquire);
+            if (slots == nullptr)
+            {
+                continue;
+            }
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (std::size_t i = 0; i < getSegmentSize(segment); ++i)
+                {
+                    if (slots[i].isPublished())
+                    {
+                        slots[i].get()->~T();
+                    }
+                }
+            }
+            std::free(slots);
+        }
+    }
+
+    // Elements are shared between threads through their addresses, so the vector itself is not copied or moved
+    ConcurrentSegmentedVector(const ConcurrentSegmentedVector&) = delete;
+    ConcurrentSegmentedVector& operator=(const ConcurrentSegmentedVector&) = delete;
+
+    /**
+     * @brief Append an item to the vector. Safe to call from any number of threads at the same time.
+     *
+     * @param item The item to append.
+     * @return The index of the new element.
+     *
+     * @throws std::length_error if the vector already holds getMaxSize() elements.
+     *
+     * @complexity
+     * - Time Complexity: O(1), lock-free (one compare-and-swap, retried when another thread took the index, plus one
+     *   compare-and-swap per new segment).
+     * - Space Complexity: O(1), or the size of the next segment for the element in the middle of a segment.
+     */
+    int append(const T& item)
+    {
+        return emplaceBack(item);
+    }
+
+    /**
+     * @brief Append an item to the vector, moving it into place.
+     *
+     * @param item The item to move into the vector.
+     * @return The index of the new element.
+     */
+    int append(T&& item)
+    {
+        return emplaceBack(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the next free index. Safe to call from any number of threads.
+     *
+     * If the constructor or the allocation of the next segment throws, the reserved index is marked failed (see
+     * isFailed()) and the exception is rethrown. If the segment of the index can not be allocated, no index is
+     * reserved.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return The index of the new element.
+     *
+     * @throws std::length_error if the vector already holds getMaxSize() elements.
+     */
+    template <typename... Args>
+    int emplaceBack(Args&&... args)
+    {
+        // The segment of an index exists before the index is taken, so a slot is never reserved without storage
+        std::uint64_t index = mReserved.load(std::memory_order_relaxed);
+        Slot* slots = nullptr;
+        do
+        {
+            if (index >= static_cast<std::uint64_t>(getMaxSize()))
+            {
+                throw std::length_error("ConcurrentSegmentedVector is full");
+            }
+            slots = getOrCreateSegment(getSegmentIndex(index));
+        } while (!mReserved.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+
+        const int segment = getSegmentIndex(index);
+        const std::uint64_t offset = index - getSegmentStart(segment);
+        Slot& target = slots[offset];
+        try
+        {
+            if (offset == getSegmentSize(segment) / 2 && segment + 1 < SEGMENT_COUNT)
+            {
+                getOrCreateSegment(segment + 1);  // Ahead of time, so the threads do not race to allocate it
+            }
+            new (target.storage) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            target.setState(FAILED);  // Readers waiting for this index give up instead of spinning
+            throw;
+        }
+        target.setState(PUBLISHED);
+
+        return static_cast<int>(index);
+    }
+
+    /**
+     * @brief Access a published element. Wait-free, and safe while other threads are appending.
+     *
+     * @param index The index of the element, it must be published (see isPublished()).
+     * @return A reference to the element, its address never changes.
+     *
+     * @throws std::out_of_range if the index is not reserved and the access policy is CheckedAccess.
+     */
+    T& operator[](int index)
+    {
+        Access::checkIndex(index, getSize(), "Index out of bounds in ConcurrentSegmentedVector::operator[]");
+        return *slot(index).get();
+    }
+    const T& operator[](int index) const
+    {
+        Access::checkIndex(index, getSize(), "Index out of bounds in ConcurrentSegmentedVector::operator[]");
+        return *slot(index).get();
+    }
+
+    /**
+     * @brief Checks whether the element at the given index has been constructed and can be read.
+     *
+     * @param index The index to check.
+     * @return True if the element is published. The element is then visible to the calling thread.
+     */
+    [[nodiscard]] bool isPublished(int index) const noexcept
+    {
+        if (index < 0 || index >= getSize())
+        {
+            return false;
+        }
+        const int segment = getSegmentIndex(static_cast<std::uint64_t>(index));
+        const Slot* slots = mSegments[segment].load(std::memory_order_acquire);
+        return slots != nullptr && slots[index - getSegmentStart(segment)].isPublished();
+    }
+
+    /**
+     * @brief Checks whether the constructor of the element at the given index threw.
+     *
+     * @param index The index to check.
+     * @return True if the index holds no element and never will.
+     */
+    [[nodiscard]] bool isFailed(int index) const noexcept
+    {
+        if (index < 0 || index >= getSize())
+        {
+            return false;
+        }
+        const int segment = getSegmentIndex(static_cast<std::uint64_t>(index));
+        const Slot* slots = mSegments[segment].load(std::memory_order_acquire);
+        return slots != nullptr && slots[index - getSegmentStart(segment)].getState() == FAILED;
+    }
+
+    /**
+     * @brief Get the number of reserved indices.
+     *
+     * While threads are appending it includes elements still being constructed. Once every append returned it is
+     * the number of elements, plus the indices whose constructor threw.
+     *
+     * @return The number of indices handed out by append().
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        const std::uint64_t reserved = mReserved.load(std::memory_order_acquire);
+        return reserved < static_cast<std::uint64_t>(getMaxSize()) ? static_cast<int>(reserved) : getMaxSize();
+    }
+
+    /**
+     * @brief Checks if the container has no elements.
+     *
+     * @return True if no index has been reserved yet, false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return getSize() == 0;
+    }
+
+    /**
+     * @return Iterators over all elements. Only valid once every append returned and its thread was synchronized
+     * with (e.g. joined).
+     */
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+    iterator end()
+    {
+        return iterator(this, getSize());
+    }
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const
+    {
+        return const_iterator(this, getSize());
+    }
+
+    /**
+     * @return The maximum number of elements, limited by the int indices.
+     */
+    [[nodiscard]] static constexpr int getMaxSize() noexcept
+    {
+        return INT_MAX;
+    }
+
+private:
+    static constexpr int FIRST_SEGMENT_BITS = std::bit_width(static_cast<unsigned>(FirstSegmentSize)) - 1;
+    static constexpr int SEGMENT_COUNT = 32 - FIRST_SEGMENT_BITS;  ///< Enough segments for INT_MAX elements
+
+    // Segment k starts at FirstSegmentSize * (2^k - 1), so index + FirstSegmentSize has its top bit at k + bits
+    static constexpr int getSegmentIndex(std::uint64_t index) noexcept
+    {
+        return std::bit_width(index + FirstSegmentSize) - 1 - FIRST_SEGMENT_BITS;
+    }
+    static constexpr std::uint64_t getSegmentStart(int segment) noexcept
+    {
+        return (std::uint64_t{FirstSegmentSize} << segment) - FirstSegmentSize;
+    }
+    static constexpr std::size_t getSegmentSize(int segment) noexcept
+    {
+        return std::size_t{FirstSegmentSize} << segment;
+    }
+
+    Slot& slot(int index) const noexcept
+    {
+        const int segment = getSegmentIndex(static_cast<std::uint64_t>(index));
+        return mSegments[segment].load(std::memory_order_acquire)[index - getSegmentStart(segment)];
+    }
+
+    /**
+     * @brief Return the segment, allocating it if no thread did yet. The first thread to install it wins, the
+     * others free their allocation.
+     */
+    Slot* getOrCreateSegment(int segment)
+    {
+        Slot* slots = mSegments[segment].load(std::memory_order_acquire);
+        if (slots != nullptr)
+        {
+            return slots;
+        }
+
+        auto* created = static_cast<Slot*>(std::calloc(getSegmentSize(segment), sizeof(Slot)));
+        if (created == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        if (mSegments[segment].compare_exchange_strong(
+                slots, created, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return created;
+        }
+        std::free(created);
+        return slots;  // Installed by another thread in the meantime
+    }
+
+    // Kept on separate cache lines: every append writes the counter, while the segment table is read-mostly
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> mReserved{0};  ///< Next index to hand out.
+    // Segment k holds FirstSegmentSize << k slots
+    alignas(CACHE_LINE_SIZE) std::atomic<Slot*> mSegments[SEGMENT_COUNT]{};
+};
@@ -0,0 +1,355 @@
+#pragma once
+
+#include <access-policy.hpp>
+#include <atomic>       // for std::atomic
+#include <cache-line.hpp>
+#include <concurrent-segmented-vector.hpp>
+#include <cstddef>      // for std::byte
+#include <cstdint>      // for std::uint32_t, std::uint64_t
+#include <new>          // for std::launder, placement new
+#include <type_traits>  // for std::is_trivially_destructible_v
+#include <utility>      // for std::forward, std::move
+
+/**
+ * @brief A lock-free LIFO stack for any number of threads (a Treiber stack).
+ *
+ * The stack is a singly linked list whose head is swapped with a compare-and-swap. Two mechanisms make that safe
+ * without a lock:
+ * - ABA: the head is a 64-bit word holding the index of the top node and a 32-bit tag incremented by every change,
+ *   so a compare-and-swap fails if the head went away and came back to the same node in the meantime.
+ * - Reclamation: nodes live in a ConcurrentSegmentedVector arena whose addresses never change, and popped nodes go to
+ *   a free list (a second tagged Treiber stack) for the next pushes. A thread that read a node just before another
+ *   one popped it only reads a valid, possibly stale, next index, and its compare-and-swap then fails. Memory is
+ *   returned to the system when the stack is destroyed, so it stays at the largest number of elements held at once.
+ *
+ * pushAll() links a whole batch privately and publishes it with one compare-and-swap, popAll() detaches every
+ * element with one exchange: under contention a batch costs one successful atomic operation instead of one per
+ * element.
+ *
+ * The tag is 32 bits: a compare-and-swap could only succeed wrongly if a thread stalled between reading the head and
+ * swapping it while exactly a multiple of 2^32 other changes happened.
+ *
+ * @tparam T The type of elements in the stack.
+ */
+template <typename T>
+class ConcurrentStack
+{
+    static constexpr std::uint32_t NIL = 0xFFFFFFFF;  ///< The index of no node.
+    static constexpr int NODES_PER_TAKE = 32;          ///< Free nodes pushAll() takes with one compare-and-swap.
+
+    /**
+     * @brief A node of the list: the index of the node below and the storage of one element.
+     *
+     * next is atomic because a thread may read it from a node that another thread is relinking. It is stored with
+     * release and loaded with acquire, so that a thread following a stale link to a node also sees the node built.
+     */
+    struct Node
+    {
+        std::atomic<std::uint32_t> next{NIL};
+        alignas(T) std::byte storage[sizeof(T)];
+
+        T* get() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+public:
+    using value_type = T;
+
+    ConcurrentStack() = default;
+
+    ~ConcurrentStack()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (std::uint32_t index = getIndex(mHead.load(std::memory_order_acquire)); index != NIL;
+                 index = mNodes[index].next.load(std::memory_order_relaxed))
+            {
+                mNodes[index].get()->~T();
+            }
+        }
+    }
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    /**
+     * @brief Construct an element on top of the stack. Safe to call from any number of threads.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     *
+     * @complexity O(1) expected, lock-free: a failed compare-and-swap means another thread changed the stack.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args)
+    {
+        const std::uint32_t index = acquireNode();
+        Node& node = mNodes[index];
+        try
+        {
+            new (node.storage) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            pushChain(mFree, index, index);
+            throw;
+        }
+        pushChain(mHead, index, index);
+    }
+
+    /**
+     * @brief Push an element on top of the stack. Safe to call from any number of threads.
+     *
+     * @complexity O(1) expected, lock-free.
+     */
+    void push(const T& value)
+    {
+        emplace(value);
+    }
+    void push(T&& value)
+    {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Push every element of the range [first, last) with one publication.
+     *
+     * The elements are linked privately, then the whole chain is put on top of the stack with one compare-and-swap,
+     * so the last element of the range ends up on top and no other push lands in the middle of the batch. The free
+     * nodes are taken NODES_PER_TAKE at a time, with one compare-and-swap as well.
+     *
+     * @param first Iterator to the first element to push.
+     * @param last Iterator past the last element to push.
+     * @return The number of elements pushed.
+     *
+     * @complexity O(m) for m elements, with one contended compare-and-swap for the batch plus one per
+     * NODES_PER_TAKE free nodes.
+     */
+    template <typename Iterator>
+    int pushAll(Iterator first, Iterator last)
+    {
+        std::uint32_t top = NIL;
+        std::uint32_t bottom = NIL;
+        std::uint32_t spare = NIL;  // Free nodes taken for the batch and not used yet
+        std::uint32_t spareBottom = NIL;
+        int count = 0;
+        for (; first != last; ++first, ++count)
+        {
+            if (spare == NIL)
+            {
+                spare = popNodes(mFree, NODES_PER_TAKE, spareBottom);
+            }
+            std::uint32_t index = spare;
+            if (index != NIL)
+            {
+                spare = index == spareBottom ? NIL : mNodes[index].next.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                index = static_cast<std::uint32_t>(mNodes.emplaceBack());
+            }
+
+            Node& node = mNodes[index];
+            try
+            {
+                new (node.storage) T(*first);
+            }
+            catch (...)
+            {
+                pushChain(mFree, index, index);
+                if (spare != NIL)
+                {
+                    pushChain(mFree, spare, spareBottom);
+                }
+                if (top != NIL)
+                {
+                    pushChain(mHead, top, bottom);  // The elements copied before the throw are pushed
+                }
+                throw;
+            }
+            node.next.store(top, std::memory_order_release);
+            top = index;
+            bottom = bottom == NIL ? index : bottom;
+        }
+        if (spare != NIL)
+        {
+            pushChain(mFree, spare, spareBottom);
+        }
+        if (top != NIL)
+        {
+            pushChain(mHead, top, bottom);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Move the top element out and remove it, if the stack is not empty. Safe to call from any number of
+     * threads.
+     *
+     * The element is returned rather than read with top() first: another thread could pop it in between.
+     *
+     * @param value Where the element is moved to.
+     * @return True if an element was popped, false if the stack is empty.
+     *
+     * @complexity O(1) expected, lock-free.
+     */
+    bool pop(T& value)
+    {
+        const std::uint32_t index = popNode(mHead);
+        if (index == NIL)
+        {
+            return false;
+        }
+        T* element = mNodes[index].get();
+        value = std::move(*element);
+        element->~T();
+        pushChain(mFree, index, index);
+        return true;
+    }
+
+    /**
+     * @brief Detach every element with one exchange and move them out, from the top down.
+     *
+     * @param output An output iterator the elements are moved to.
+     * @return The number of elements popped.
+     *
+     * @complexity O(n) for n elements, with one contended atomic operation.
+     */
+    template <typename OutputIterator>
+    int popAll(OutputIterator output)
+    {
+        std::uint64_t head = mHead.load(std::memory_order_relaxed);
+        while (getIndex(head) != NIL &&
+               !mHead.compare_exchange_weak(head, makeHead(NIL, getTag(head) + 1), std::memory_order_acquire,
+                                            std::memory_order_relaxed))
+        {
+        }
+
+        const std::uint32_t top = getIndex(head);
+        std::uint32_t bottom = NIL;
+        int count = 0;
+        for (std::uint32_t index = top; index != NIL; index = mNodes[index].next.load(std::memory_order_relaxed))
+        {
+            T* element = mNodes[index].get();
+            *output = std::move(*element);
+            ++output;
+            element->~T();
+            bottom = index;
+            ++count;
+        }
+        if (top != NIL)
+        {
+            pushChain(mFree, top, bottom);  // The detached chain becomes free nodes as it is
+        }
+        return count;
+    }
+
+    /**
+     * @return True if the stack looked empty, exact only when no thread is running an operation.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return getIndex(mHead.load(std::memory_order_acquire)) == NIL;
+    }
+
+private:
+    static constexpr std::uint32_t getIndex(std::uint64_t head) noexcept
+    {
+        return static_cast<std::uint32_t>(head);
+    }
+    static constexpr std::uint32_t getTag(std::uint64_t head) noexcept
+    {
+        return static_cast<std::uint32_t>(head >> 32);
+    }
+    static constexpr std::uint64_t makeHead(std::uint32_t index, std::uint32_t tag) noexcept
+    {
+        return (static_cast<std::uint64_t>(tag) << 32) | index;
+    }
+
+    /**
+     * @brief Put the chain of nodes from top down to bottom, already linked, on top of a list.
+     */
+    void pushChain(std::atomic<std::uint64_t>& list, std::uint32_t top, std::uint32_t bottom)
+    {
+        std::uint64_t head = list.load(std::memory_order_relaxed);
+        do
+        {
+            mNodes[bottom].next.store(getIndex(head), std::memory_order_release);
+        } while (!list.compare_exchange_weak(
+            head, makeHead(top, getTag(head) + 1), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Unlink the top node of a list.
+     *
+     * @return The index of the node, or NIL if the list is empty.
+     */
+    std::uint32_t popNode(std::atomic<std::uint64_t>& list)
+    {
+        std::uint64_t head = list.load(std::memory_order_acquire);
+        for (;;)
+        {
+            const std::uint32_t index = getIndex(head);
+            if (index == NIL)
+            {
+                return NIL;
+            }
+            // The node may be popped and relinked meanwhile, then the tag changed and the swap fails
+            const std::uint32_t next = mNodes[index].next.load(std::memory_order_acquire);
+            if (list.compare_exchange_weak(
+                    head, makeHead(next, getTag(head) + 1), std::memory_order_acquire, std::memory_order_acquire))
+            {
+                return index;
+            }
+        }
+    }
+
+    /**
+     * @brief Unlink up to count nodes from the top of a list with one compare-and-swap.
+     *
+     * The chain is walked before the swap and may be stale, but nodes in a list are only relinked after being
+     * unlinked, which changes the tag: if the swap succeeds, the walked chain was the top of the list.
+     *
+     * @param bottom Set to the last unlinked node.
+     * @return The first unlinked node, or NIL if the list is empty.
+     */
+    std::uint32_t popNodes(std::atomic<std::uint64_t>& list, int count, std::uint32_t& bottom)
+    {
+        std::uint64_t head = list.load(std::memory_order_acquire);
+        for (;;)
+        {
+            const std::uint32_t top = getIndex(head);
+            if (top == NIL)
+            {
+                return NIL;
+            }
+            bottom = top;
+            std::uint32_t next = mNodes[top].next.load(std::memory_order_acquire);
+            for (int taken = 1; taken < count && next != NIL; ++taken)
+            {
+                bottom = next;
+                next = mNodes[next].next.load(std::memory_order_acquire);
+            }
+            if (list.compare_exchange_weak(
+                    head, makeHead(next, getTag(head) + 1), std::memory_order_acquire, std::memory_order_acquire))
+            {
+                return top;
+            }
+        }
+    }
+
+    /**
+     * @return A free node, recycled if possible, otherwise appended to the arena.
+     */
+    std::uint32_t acquireNode()
+    {
+        const std::uint32_t index = popNode(mFree);
+        return index != NIL ? index : static_cast<std::uint32_t>(mNodes.emplaceBack());
+    }
+
+    ConcurrentSegmentedVector<Node, 64, UncheckedAccess> mNodes;  ///< Every node ever used, at stable addresses.
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> mHead{makeHead(NIL, 0)};  ///< Tag and index of the top node.
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> mFree{makeHead(NIL, 0)};  ///< Tag and index of the free list.
+};
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <dynamic-array.hpp>
+#include <functional>  // for std::less
+#include <memory>      // for std::allocator
+#include <stdexcept>   // for std::out_of_range
+#include <utility>     // for std::move, std::forward
+
+/**
+ * @brief A priority queue stored as a d-ary heap in a DynamicArray: every node has up to D children.
+ *
+ * The element on top is the first one in the order of Compare: the smallest with the default std::less, unlike
+ * std::priority_queue. The children of index i are at D * i + 1 to D * i + D.
+ *
+ * A wider node makes the tree shallower, log_D(n) levels instead of log_2(n): a push compares once per level, while a
+ * pop compares D times per level, but the D children are adjacent in memory, so a level costs one or two cache lines.
+ * With D = 4 a pop on a heap larger than the cache touches half as many cache lines as with a binary heap.
+ *
+ * Elements are never swapped: a sift moves the hole left by the element being placed, one move per level, and writes
+ * the element once where it fits.
+ *
+ * @tparam T The type of elements in the heap.
+ * @tparam D The number of children of a node, at least 2.
+ * @tparam Compare The strict weak ordering; the first element in that order is on top.
+ * @tparam Allocator The allocator of the underlying DynamicArray.
+ */
+template <typename T, int D = 4, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+class DaryHeap
+{
+    static_assert(D >= 2, "DaryHeap needs at least two children per node");
+
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    DaryHeap() = default;
+
+    /**
+     * @brief Construct an empty heap with the given ordering and allocator.
+     */
+    explicit DaryHeap(const Compare& compare, const Allocator& allocator = Allocator())
+        : mData(allocator), mCompare(compare)
+    {
+    }
+
+    /**
+     * @brief Construct a heap holding the elements of the range [first, last).
+     *
+     * The elements are copied in one go, then arranged bottom-up (Floyd's heapify): each node from the last parent
+     * to the root is sifted down below its children, which are already heaps.
+     *
+     * @complexity O(n) comparisons and moves, against O(n log n) for n pushes.
+     */
+    template <typename Iterator>
+    DaryHeap(
+        Iterator first, Iterator last, const Compare& compare = Compare(), const Allocator& allocator = Allocator())
+        : mData(allocator), mCompare(compare)
+    {
+        mData.appendRange(first, last);
+        heapify();
+    }
+
+    /**
+     * @return The element on top of the heap.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(1).
+     */
+    [[nodiscard]] const T& top() const
+    {
+        if (mData.isEmpty())
+        {
+            throw std::out_of_range("The heap is empty in DaryHeap::top");
+        }
+        return mData.data()[0];
+    }
+
+    /**
+     * @brief Construct an element at the end of the array and sift it up to its place.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     *
+     * @complexity O(log_D n) comparisons, amortized O(1) for the append.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args)
+    {
+        mData.emplaceBack(std::forward<Args>(args)...);
+        siftUp(mData.getSize() - 1);
+    }
+
+    /**
+     * @brief Insert an element, keeping the heap property.
+     *
+     * @complexity O(log_D n).
+     */
+    void push(const T& value)
+    {
+        emplace(value);
+    }
+    void push(T&& value)
+    {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Remove the element on top of the heap.
+     *
+     * The last element fills the root hole and is sifted down.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(D log_D n).
+     */
+    void pop()
+    {
+        if (mData.isEmpty())
+        {
+            throw std::out_of_range("The heap is empty in DaryHeap::pop");
+        }
+        const int lastIndex = mData.getSize() - 1;
+        if (lastIndex > 0)
+        {
+            T moving = std::move(mData.data()[lastIndex]);
+            mData.erase(lastIndex);
+            siftDown(0, std::move(moving));
+        }
+        else
+        {
+            mData.erase(lastIndex);
+        }
+    }
+
+    /**
+     * @brief Push an element and pop the top, in one sift.
+     *
+     * If the element comes before the top (or the heap is empty), it would be popped right away: it is returned and
+     * the heap does not change.
+     *
+     * @param value The element to push.
+     * @return The element popped: the first of value and the elements of the heap.
+     *
+     * @complexity O(1) if the element comes first, otherwise O(D log_D n): one sift instead of two.
+     */
+    T pushPop(T value)
+    {
+        if (mData.isEmpty() || !mCompare(mData.data()[0], value))
+        {
+            return value;
+        }
+        T result = std::move(mData.data()[0]);
+        siftDown(0, std::move(value));
+        return result;
+    }
+
+    /**
+     * @brief Pop the top and push an element, in one sift.
+     *
+     * Unlike pushPop(), the element popped is always the current top, even if the pushed element comes before it.
+     *
+     * @param value The element to push.
+     * @return The element that was on top.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(D log_D n).
+     */
+    T replaceTop(T value)
+    {
+        if (mData.isEmpty())
+        {
+            throw std::out_of_range("The heap is empty in DaryHeap::replaceTop");
+        }
+        T result = std::move(mData.data()[0]);
+        siftDown(0, std::move(value));
+        return result;
+    }
+
+    /**
+     * @brief Remove every element.
+     */
+    void clear()
+    {
+        mData.eraseRange(0, mData.getSize());
+    }
+
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mData.getSize();
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mData.isEmpty();
+    }
+
+    /**
+     * @brief Iteration over the elements in the order of the array: the root, then each level from left to right.
+     */
+    const_iterator begin() const noexcept
+    {
+        return mData.data();
+    }
+    const_iterator end() const noexcept
+    {
+        return mData.data() + mData.getSize();
+    }
+
+private:
+    /**
+     * @brief Move the parents of the element at index down into its place until it fits, then write it once.
+     */
+    void siftUp(int index)
+    {
+        T* data = mData.data();
+        T moving = std::move(data[index]);
+        while (index > 0)
+        {
+            const int parent = (index - 1) / D;
+            if (!mCompare(moving, data[parent]))
+            {
+                break;
+            }
+            data[index] = std::move(data[parent]);
+            index = parent;
+        }
+        data[index] = std::move(moving);
+    }
+
+    /**
+     * @brief Fill the hole at index with moving.
+     *
+     * The hole first goes down to a leaf, taking the first of the children at each level, without comparing them
+     * with moving; then moving goes up from the leaf to its place. The element filling a hole usually comes from the
+     * bottom of the heap and belongs near the bottom again, so the way up is short, and the way down saves one
+     * comparison per level, the one whose outcome the processor cannot predict.
+     */
+    void siftDown(int index, T&& moving)
+    {
+        T* data = mData.data();
+        const int size = mData.getSize();
+        const int start = index;
+        int firstChild = D * index + 1;
+        while (firstChild + D <= size)  // Nodes with all D children: a loop of constant length the compiler unrolls
+        {
+            int best = firstChild;
+            for (int k = 1; k < D; ++k)
+            {
+                if (mCompare(data[firstChild + k], data[best]))
+                {
+                    best = firstChild + k;
+                }
+            }
+            data[index] = std::move(data[best]);
+            index = best;
+            firstChild = D * index + 1;
+        }
+        if (firstChild < size)  // The last parent may have fewer children
+        {
+            int best = firstChild;
+            for (int child = firstChild + 1; child < size; ++child)
+            {
+                if (mCompare(data[child], data[best]))
+                {
+                    best = child;
+                }
+            }
+            data[index] = std::move(data[best]);
+            index = best;
+        }
+
+        while (index > start)
+        {
+            const int parent = (index - 1) / D;
+            if (!mCompare(moving, data[parent]))
+            {
+                break;
+            }
+            data[index] = std::move(data[parent]);
+            index = parent;
+        }
+        data[index] = std::move(moving);
+    }
+
+    /**
+     * @brief Sift down every parent, from the last one to the root.
+     */
+    void heapify()
+    {
+        const int size = mData.getSize();
+        if (size < 2)
+        {
+            return;
+        }
+        T* data = mData.data();
+        for (int index = (size - 2) / D; index >= 0; --index)
+        {
+            siftDown(index, T(std::move(data[index])));
+        }
+    }
+
+    DynamicArray<T, Allocator> mData;
+    [[no_unique_address]] Compare mCompare{};
+};
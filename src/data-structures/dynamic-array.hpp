@@ -1,44 +1,91 @@
 #pragma once
 
+#include <access-policy.hpp>
+#include <algorithm>         // for std::move, std::move_backward
+#include <cstring>           // for std::memcpy, std::memmove
 #include <initializer_list>  // for std::initializer_list
+#include <iterator>          // for std::distance, std::iterator_traits
+#include <memory>            // for std::allocator, std::allocator_traits
+#include <memory_resource>   // for std::pmr::polymorphic_allocator
 #include <stdexcept>         // for std::out_of_range
-
-template <typename T>
+#include <type_traits>       // for std::is_trivially_copyable_v
+#include <utility>           // for std::move, std::move_if_noexcept, std::forward
+
+/**
+ * @brief A growable array that keeps its elements in contiguous storage.
+ *
+ * @tparam T The type of elements in the array.
+ * @tparam Allocator The allocator used for the storage (defaults to std::allocator<T>). Use
+ * std::pmr::polymorphic_allocator<T> (see PmrDynamicArray) to draw the storage from a memory resource
+ * such as a std::pmr::monotonic_buffer_resource arena.
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename Access = DefaultAccess>
 class DynamicArray
 {
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
 public:
     using value_type = T;
+    using allocator_type = Allocator;
     using iterator = T*;
 
-    DynamicArray() : mSize(0), mCapacity(getDefaultCapacity()), mData(new T[mCapacity])
+    DynamicArray() : DynamicArray(getDefaultCapacity())
+    {
+    }
+
+    explicit DynamicArray(const Allocator& allocator) : DynamicArray(getDefaultCapacity(), allocator)
     {
     }
 
-    DynamicArray(int initialCapacity) : mSize(0), mCapacity(initialCapacity), mData(new T[mCapacity])
+    DynamicArray(int initialCapacity, const Allocator& allocator = Allocator())
+        : mSize(0), mCapacity(initialCapacity), mAllocator(allocator), mData(allocate(mCapacity))
     {
     }
 
     // Constructor to initialize with an initializer list
-    DynamicArray(std::initializer_list<T> list) : mSize(list.size()), mCapacity(list.size()), mData(new T[mCapacity])
+    DynamicArray(std::initializer_list<T> list, const Allocator& allocator = Allocator())
+        : mSize(0), mCapacity(list.size()), mAllocator(allocator), mData(allocate(mCapacity))
     {
-        int i = 0;
-        for (auto& item : list)
+        try
+        {
+            for (auto& item : list)
+            {
+                construct(mData + mSize, item);
+                mSize++;
+            }
+        }
+        catch (...)
         {
-            mData[i++] = item;
+            destroyElements();
+            deallocate(mData, mCapacity);
+            throw;
         }
     }
 
     ~DynamicArray()
     {
-        delete[] mData;  // Free the dynamically allocated memory
+        destroyElements();  // Only the first mSize slots hold constructed elements
+        deallocate(mData, mCapacity);
     }
 
     // Copy constructor
-    DynamicArray(const DynamicArray& other) : mSize(other.mSize), mCapacity(other.mCapacity), mData(new T[mCapacity])
+    DynamicArray(const DynamicArray& other)
+        : mSize(0),
+          mCapacity(other.mCapacity),
+          mAllocator(AllocatorTraits::select_on_container_copy_construction(other.mAllocator)),
+          mData(allocate(mCapacity))
     {
-        for (int i = 0; i < mSize; ++i)
+        try
+        {
+            copyElementsFrom(other);
+        }
+        catch (...)
         {
-            mData[i] = other.mData[i];  // Copy the elements
+            destroyElements();  // The elements copied before the throw, no destructor runs for this array
+            deallocate(mData, mCapacity);
+            throw;
         }
     }
 
@@ -50,23 +97,26 @@ public:
             return *this;  // Return *this to avoid self-assignment
         }
 
-        // Release any existing resources
-        delete[] mData;
+        // Copy into new storage first, so a throwing allocation or copy leaves this array unchanged
+        constexpr bool propagate = AllocatorTraits::propagate_on_container_copy_assignment::value;
+        DynamicArray copy(other.mCapacity, propagate ? other.mAllocator : mAllocator);
+        copy.copyElementsFrom(other);
 
-        mCapacity = other.mCapacity;
-        mSize = other.mSize;
-
-        mData = new T[mCapacity];  // Allocate new memory
-        for (int i = 0; i < mSize; ++i)
+        // Swap the storage, the destructor of copy releases the old one with the allocator that provided it
+        std::swap(mData, copy.mData);
+        std::swap(mCapacity, copy.mCapacity);
+        std::swap(mSize, copy.mSize);
+        if constexpr (propagate)
         {
-            mData[i] = other.mData[i];  // Copy the elements
+            std::swap(mAllocator, copy.mAllocator);
         }
 
         return *this;
     }
 
     // Move constructor
-    DynamicArray(DynamicArray&& other) noexcept : mData(other.mData), mCapacity(other.mCapacity), mSize(other.mSize)
+    DynamicArray(DynamicArray&& other) noexcept
+        : mSize(other.mSize), mCapacity(other.mCapacity), mAllocator(std::move(other.mAllocator)), mData(other.mData)
     {
         // Transfer ownership of the resources
         other.mData = nullptr;
@@ -75,15 +125,42 @@ public:
     }
 
     // Move assignment operator
-    DynamicArray& operator=(DynamicArray&& other) noexcept
+    DynamicArray& operator=(DynamicArray&& other) noexcept(
+        AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value)
     {
         if (this == &other)
         {
             return *this;  // Return *this to avoid self-assignment
         }
 
+        if constexpr (
+            !AllocatorTraits::propagate_on_container_move_assignment::value && !AllocatorTraits::is_always_equal::value)
+        {
+            if (mAllocator != other.mAllocator)
+            {
+                // The storage of other can not be released by our allocator, move the elements one by one
+                T* newData = allocate(other.mSize);  // Before releasing anything, in case it throws
+                destroyElements();
+                deallocate(mData, mCapacity);
+                mSize = 0;
+                mCapacity = other.mSize;
+                mData = newData;
+                for (; mSize < other.mSize; ++mSize)
+                {
+                    construct(mData + mSize, std::move(other.mData[mSize]));
+                }
+                return *this;
+            }
+        }
+
         // Release any existing resources
-        delete[] mData;
+        destroyElements();
+        deallocate(mData, mCapacity);
+
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            mAllocator = std::move(other.mAllocator);
+        }
 
         // Transfer ownership of the resources
         mData = other.mData;
@@ -115,6 +192,22 @@ public:
         return mData;
     }
 
+    /**
+     * @brief Direct access to the underlying storage, never bounds-checked.
+     *
+     * Intended for hot loops that already know their indices are valid.
+     *
+     * @return A pointer to the first element, valid until the array grows or is destroyed.
+     */
+    T* data() noexcept
+    {
+        return mData;
+    }
+    const T* data() const noexcept
+    {
+        return mData;
+    }
+
     /**
      * @brief Returns an iterator pointing past the last element in the array.
      *
@@ -138,7 +231,7 @@ public:
      * @param index The index of the element to access.
      * @return A reference to the element at the specified index.
      *
-     * @throws std::out_of_range if the index is out of bounds.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
      *
      * @complexity
      * - Time Complexity: O(1) (direct array access).
@@ -146,10 +239,7 @@ public:
      */
     T& operator[](int index)
     {
-        if (index < 0 || index >= mSize)
-        {
-            throw std::out_of_range("Index out of bounds in DynamicArray::operator[]");
-        }
+        Access::checkIndex(index, mSize, "Index out of bounds in DynamicArray::operator[]");
         return mData[index];
     }
 
@@ -159,7 +249,7 @@ public:
      * @param index The index of the element to access.
      * @return A constant reference to the element at the specified index.
      *
-     * @throws std::out_of_range if the index is out of bounds.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
      *
      * @complexity
      * - Time Complexity: O(1) (direct array access).
@@ -167,10 +257,7 @@ public:
      */
     const T& operator[](int index) const
     {
-        if (index < 0 || index >= mSize)
-        {
-            throw std::out_of_range("Index out of bounds in DynamicArray::operator[]");
-        }
+        Access::checkIndex(index, mSize, "Index out of bounds in DynamicArray::operator[]");
         return mData[index];
     }
 
@@ -227,13 +314,73 @@ public:
      */
     void append(const T& item)
     {
-        if (mSize == mCapacity)
+        emplaceBack(item);
+    }
+
+    /**
+     * @brief Append an item to the array, moving it into place.
+     *
+     * @param item The item to move into the array.
+     *
+     * @complexity Same as append(const T&), without copying the item.
+     */
+    void append(T&& item)
+    {
+        emplaceBack(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the end of the array.
+     *
+     * The element is built directly in the first free slot of the storage from the given
+     * constructor arguments, so no temporary is created. When the array is full, the new
+     * element is constructed in the grown storage before the existing elements are relocated,
+     * which keeps arguments that refer to elements of this array valid.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A reference to the newly constructed element.
+     *
+     * @complexity
+     * - Time Complexity: amortized O(1), O(n) when the storage has to grow.
+     * - Space Complexity: 0(1) or O(n) if takes place resizing, where n is the new capacity.
+     */
+    template <typename... Args>
+    T& emplaceBack(Args&&... args)
+    {
+        if (mSize < mCapacity)
         {
-            constexpr int resizeFactor = 2;
-            resize(mCapacity * resizeFactor);
+            construct(mData + mSize, std::forward<Args>(args)...);
         }
-        mData[mSize] = item;
+        else
+        {
+            const int newCapacity = getGrowthCapacity();
+            T* newData = allocate(newCapacity);
+            try
+            {
+                construct(newData + mSize, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                deallocate(newData, newCapacity);
+                throw;
+            }
+            try
+            {
+                relocate(mData, mSize, newData);
+            }
+            catch (...)
+            {
+                AllocatorTraits::destroy(mAllocator, newData + mSize);
+                deallocate(newData, newCapacity);
+                throw;
+            }
+            deallocate(mData, mCapacity);
+            mData = newData;
+            mCapacity = newCapacity;
+        }
+
         mSize++;
+        return mData[mSize - 1];
     }
 
     /**
@@ -261,18 +408,32 @@ public:
             throw std::out_of_range("Index out of bounds in DynamicArray::insert");
         }
 
-        if (mSize == mCapacity)
+        if (pos == mSize)
         {
-            constexpr int resizeFactor = 2;
-            resize(mCapacity * resizeFactor);
+            return &emplaceBack(item);
         }
 
-        for (int i = mSize; i > pos; i--)
+        T value(item);  // The item may live inside this array, copy it before shifting or resizing
+        if (mSize == mCapacity)
         {
-            mData[i] = mData[i - 1];
+            resize(getGrowthCapacity());
         }
 
-        mData[pos] = item;
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(mData + pos + 1, mData + pos, sizeof(T) * (mSize - pos));
+            construct(mData + pos, std::move(value));
+        }
+        else
+        {
+            // The slot past the end is raw memory, so the last element is move-constructed into it
+            construct(mData + mSize, std::move(mData[mSize - 1]));
+            for (int i = mSize - 1; i > pos; i--)
+            {
+                mData[i] = std::move(mData[i - 1]);
+            }
+            mData[pos] = std::move(value);
+        }
         mSize++;
 
         return &mData[pos];
@@ -307,15 +468,295 @@ public:
             throw std::out_of_range("Index out of bounds in DynamicArray::erase");
         }
 
-        for (int i = pos; i < mSize - 1; i++)
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(mData + pos, mData + pos + 1, sizeof(T) * (mSize - pos - 1));
+        }
+        else
         {
-            mData[i] = mData[i + 1];
+            for (int i = pos; i < mSize - 1; i++)
+            {
+                mData[i] = std::move(mData[i + 1]);
+            }
+            AllocatorTraits::destroy(mAllocator, mData + mSize - 1);
         }
         mSize--;
 
         return &mData[pos];
     }
 
+    /**
+     * @brief Append every element of the range [first, last) to the array.
+     *
+     * For forward iterators the number of elements is known up front, so the storage grows at most once.
+     * Single-pass input iterators are appended one by one.
+     *
+     * @param first Iterator to the first element to append.
+     * @param last Iterator past the last element to append.
+     *
+     * @note The range must not refer to elements of this array.
+     *
+     * @complexity
+     * - Time Complexity: O(m), where m is the length of the range (plus O(n) if the array has to grow).
+     * - Space Complexity: O(1), or O(n + m) if the storage has to grow.
+     */
+    template <typename Iterator>
+    void appendRange(Iterator first, Iterator last)
+    {
+        if constexpr (isForwardIterator<Iterator>)
+        {
+            const int count = static_cast<int>(std::distance(first, last));
+            if (mSize + count > mCapacity)
+            {
+                resize(getGrowthCapacity(mSize + count));
+            }
+            for (; first != last; ++first)
+            {
+                construct(mData + mSize, *first);
+                mSize++;
+            }
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                emplaceBack(*first);
+            }
+        }
+    }
+
+    /**
+     * @brief Insert every element of the range [first, last) at the specified position.
+     *
+     * The elements after pos are shifted only once, by the length of the range. When the storage is too small
+     * a single new buffer is allocated and the elements are relocated around the gap directly, so no separate
+     * shift is needed.
+     *
+     * @param first Iterator to the first element to insert (forward iterator).
+     * @param last Iterator past the last element to insert.
+     * @param pos The position at which the first element of the range is inserted.
+     * @return iterator to the first inserted element.
+     *
+     * @throws std::out_of_range if the position is out of bounds (less than 0 or greater than the current size).
+     *
+     * @note The range must not refer to elements of this array.
+     *
+     * @complexity
+     * - Time Complexity: O(n + m), where n is the size of the array and m the length of the range.
+     * - Space Complexity: O(1), or O(n + m) if the storage has to grow.
+     */
+    template <typename Iterator>
+    iterator insertRange(Iterator first, Iterator last, int pos)
+    {
+        static_assert(isForwardIterator<Iterator>, "DynamicArray::insertRange requires forward iterators.");
+
+        if (pos < 0 || pos > mSize)
+        {
+            throw std::out_of_range("Index out of bounds in DynamicArray::insertRange");
+        }
+
+        const int count = static_cast<int>(std::distance(first, last));
+        if (count == 0)
+        {
+            return mData + pos;
+        }
+
+        if (mSize + count > mCapacity)
+        {
+            // One allocation: the range is built in the gap and the old elements are relocated around it
+            const int newCapacity = getGrowthCapacity(mSize + count);
+            T* newData = allocate(newCapacity);
+            int constructed = 0;
+            try
+            {
+                for (; first != last; ++first, ++constructed)
+                {
+                    construct(newData + pos + constructed, *first);
+                }
+            }
+            catch (...)
+            {
+                destroyRange(newData + pos, constructed);
+                deallocate(newData, newCapacity);
+                throw;
+            }
+            // Both halves are copied before the originals are destroyed, so a throw leaves the array untouched
+            try
+            {
+                transfer(mData, pos, newData);
+            }
+            catch (...)
+            {
+                destroyRange(newData + pos, count);
+                deallocate(newData, newCapacity);
+                throw;
+            }
+            try
+            {
+                transfer(mData + pos, mSize - pos, newData + pos + count);
+            }
+            catch (...)
+            {
+                destroyRange(newData, pos + count);
+                deallocate(newData, newCapacity);
+                throw;
+            }
+            destroyElements();
+            deallocate(mData, mCapacity);
+            mData = newData;
+            mCapacity = newCapacity;
+        }
+        else if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(mData + pos + count, mData + pos, sizeof(T) * (mSize - pos));
+            for (int i = 0; first != last; ++first, ++i)
+            {
+                construct(mData + pos + i, *first);
+            }
+        }
+        else
+        {
+            const int tail = mSize - pos;
+            T* oldEnd = mData + mSize;
+            if (tail > count)
+            {
+                // The last count elements move into raw memory, the rest of the tail shifts over constructed slots
+                for (int i = 0; i < count; ++i)
+                {
+                    construct(oldEnd + i, std::move(oldEnd[i - count]));
+                }
+                std::move_backward(mData + pos, oldEnd - count, oldEnd);
+                for (int i = 0; first != last; ++first, ++i)
+                {
+                    mData[pos + i] = *first;
+                }
+            }
+            else
+            {
+                // The whole tail moves into raw memory, the range overwrites it and continues into raw memory
+                Iterator middle = first;
+                std::advance(middle, tail);
+                int constructed = 0;
+                for (Iterator it = middle; it != last; ++it, ++constructed)
+                {
+                    construct(oldEnd + constructed, *it);
+                }
+                for (int i = 0; i < tail; ++i)
+                {
+                    construct(oldEnd + constructed + i, std::move(mData[pos + i]));
+                }
+                for (int i = 0; first != middle; ++first, ++i)
+                {
+                    mData[pos + i] = *first;
+                }
+            }
+        }
+        mSize += count;
+
+        return mData + pos;
+    }
+
+    /**
+     * @brief Erase the elements in the index range [first, last).
+     *
+     * The elements after the range are shifted once, by the length of the range.
+     *
+     * @param first Index of the first element to erase.
+     * @param last Index past the last element to erase.
+     * @return iterator to the element that followed the erased range.
+     *
+     * @throws std::out_of_range if the range is not within [0, size].
+     *
+     * @complexity
+     * - Time Complexity: O(n - last) for shifting the elements after the range.
+     * - Space Complexity: O(1).
+     */
+    iterator eraseRange(int first, int last)
+    {
+        if (first < 0 || last > mSize || first > last)
+        {
+            throw std::out_of_range("Index out of bounds in DynamicArray::eraseRange");
+        }
+
+        const int count = last - first;
+        if (count == 0)
+        {
+            return mData + first;
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(mData + first, mData + last, sizeof(T) * (mSize - last));
+        }
+        else
+        {
+            std::move(mData + last, mData + mSize, mData + first);
+            for (int i = mSize - count; i < mSize; ++i)
+            {
+                AllocatorTraits::destroy(mAllocator, mData + i);
+            }
+        }
+        mSize -= count;
+
+        return mData + first;
+    }
+
+    /**
+     * @brief Remove every element for which the predicate returns true, in a single pass.
+     *
+     * The kept elements are compacted towards the front in their original order. Consecutive kept elements
+     * are moved as one block (a memmove for trivially copyable types), and each element is moved at most once.
+     *
+     * @param predicate Callable taking a const T& and returning true for the elements to remove. It is called
+     * exactly once per element, from the first to the last.
+     * @return The number of removed elements.
+     *
+     * @complexity
+     * - Time Complexity: O(n), where n is the size of the array.
+     * - Space Complexity: O(1).
+     */
+    template <typename Predicate>
+    int removeIf(Predicate predicate)
+    {
+        int write = 0;
+        int runStart = 0;  // First element of the current run of kept elements
+        for (int read = 0; read <= mSize; ++read)
+        {
+            if (read < mSize && !predicate(std::as_const(mData[read])))
+            {
+                continue;
+            }
+
+            // The run [runStart, read) ends here: move it next to the already kept elements as one block
+            const int runLength = read - runStart;
+            if (runStart != write && runLength > 0)
+            {
+                if constexpr (std::is_trivially_copyable_v<T>)
+                {
+                    std::memmove(mData + write, mData + runStart, sizeof(T) * runLength);
+                }
+                else
+                {
+                    std::move(mData + runStart, mData + read, mData + write);
+                }
+            }
+            write += runLength;
+            runStart = read + 1;
+        }
+
+        const int removed = mSize - write;
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (int i = write; i < mSize; ++i)
+            {
+                AllocatorTraits::destroy(mAllocator, mData + i);
+            }
+        }
+        mSize = write;
+
+        return removed;
+    }
+
     /**
      * @brief Get the size of the array (dynamic size).
      *
@@ -345,6 +786,14 @@ public:
         return mSize == 0;
     }
 
+    /**
+     * @return A copy of the allocator used for the storage.
+     */
+    [[nodiscard]] Allocator getAllocator() const noexcept
+    {
+        return mAllocator;
+    }
+
     /**
      * @return Return the default capacity of a DynamicArray<T>.
      */
@@ -355,26 +804,182 @@ public:
     }
 
 private:
+    /**
+     * @brief Allocate uninitialized storage for the given number of elements.
+     *
+     * Only raw memory is obtained from the allocator, no element is constructed. Elements are
+     * built in place when they are appended or inserted.
+     *
+     * @param capacity The number of elements the storage must be able to hold.
+     * @return A pointer to the storage, or nullptr when the capacity is zero.
+     */
+    T* allocate(int capacity)
+    {
+        if (capacity <= 0)
+        {
+            return nullptr;
+        }
+        return AllocatorTraits::allocate(mAllocator, capacity);
+    }
+
+    /**
+     * @brief Release storage obtained with allocate(). Elements must be destroyed beforehand.
+     *
+     * @param data The storage to release (may be nullptr).
+     * @param capacity The capacity the storage was allocated with.
+     */
+    void deallocate(T* data, int capacity) noexcept
+    {
+        if (data)
+        {
+            AllocatorTraits::deallocate(mAllocator, data, capacity);
+        }
+    }
+
+    /**
+     * @brief Construct an element in uninitialized storage through the allocator.
+     */
+    template <typename... Args>
+    void construct(T* location, Args&&... args)
+    {
+        AllocatorTraits::construct(mAllocator, location, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Destroy the constructed elements, the storage itself is kept.
+     */
+    void destroyElements() noexcept
+    {
+        destroyRange(mData, mSize);
+    }
+
+    /**
+     * @brief Destroy count constructed elements, the storage itself is kept.
+     */
+    void destroyRange(T* first, int count) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                AllocatorTraits::destroy(mAllocator, first + i);
+            }
+        }
+    }
+
+    /**
+     * @brief Construct copies of elements in uninitialized storage, the originals are kept.
+     *
+     * Trivially copyable types are transferred with a single memcpy. Other types are move-constructed
+     * when their move constructor is noexcept and copy-constructed otherwise, so a throwing element
+     * leaves the source untouched and the elements already constructed are destroyed.
+     *
+     * @param source The storage holding count constructed elements.
+     * @param count The number of elements to transfer.
+     * @param destination Uninitialized storage with room for at least count elements.
+     */
+    void transfer(T* source, int count, T* destination)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (count > 0)
+            {
+                std::memcpy(destination, source, sizeof(T) * count);
+            }
+        }
+        else
+        {
+            int constructed = 0;
+            try
+            {
+                for (; constructed < count; constructed++)
+                {
+                    construct(destination + constructed, std::move_if_noexcept(source[constructed]));
+                }
+            }
+            catch (...)
+            {
+                destroyRange(destination, constructed);
+                throw;
+            }
+        }
+    }
+
+    /**
+     * @brief Move elements from one storage into uninitialized storage and destroy the originals.
+     *
+     * @param source The storage holding count constructed elements.
+     * @param count The number of elements to relocate.
+     * @param destination Uninitialized storage with room for at least count elements.
+     */
+    void relocate(T* source, int count, T* destination)
+    {
+        transfer(source, count, destination);
+        destroyRange(source, count);
+    }
+
+    /**
+     * @brief Copy-construct the elements of other into the (empty) storage of this array.
+     *
+     * @param other The array to copy the elements from.
+     */
+    void copyElementsFrom(const DynamicArray& other)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (other.mSize > 0)
+            {
+                std::memcpy(mData, other.mData, sizeof(T) * other.mSize);
+            }
+            mSize = other.mSize;
+        }
+        else
+        {
+            for (; mSize < other.mSize; ++mSize)
+            {
+                construct(mData + mSize, other.mData[mSize]);
+            }
+        }
+    }
+
+    /**
+     * @param required The minimum capacity needed (defaults to one more element than the current capacity).
+     * @return The capacity to grow to (doubling, or the required capacity if doubling is not enough).
+     */
+    [[nodiscard]] int getGrowthCapacity(int required = 0) const noexcept
+    {
+        constexpr int resizeFactor = 2;
+        const int doubled = mCapacity > 0 ? mCapacity * resizeFactor : 1;
+        return doubled >= required ? doubled : required;
+    }
+
+    template <typename Iterator>
+    static constexpr bool isForwardIterator =
+        std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>;
+
     /**
      * @brief Resize the array to a new capacity.
      *
-     * Allocates new storage with the specified capacity and moves existing elements
+     * Allocates new storage with the specified capacity and relocates existing elements
      * to the new storage. Deletes the old storage after resizing.
      *
      * @param newCapacity The new capacity of the array.
      */
     void resize(int newCapacity)
     {
-        T* newData = new T[newCapacity];
-
-        // Move elements to the new array
-        for (int i = 0; i < mSize; i++)
+        T* newData = allocate(newCapacity);
+        try
         {
-            newData[i] = mData[i];
+            relocate(mData, mSize, newData);
+        }
+        catch (...)
+        {
+            deallocate(newData, newCapacity);
+            throw;
         }
 
-        // Delete old array and update the pointer
-        delete[] mData;
+        // Release old storage and update the pointer
+        deallocate(mData, mCapacity);
         mData = newData;
         mCapacity = newCapacity;
     }
@@ -382,5 +987,13 @@ private:
     int mSize{0};      ///< The number of elements.
     int mCapacity{0};  ///< The number of elements that can be held in currently allocated storage.
 
-    T* mData;
+    [[no_unique_address]] Allocator mAllocator;  ///< The allocator providing the storage.
+
+    T* mData;  ///< Raw storage, only the first mSize slots hold constructed elements.
 };
+
+/**
+ * @brief DynamicArray whose storage comes from a std::pmr::memory_resource.
+ */
+template <typename T, typename Access = DefaultAccess>
+using PmrDynamicArray = DynamicArray<T, std::pmr::polymorphic_allocator<T>, Access>;
@@ -2,13 +2,13 @@
 
 #include <functional>
 #include <list>
-#include <queue>
 #include <stack>
 #include <stdexcept>  // for std::out_of_range
 #include <utility>
 #include <vector>
 #include <tuple>
 #include <disjoint-set.hpp>
+#include <queue.hpp>
 
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -352,26 +352,25 @@ bool hasCycle(int numVertices, const WeightedEdgeList& edges)
  *
  * @complexity
  * Time Complexity: O(V + E), where V is the number of vertices and E is the number of edges.
- * Space Complexity: O(V), for the visited vector and the BFS queue.
+ * Space Complexity: O(V), for the visited vector and the BFS queue, which holds each vertex at most once.
  */
 void BFS(const std::vector<std::list<int>>& graph, std::function<bool(int)> visit)
 {
     std::vector<bool> visited(graph.size(), false);
-    std::queue<int> queue;
+    Queue<int, RingBuffer<int>> queue;
 
     for (size_t start = 0; start < graph.size(); ++start)
     {
         if (!visited[start])
         {
             visited[start] = true;
-            queue.push(start);
+            queue.push(static_cast<int>(start));
 
-            while (!queue.empty())
+            while (!queue.isEmpty())
             {
                 int current = queue.front();
                 queue.pop();
 
-                visited[current] = true;
                 if (bool shouldStop = visit(current))
                 {
                     return;
@@ -379,8 +378,10 @@ void BFS(const std::vector<std::list<int>>& graph, std::function<bool(int)> visi
 
                 for (int neighbor : graph[current])
                 {
+                    // Marked when queued, so a vertex reached by several edges is queued and visited once
                     if (!visited[neighbor])
                     {
+                        visited[neighbor] = true;
                         queue.push(neighbor);
                     }
                 }
@@ -1,9 +1,11 @@
 #pragma once
 #include <dynamic-array.hpp>
+#include <stdexcept>  // for std::out_of_range
+#include <utility>    // for std::move
 
 constexpr int DEFAULT_INITIAL_CAPACITY{10};
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class MinHeap
 {
 public:
@@ -11,6 +13,15 @@ public:
     {
     }
 
+    /**
+     * @brief Constructs an empty heap whose storage is obtained from the given allocator.
+     *
+     * @param allocator The allocator used by the underlying DynamicArray.
+     */
+    explicit MinHeap(const Allocator& allocator) : mData(DEFAULT_INITIAL_CAPACITY, allocator)
+    {
+    }
+
     /**
      * @brief Inserts a new value into the heap, maintaining the min-heap property.
      *
@@ -34,15 +45,17 @@ public:
     {
         mData.append(value);
 
-        // Reordering
+        // Reordering: move the parents down into the hole until the new value fits, then write it once
+        T* data = mData.data();
         int index = mData.getSize() - 1;
+        T moving = std::move(data[index]);
         while (index > 0)
         {
             int parentIndex = (index - 1) / 2;
 
-            if (mData[index] < mData[parentIndex])
+            if (moving < data[parentIndex])
             {
-                std::swap(mData[index], mData[parentIndex]);
+                data[index] = std::move(data[parentIndex]);
                 index = parentIndex;
             }
             else
@@ -50,6 +63,7 @@ public:
                 break;
             }
         }
+        data[index] = std::move(moving);
     }
 
     /**
@@ -57,7 +71,7 @@ public:
      *
      * The root is replaced by the last element in the internal array,
      * which is then "bubbled down" (heapified) to its correct position
-     * by comparing with its children and swapping with the smallest if needed.
+     * by comparing with its children and moving the smallest one up if needed.
      *
      * If the heap is empty, the function does nothing.
      *
@@ -73,37 +87,68 @@ public:
             return;
 
         int lastIndex = mData.getSize() - 1;
-        std::swap(mData[0], mData[lastIndex]);
+        T moving = std::move(mData.data()[lastIndex]);
         mData.erase(lastIndex);
 
-        int currentIndex = 0;
+        int size = mData.getSize();
+        if (size == 0)
+        {
+            return;
+        }
 
+        // The root is a hole: move the smallest child up into it until the last element fits
+        T* data = mData.data();
+        int currentIndex = 0;
         while (true)
         {
-            int left = 2 * currentIndex + 1;
-            int right = 2 * currentIndex + 2;
-            int smallest = currentIndex;
-
-            if (left < mData.getSize() && mData[left] < mData[smallest])
+            int child = 2 * currentIndex + 1;
+            if (child >= size)
             {
-                smallest = left;
+                break;
             }
 
-            if (right < mData.getSize() && mData[right] < mData[smallest])
+            if (child + 1 < size && data[child + 1] < data[child])
             {
-                smallest = right;
+                child++;
             }
 
-            if (smallest != currentIndex)
+            if (data[child] < moving)
             {
-                std::swap(mData[currentIndex], mData[smallest]);
-                currentIndex = smallest;
+                data[currentIndex] = std::move(data[child]);
+                currentIndex = child;
             }
             else
             {
                 break;
             }
         }
+        data[currentIndex] = std::move(moving);
+    }
+
+    /**
+     * @brief Returns the smallest element (the root) of the heap.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(1).
+     */
+    [[nodiscard]] const T& top() const
+    {
+        if (mData.isEmpty())
+        {
+            throw std::out_of_range("The heap is empty in MinHeap::top");
+        }
+        return mData.data()[0];
+    }
+
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mData.getSize();
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mData.isEmpty();
     }
 
     // For testing purpouses.
@@ -118,5 +163,5 @@ public:
     }
 
 private:
-    DynamicArray<T> mData;
+    DynamicArray<T, Allocator> mData;
 };
\ No newline at end of file
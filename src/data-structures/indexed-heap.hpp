@@ -0,0 +1,331 @@
+#pragma once
+
+#include <dynamic-array.hpp>
+#include <functional>  // for std::less
+#include <stdexcept>   // for std::out_of_range, std::invalid_argument
+#include <string>
+#include <utility>     // for std::move
+
+/**
+ * @brief A d-ary heap of ids in [0, idCount), each with a key, that can change the key of any id in the heap (an
+ * addressable priority queue).
+ *
+ * The heap is an array of (key, id) entries, and a second array maps every id to the position of its entry, or -1
+ * when the id is not in the heap. Every move of an entry updates its position, so contains(), getKey() and finding
+ * the entry of an id for decreaseKey() or erase() are O(1), and the entry is then sifted in O(log n).
+ *
+ * This is what Dijkstra's and Prim's algorithms need: a vertex is pushed once with its first tentative distance, and
+ * every shorter distance found later decreases its key in place, instead of being pushed again as a duplicate.
+ *
+ * @tparam Key The type of keys.
+ * @tparam D The number of children of a node, at least 2.
+ * @tparam Compare The strict weak ordering of keys; the id whose key comes first is on top.
+ */
+template <typename Key, int D = 4, typename Compare = std::less<Key>>
+class IndexedHeap
+{
+    static_assert(D >= 2, "IndexedHeap needs at least two children per node");
+
+    struct Entry
+    {
+        Key key;
+        int id;
+    };
+
+public:
+    using key_type = Key;
+
+    /**
+     * @brief Construct an empty heap for the ids in [0, idCount).
+     *
+     * @throws std::invalid_argument if idCount is negative.
+     *
+     * @complexity O(idCount): the position array, and the storage of the entries reserved for every id.
+     */
+    explicit IndexedHeap(int idCount, const Compare& compare = Compare())
+        : mEntries(idCount > 0 ? idCount : 1), mPositions(idCount > 0 ? idCount : 1), mCompare(compare)
+    {
+        if (idCount < 0)
+        {
+            throw std::invalid_argument("IndexedHeap id count must not be negative");
+        }
+        for (int id = 0; id < idCount; ++id)
+        {
+            mPositions.append(-1);
+        }
+    }
+
+    /**
+     * @return True if the id is in the heap, false otherwise (including ids out of range).
+     *
+     * @complexity O(1).
+     */
+    [[nodiscard]] bool contains(int id) const noexcept
+    {
+        return id >= 0 && id < mPositions.getSize() && mPositions.data()[id] >= 0;
+    }
+
+    /**
+     * @return The key of an id in the heap.
+     *
+     * @throws std::out_of_range if the id is not in the heap.
+     *
+     * @complexity O(1).
+     */
+    [[nodiscard]] const Key& getKey(int id) const
+    {
+        return mEntries.data()[getPosition(id, "IndexedHeap::getKey")].key;
+    }
+
+    /**
+     * @brief Insert an id with its key.
+     *
+     * @throws std::out_of_range if the id is not in [0, idCount).
+     * @throws std::invalid_argument if the id is already in the heap.
+     *
+     * @complexity O(log_D n).
+     */
+    void push(int id, Key key)
+    {
+        if (id < 0 || id >= mPositions.getSize())
+        {
+            throw std::out_of_range("Id out of range in IndexedHeap::push");
+        }
+        if (mPositions.data()[id] >= 0)
+        {
+            throw std::invalid_argument("Id already in the heap in IndexedHeap::push");
+        }
+        mEntries.emplaceBack(Entry{std::move(key), id});
+        siftUp(mEntries.getSize() - 1);
+    }
+
+    /**
+     * @brief Give an id in the heap a key that does not come after its current key.
+     *
+     * @throws std::out_of_range if the id is not in the heap.
+     * @throws std::invalid_argument if the new key comes after the current key.
+     *
+     * @complexity O(log_D n).
+     */
+    void decreaseKey(int id, Key key)
+    {
+        const int position = getPosition(id, "IndexedHeap::decreaseKey");
+        Entry* entries = mEntries.data();
+        if (mCompare(entries[position].key, key))
+        {
+            throw std::invalid_argument("The new key comes after the current key in IndexedHeap::decreaseKey");
+        }
+        entries[position].key = std::move(key);
+        siftUp(position);
+    }
+
+    /**
+     * @brief Insert an id, or decrease its key if it is in the heap and the new key comes first: the relaxation step
+     * of Dijkstra's and Prim's algorithms.
+     *
+     * @return True if the id was inserted or its key decreased, false if its key did not change.
+     *
+     * @throws std::out_of_range if the id is not in [0, idCount).
+     *
+     * @complexity O(log_D n).
+     */
+    bool pushOrDecreaseKey(int id, Key key)
+    {
+        if (!contains(id))
+        {
+            push(id, std::move(key));
+            return true;
+        }
+        const int position = mPositions.data()[id];
+        Entry* entries = mEntries.data();
+        if (!mCompare(key, entries[position].key))
+        {
+            return false;
+        }
+        entries[position].key = std::move(key);
+        siftUp(position);
+        return true;
+    }
+
+    /**
+     * @return The id whose key comes first.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(1).
+     */
+    [[nodiscard]] int topId() const
+    {
+        return getTop("IndexedHeap::topId").id;
+    }
+
+    /**
+     * @return The key that comes first.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(1).
+     */
+    [[nodiscard]] const Key& topKey() const
+    {
+        return getTop("IndexedHeap::topKey").key;
+    }
+
+    /**
+     * @brief Remove the id on top of the heap.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(D log_D n).
+     */
+    void pop()
+    {
+        if (mEntries.isEmpty())
+        {
+            throw std::out_of_range("The heap is empty in IndexedHeap::pop");
+        }
+        removeAt(0);
+    }
+
+    /**
+     * @brief Remove an id from anywhere in the heap.
+     *
+     * The last entry fills the hole, then goes up or down to its place.
+     *
+     * @throws std::out_of_range if the id is not in the heap.
+     *
+     * @complexity O(D log_D n).
+     */
+    void erase(int id)
+    {
+        removeAt(getPosition(id, "IndexedHeap::erase"));
+    }
+
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mEntries.getSize();
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mEntries.isEmpty();
+    }
+
+    /**
+     * @return The number of ids the heap was made for: ids are in [0, getIdCount()).
+     */
+    [[nodiscard]] int getIdCount() const noexcept
+    {
+        return mPositions.getSize();
+    }
+
+private:
+    int getPosition(int id, const char* operation) const
+    {
+        if (!contains(id))
+        {
+            throw std::out_of_range(std::string("Id not in the heap in ") + operation);
+        }
+        return mPositions.data()[id];
+    }
+
+    const Entry& getTop(const char* operation) const
+    {
+        if (mEntries.isEmpty())
+        {
+            throw std::out_of_range(std::string("The heap is empty in ") + operation);
+        }
+        return mEntries.data()[0];
+    }
+
+    /**
+     * @brief Remove the entry at position, fill the hole with the last entry and sift it.
+     */
+    void removeAt(int position)
+    {
+        mPositions.data()[mEntries.data()[position].id] = -1;
+        const int lastIndex = mEntries.getSize() - 1;
+        if (position == lastIndex)
+        {
+            mEntries.erase(lastIndex);
+            return;
+        }
+
+        Entry* entries = mEntries.data();
+        entries[position] = std::move(entries[lastIndex]);
+        mEntries.erase(lastIndex);
+        mPositions.data()[entries[position].id] = position;
+        if (position > 0 && mCompare(entries[position].key, entries[(position - 1) / D].key))
+        {
+            siftUp(position);
+        }
+        else
+        {
+            siftDown(position);
+        }
+    }
+
+    /**
+     * @brief Move the parents of the entry at index down until it fits, then write it once.
+     */
+    void siftUp(int index)
+    {
+        Entry* entries = mEntries.data();
+        int* positions = mPositions.data();
+        Entry moving = std::move(entries[index]);
+        while (index > 0)
+        {
+            const int parent = (index - 1) / D;
+            if (!mCompare(moving.key, entries[parent].key))
+            {
+                break;
+            }
+            entries[index] = std::move(entries[parent]);
+            positions[entries[index].id] = index;
+            index = parent;
+        }
+        positions[moving.id] = index;
+        entries[index] = std::move(moving);
+    }
+
+    /**
+     * @brief Move the first of the children of the entry at index up until it fits, then write it once.
+     */
+    void siftDown(int index)
+    {
+        Entry* entries = mEntries.data();
+        int* positions = mPositions.data();
+        const int size = mEntries.getSize();
+        Entry moving = std::move(entries[index]);
+        for (;;)
+        {
+            const int firstChild = D * index + 1;
+            if (firstChild >= size)
+            {
+                break;
+            }
+            const int lastChild = firstChild + D < size ? firstChild + D : size;
+            int best = firstChild;
+            for (int child = firstChild + 1; child < lastChild; ++child)
+            {
+                if (mCompare(entries[child].key, entries[best].key))
+                {
+                    best = child;
+                }
+            }
+            if (!mCompare(entries[best].key, moving.key))
+            {
+                break;
+            }
+            entries[index] = std::move(entries[best]);
+            positions[entries[index].id] = index;
+            index = best;
+        }
+        positions[moving.id] = index;
+        entries[index] = std::move(moving);
+    }
+
+    DynamicArray<Entry> mEntries;  ///< The heap of (key, id) entries.
+    DynamicArray<int> mPositions;  ///< The position of the entry of every id, -1 if the id is not in the heap.
+    [[no_unique_address]] Compare mCompare;
+};
@@ -0,0 +1,504 @@
+#pragma once
+
+#include <access-policy.hpp>
+#include <cstddef>      // for std::ptrdiff_t
+#include <iterator>     // for std::bidirectional_iterator_tag
+#include <stdexcept>    // for std::invalid_argument, std::out_of_range
+#include <type_traits>  // for std::conditional_t, std::is_base_of_v, std::is_const_v
+
+template <typename T, typename Tag, typename Access>
+class IntrusiveList;
+
+/**
+ * @brief The links embedded in an object so that it can be put in an IntrusiveList without a separate node.
+ *
+ * An object derives from one hook per list it can be in at the same time, the hooks are told apart by their tag:
+ *
+ *     struct ByPriority;
+ *     struct Task : IntrusiveListHook<>, IntrusiveListHook<ByPriority> { ... };
+ *
+ * Copying an object does not copy its links, the copy is in no list. An object must be erased from its list before
+ * it is destroyed.
+ *
+ * @tparam Tag Distinguishes the hooks of an object that can be in several lists (defaults to void).
+ */
+template <typename Tag = void>
+class IntrusiveListHook
+{
+public:
+    IntrusiveListHook() = default;
+    IntrusiveListHook(const IntrusiveListHook& /*other*/) noexcept
+    {
+    }
+    IntrusiveListHook& operator=(const IntrusiveListHook& /*other*/) noexcept
+    {
+        return *this;
+    }
+
+    /**
+     * @return True if the object is in a list through this hook.
+     */
+    [[nodiscard]] bool isLinked() const noexcept
+    {
+        return mNext != nullptr;
+    }
+
+private:
+    template <typename, typename, typename>
+    friend class IntrusiveList;
+    template <typename, typename, typename>
+    friend class IntrusiveListIterator;
+
+    IntrusiveListHook* mNext{nullptr};  ///< The next hook of the list, null while the object is in no list.
+    IntrusiveListHook* mPrev{nullptr};  ///< The previous hook of the list.
+};
+
+/**
+ * @brief Iterator for traversing an IntrusiveList, a pointer to the hook of the current object.
+ *
+ * The past the end iterator points to the hook owned by the list, so it can be decremented to the last object.
+ *
+ * @tparam T The type of the objects in the list.
+ * @tparam Tag The tag of the hook the list links.
+ * @tparam Value T or const T.
+ */
+template <typename T, typename Tag, typename Value>
+class IntrusiveListIterator
+{
+    using Hook = std::conditional_t<std::is_const_v<Value>, const IntrusiveListHook<Tag>, IntrusiveListHook<Tag>>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;  ///< Required iterator category.
+    using value_type = T;                                       ///< Type of value pointed to.
+    using difference_type = std::ptrdiff_t;  ///< Type to represent the difference between two iterators.
+    using pointer = Value*;                  ///< Pointer type to the value type.
+    using reference = Value&;                ///< Reference type to the value type.
+
+    IntrusiveListIterator() = default;
+
+    /**
+     * @brief Construct a new IntrusiveListIterator.
+     *
+     * @param hook The hook of the object, or the hook of the list for the past the end iterator.
+     */
+    explicit IntrusiveListIterator(Hook* hook) : mHook(hook)
+    {
+    }
+
+    /**
+     * @brief Converts a mutable iterator to a const one.
+     */
+    template <typename Other>
+    requires(std::is_const_v<Value> && std::is_same_v<Other, T>)
+    IntrusiveListIterator(const IntrusiveListIterator<T, Tag, Other>& other) : mHook(other.mHook)
+    {
+    }
+
+    reference operator*() const
+    {
+        return static_cast<reference>(*mHook);
+    }
+    pointer operator->() const
+    {
+        return &static_cast<reference>(*mHook);
+    }
+
+    IntrusiveListIterator& operator++()
+    {
+        mHook = mHook->mNext;
+        return *this;
+    }
+    IntrusiveListIterator& operator--()
+    {
+        mHook = mHook->mPrev;
+        return *this;
+    }
+    IntrusiveListIterator operator++(int)
+    {
+        IntrusiveListIterator previous = *this;
+        mHook = mHook->mNext;
+        return previous;
+    }
+    IntrusiveListIterator operator--(int)
+    {
+        IntrusiveListIterator previous = *this;
+        mHook = mHook->mPrev;
+        return previous;
+    }
+
+    bool operator==(const IntrusiveListIterator& other) const = default;
+
+private:
+    template <typename, typename, typename>
+    friend class IntrusiveList;
+    template <typename, typename, typename>
+    friend class IntrusiveListIterator;
+
+    Hook* mHook{nullptr};  ///< The hook of the current object.
+};
+
+/**
+ * @brief A doubly linked list of objects that carry their own links.
+ *
+ * The list does not own its elements and never allocates: appending links the IntrusiveListHook embedded in the
+ * object and erasing unlinks it, the object itself is neither copied nor destroyed. Objects that already live in a
+ * pool, an array or on the stack can thus be put in lists (and in an IntrusiveUnorderedMap) at no cost, and an
+ * object can be erased in O(1) through a reference to it, without searching the list.
+ *
+ * The list is circular around a hook it owns, which makes every link and unlink branch free. Destroying or clearing
+ * the list unlinks the objects still in it.
+ *
+ * @tparam T The type of the objects, derived from IntrusiveListHook<Tag>.
+ * @tparam Tag The hook of T used by this list (defaults to void).
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
+ */
+template <typename T, typename Tag = void, typename Access = DefaultAccess>
+class IntrusiveList
+{
+    using Hook = IntrusiveListHook<Tag>;
+
+public:
+    using value_type = T;
+    using iterator = IntrusiveListIterator<T, Tag, T>;
+    using const_iterator = IntrusiveListIterator<T, Tag, const T>;
+
+    /**
+     * @brief Constructs an empty list.
+     */
+    IntrusiveList() noexcept
+    {
+        mRoot.mNext = &mRoot;
+        mRoot.mPrev = &mRoot;
+    }
+
+    // An object is in one list per hook, so a list can not be copied
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    /**
+     * @brief Takes over the objects of the other list, which is left empty.
+     *
+     * @complexity O(1)
+     */
+    IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList()
+    {
+        splice(end(), other);
+    }
+
+    /**
+     * @brief Unlinks the objects of this list and takes over the objects of the other list, which is left empty.
+     *
+     * @complexity O(n), where n is the size of this list.
+     */
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            splice(end(), other);
+        }
+        return *this;
+    }
+
+    // Destructor to unlink the objects still in the list, they are not destroyed.
+    ~IntrusiveList()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Access the object at the specified index.
+     *
+     * @param index The index of the object to access.
+     * @return Reference to the object at the specified index.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
+     *
+     * @complexity O(n), where n is the index.
+     */
+    T& operator[](int index)
+    {
+        Access::checkIndex(index, mSize, "Index out of range.");
+
+        iterator it = begin();
+        while (index-- > 0)
+        {
+            ++it;
+        }
+        return *it;
+    }
+    const T& operator[](int index) const
+    {
+        Access::checkIndex(index, mSize, "Index out of range.");
+
+        const_iterator it = begin();
+        while (index-- > 0)
+        {
+            ++it;
+        }
+        return *it;
+    }
+
+    /**
+     * @return An iterator to the first object of the list.
+     */
+    iterator begin() noexcept
+    {
+        return iterator(mRoot.mNext);
+    }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(mRoot.mNext);
+    }
+
+    /**
+     * @return An iterator past the last object of the list.
+     */
+    iterator end() noexcept
+    {
+        return iterator(&mRoot);
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(&mRoot);
+    }
+
+    /**
+     * @brief Get an iterator to an object of this list, without searching for it.
+     *
+     * @param item An object in the list.
+     * @return An iterator to the object.
+     *
+     * @complexity O(1)
+     */
+    static iterator iteratorTo(T& item) noexcept
+    {
+        return iterator(toHook(item));
+    }
+    static const_iterator iteratorTo(const T& item) noexcept
+    {
+        return const_iterator(toHook(const_cast<T&>(item)));
+    }
+
+    /**
+     * @brief Link an object at the back of the list.
+     *
+     * @param item The object to append, it must not be in a list through the same hook.
+     * @throws std::invalid_argument if the object is already in a list.
+     *
+     * @complexity O(1), no allocation.
+     */
+    void append(T& item)
+    {
+        insert(end(), item);
+    }
+
+    /**
+     * @brief Link an object before the given position.
+     *
+     * @param position Iterator to the object the item is inserted before, end() to append.
+     * @param item The object to insert, it must not be in a list through the same hook.
+     * @return Iterator to the inserted object.
+     * @throws std::invalid_argument if the object is already in a list.
+     *
+     * @complexity O(1), no allocation.
+     */
+    iterator insert(iterator position, T& item)
+    {
+        Hook* hook = toHook(item);
+        if (hook->isLinked())
+        {
+            throw std::invalid_argument("The item is already in a list in IntrusiveList::insert");
+        }
+
+        link(position.mHook, hook, hook);
+        mSize++;
+        return iterator(hook);
+    }
+
+    /**
+     * @brief Unlink the object at the given position, the object itself is left untouched.
+     *
+     * @param position Iterator to the object to erase.
+     * @return Iterator to the object next to the erased one, end() if it was the last one.
+     * @throws std::out_of_range if the position is end().
+     *
+     * @complexity O(1)
+     */
+    iterator erase(iterator position)
+    {
+        if (position.mHook == &mRoot)
+        {
+            throw std::out_of_range("Can not erase end() in IntrusiveList::erase");
+        }
+
+        Hook* next = position.mHook->mNext;
+        unlink(position.mHook);
+        mSize--;
+        return iterator(next);
+    }
+
+    /**
+     * @brief Unlink an object of this list, without searching for it.
+     *
+     * The object must be in this list: an object of another list through the same hook would be unlinked from that
+     * list while the size of this one goes down. With CheckedAccess the list is walked from the object to check it.
+     *
+     * @param item An object in this list.
+     * @throws std::invalid_argument if the object is in no list, or with CheckedAccess in another list.
+     *
+     * @complexity O(1), O(n) with CheckedAccess.
+     */
+    void erase(T& item)
+    {
+        Hook* hook = toHook(item);
+        if (!hook->isLinked())
+        {
+            throw std::invalid_argument("The item is not in a list in IntrusiveList::erase");
+        }
+        if constexpr (Access::isChecked)
+        {
+            if (!contains(hook))
+            {
+                throw std::invalid_argument("The item is in another list in IntrusiveList::erase");
+            }
+        }
+        erase(iterator(hook));
+    }
+
+    /**
+     * @brief Move every object of the other list before the given position, other is left empty.
+     *
+     * @param position Iterator to the object the objects are inserted before, end() to append.
+     * @param other The list whose objects are moved.
+     *
+     * @complexity O(1)
+     */
+    void splice(iterator position, IntrusiveList& other) noexcept
+    {
+        if (&other == this || other.isEmpty())
+        {
+            return;
+        }
+
+        Hook* first = other.mRoot.mNext;
+        Hook* last = other.mRoot.mPrev;
+        other.mRoot.mNext = &other.mRoot;
+        other.mRoot.mPrev = &other.mRoot;
+        link(position.mHook, first, last);
+
+        mSize += other.mSize;
+        other.mSize = 0;
+    }
+
+    /**
+     * @brief Move the objects of [first, last) of this list before the given position.
+     *
+     * @param position Iterator to the object the range is moved before, end() to move it to the back. It must not be
+     * inside of the range.
+     * @param first Iterator to the first object to move.
+     * @param last Iterator past the last object to move.
+     *
+     * @complexity O(1)
+     */
+    void splice(iterator position, iterator first, iterator last) noexcept
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        Hook* rangeLast = last.mHook->mPrev;
+        first.mHook->mPrev->mNext = last.mHook;
+        last.mHook->mPrev = first.mHook->mPrev;
+        link(position.mHook, first.mHook, rangeLast);
+    }
+
+    /**
+     * @brief Get the number of objects in the list.
+     *
+     * @complexity O(1)
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Checks if the list has no objects.
+     *
+     * @complexity O(1)
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @brief Unlink every object, leaving the list empty. The objects are not destroyed.
+     *
+     * @complexity O(n), where n is the number of objects in the list.
+     */
+    void clear() noexcept
+    {
+        Hook* current = mRoot.mNext;
+        while (current != &mRoot)
+        {
+            Hook* next = current->mNext;
+            current->mNext = nullptr;
+            current->mPrev = nullptr;
+            current = next;
+        }
+        mRoot.mNext = &mRoot;
+        mRoot.mPrev = &mRoot;
+        mSize = 0;
+    }
+
+private:
+    static Hook* toHook(T& item) noexcept
+    {
+        static_assert(std::is_base_of_v<Hook, T>, "The objects of an IntrusiveList must derive from its hook.");
+        return static_cast<Hook*>(&item);
+    }
+
+    /**
+     * @brief Check that a linked hook is in this list: going around its circle reaches the root of this list.
+     */
+    bool contains(const Hook* hook) const noexcept
+    {
+        for (const Hook* current = hook->mNext; current != hook; current = current->mNext)
+        {
+            if (current == &mRoot)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Link the chain of hooks from first to last before position.
+     */
+    static void link(Hook* position, Hook* first, Hook* last) noexcept
+    {
+        Hook* previous = position->mPrev;
+        first->mPrev = previous;
+        last->mNext = position;
+        previous->mNext = first;
+        position->mPrev = last;
+    }
+
+    /**
+     * @brief Unlink a single hook and mark it as in no list.
+     */
+    static void unlink(Hook* hook) noexcept
+    {
+        hook->mPrev->mNext = hook->mNext;
+        hook->mNext->mPrev = hook->mPrev;
+        hook->mNext = nullptr;
+        hook->mPrev = nullptr;
+    }
+
+    Hook mRoot;    ///< The hook before the first and after the last object, the past the end position.
+    int mSize{0};  ///< The number of objects in the list.
+};
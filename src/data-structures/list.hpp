@@ -1,7 +1,14 @@
 #pragma once
 
+#include <access-policy.hpp>
+#include <algorithm>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <node-pool.hpp>
+#include <type_traits>
 
 /**
  * @brief Represents a node in the doubly linked list.
@@ -383,6 +390,9 @@ public:
     }
 
 private:
+    template <typename, typename, typename>
+    friend class List;
+
     Node<T>* mNode;           ///< Pointer to the current node.
     bool mIsFinished{false};  ///< Flag to know if we are in the end of the list.
 };
@@ -390,25 +400,37 @@ private:
 /**
  * @brief Represents a doubly linked list.
  *
+ * The nodes come from a NodePool owned by the list: erased nodes are reused by the next insertions and the memory
+ * goes back to the allocator in a few large slabs when the list is destroyed, so a list whose size stays bounded
+ * (e.g. the container of a Queue) does not allocate once it reached its largest size.
+ *
  * @tparam T The type of elements stored in the list.
+ * @tparam Allocator The allocator of the node slabs (defaults to std::allocator<T>). It is rebound to Node<T>,
+ * use std::pmr::polymorphic_allocator<T> (see PmrList) to draw the nodes from a memory resource.
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
  */
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>, typename Access = DefaultAccess>
 class List
 {
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+    using Pool = NodePool<Node<T>, Allocator>;
+
 public:
     using value_type = T;
+    using allocator_type = Allocator;
     using iterator = ListIterator<T>;
 
-    // Destructor to release all dynamically allocated nodes.
+    // Destructor to destroy the elements, the pool then returns all the nodes to the allocator at once.
     ~List()
     {
-        // Start from the head of the list
-        Node<T>* current = mHead;
-        while (current != nullptr)
+        if constexpr (!std::is_trivially_destructible_v<T>)
         {
-            Node<T>* nextNode = current->next;
-            delete current;      // Delete the current node
-            current = nextNode;  // Move to the next node
+            for (Node<T>* current = mHead; current != nullptr; current = current->next)
+            {
+                NodeAllocatorTraits::destroy(mNodes.getAllocator(), current);
+            }
         }
     }
 
@@ -423,6 +445,15 @@ public:
     List() = default;
     List(int size){};
 
+    /**
+     * @brief Constructs an empty list whose nodes are obtained from the given allocator.
+     *
+     * @param allocator The allocator for the nodes.
+     */
+    explicit List(const Allocator& allocator) : mNodes(allocator)
+    {
+    }
+
     /**
      * @brief Constructor to initialize with an initializer list.
      *
@@ -433,7 +464,7 @@ public:
      * @complexity O(n), where n is the number of elements in the initializer list.
      * @spacecomplexity O(n), where n is the number of elements in the initializer list.
      */
-    List(std::initializer_list<T> list)
+    List(std::initializer_list<T> list, const Allocator& allocator = Allocator()) : mNodes(allocator)
     {
         for (const auto& item : list)
         {
@@ -452,6 +483,7 @@ public:
      * @spacecomplexity O(n), where n is the number of elements in the other list.
      */
     List(const List& other)
+        : mNodes(NodeAllocatorTraits::select_on_container_copy_construction(other.mNodes.getAllocator()))
     {
         for (const auto& item : other)
         {
@@ -480,6 +512,15 @@ public:
 
         clear();  // Clear the current list.
 
+        if constexpr (NodeAllocatorTraits::propagate_on_container_copy_assignment::value)
+        {
+            if (mNodes.getAllocator() != other.mNodes.getAllocator())
+            {
+                mNodes.release();  // The free nodes belong to the previous allocator.
+            }
+            mNodes.getAllocator() = other.mNodes.getAllocator();
+        }
+
         // Copy elements from the other list.
         for (const auto& item : other)
         {
@@ -500,7 +541,8 @@ public:
      * @complexity O(1) for moving the resources.
      * @spacecomplexity O(1) for the new object, no additional memory allocated.
      */
-    List(List&& other) noexcept : mHead(other.mHead), mTail(other.mTail), mSize(other.mSize)
+    List(List&& other) noexcept
+        : mHead(other.mHead), mTail(other.mTail), mSize(other.mSize), mNodes(std::move(other.mNodes))
     {
         // Nullify the state of the moved-from object.
         other.mHead = nullptr;
@@ -520,7 +562,9 @@ public:
      * @complexity O(1) for moving the resources.
      * @spacecomplexity O(1) for the new object, no additional memory allocated.
      */
-    List& operator=(List&& other) noexcept
+    List& operator=(List&& other) noexcept(
+        NodeAllocatorTraits::propagate_on_container_move_assignment::value ||
+        NodeAllocatorTraits::is_always_equal::value)
     {
         if (this == &other)
         {
@@ -529,6 +573,28 @@ public:
 
         clear();  // Clear the current list.
 
+        if constexpr (
+            !NodeAllocatorTraits::propagate_on_container_move_assignment::value &&
+            !NodeAllocatorTraits::is_always_equal::value)
+        {
+            if (mNodes.getAllocator() != other.mNodes.getAllocator())
+            {
+                // The nodes of other can not be released by our allocator, copy the values instead.
+                for (const auto& item : other)
+                {
+                    append(item);
+                }
+                return *this;
+            }
+        }
+
+        // Take the pool holding the nodes of other, other gets ours and its free nodes.
+        mNodes.swapNodes(other.mNodes);
+        if constexpr (NodeAllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            mNodes.swapAllocators(other.mNodes);
+        }
+
         // Move the resources from the other list.
         mHead = other.mHead;
         mTail = other.mTail;
@@ -546,17 +612,14 @@ public:
      *
      * @param index The index of the element to access.
      * @return Reference to the element at the specified index.
-     * @throws std::out_of_range if the index is out of bounds.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
      *
      * @complexity O(n), where n is the index. We traverse the list to find the element.
      * @spacecomplexity O(1)
      */
     T& operator[](std::size_t index)
     {
-        if (index >= mSize)
-        {
-            throw std::out_of_range("Index out of range.");
-        }
+        Access::checkIndex(static_cast<long long>(index), static_cast<long long>(mSize), "Index out of range.");
 
         Node<T>* currentNode = mHead;
         for (std::size_t i = 0; i < index; ++i)
@@ -572,17 +635,14 @@ public:
      *
      * @param index The index of the element to access.
      * @return Const reference to the element at the specified index.
-     * @throws std::out_of_range if the index is out of bounds.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
      *
      * @complexity O(n), where n is the index. We traverse the list to find the element.
      * @spacecomplexity O(1)
      */
     const T& operator[](std::size_t index) const
     {
-        if (index >= mSize)
-        {
-            throw std::out_of_range("Index out of range.");
-        }
+        Access::checkIndex(static_cast<long long>(index), static_cast<long long>(mSize), "Index out of range.");
 
         Node<T>* currentNode = mHead;
         for (std::size_t i = 0; i < index; ++i)
@@ -690,7 +750,7 @@ public:
      */
     void append(const T& item)
     {
-        auto newNode = new Node<T>(item);
+        auto newNode = createNode(item);
 
         if (mSize == 0)
         {
@@ -722,7 +782,7 @@ public:
     ListIterator<T> insert(const T& item, int pos)
     {
         // Check if the position is within valid bounds (0 to size inclusive).
-        if (pos < 0 || pos > mSize + 1)
+        if (pos < 0 || pos > mSize)
         {
             throw std::out_of_range("Index out of bounds in List::insert");
         }
@@ -736,7 +796,7 @@ public:
                 return ListIterator<T>(mHead);
             }
 
-            auto newNode = new Node<T>(item);
+            auto newNode = createNode(item);
             newNode->next = mHead;
             newNode->prev = nullptr;
             mHead->prev = newNode;
@@ -760,9 +820,10 @@ public:
                 nodeBeforeInsertion = nodeBeforeInsertion->next;  // Traverse to the node before the insertion point.
             }
 
-            auto newNode = new Node<T>(item);
+            auto newNode = createNode(item);
             newNode->prev = nodeBeforeInsertion;        // The new node points back to the current node.
             newNode->next = nodeBeforeInsertion->next;  // The new node points to the next node.
+            newNode->next->prev = newNode;              // The next node points back to the new node.
             nodeBeforeInsertion->next = newNode;        // The current node points to the new node.
 
             mSize++;
@@ -777,7 +838,7 @@ public:
      * @param return iterator to the element next to the erased element.
      *
      * @complexity O(n) in the worst case, since it may require traversal of the list to the erase point.
-     * @spacecomplexity O(1) as no additional memory is allocated; the node is deleted.
+     * @spacecomplexity O(1) as no additional memory is allocated; the node goes back to the pool.
      */
     ListIterator<T> erase(int pos)
     {
@@ -796,6 +857,7 @@ public:
         {
             if (mSize == 1)  // If there's only one element, the list will be empty after the erase.
             {
+                destroyNode(mHead);
                 mHead = nullptr;
                 mTail = nullptr;
                 mSize--;
@@ -805,6 +867,7 @@ public:
             {
                 auto newHead = mHead->next;
                 newHead->prev = nullptr;
+                destroyNode(mHead);
                 mHead = newHead;
                 mSize--;
                 return ListIterator<T>(mHead);
@@ -815,6 +878,7 @@ public:
         {
             if (mSize == 1)  // If there's only one element, the list will be empty after the erase.
             {
+                destroyNode(mTail);
                 mHead = nullptr;
                 mTail = nullptr;
                 mSize--;
@@ -823,8 +887,10 @@ public:
             else  // More than one element.
             {
                 // Move mTail to the previous node.
+                auto oldTail = mTail;
                 mTail = mTail->prev;
                 mTail->next = nullptr;
+                destroyNode(oldTail);
                 mSize--;
 
                 return end();
@@ -845,12 +911,229 @@ public:
 
             nodeNextToNodeToBeErased->prev = previousNodeToNodeToBeErased;
             previousNodeToNodeToBeErased->next = nodeNextToNodeToBeErased;
+            destroyNode(nodeToBeErased);
             mSize--;
 
             return ListIterator<T>(nodeNextToNodeToBeErased);
         }
     }
 
+    /**
+     * @brief Insert an item before the given position, without walking the list.
+     *
+     * @param position Iterator to the element the item is inserted before, end() to append.
+     * @param item The item to insert.
+     * @return Iterator to the inserted element.
+     *
+     * @complexity O(1)
+     */
+    ListIterator<T> insert(ListIterator<T> position, const T& item)
+    {
+        Node<T>* newNode = createNode(item);
+        linkBefore(getNode(position), newNode, newNode);
+        mSize++;
+        return ListIterator<T>(newNode);
+    }
+
+    /**
+     * @brief Erase the element at the given position, without walking the list.
+     *
+     * @param position Iterator to the element to erase.
+     * @return Iterator to the element next to the erased element, end() if it was the last one.
+     * @throws std::out_of_range if the position is end().
+     *
+     * @complexity O(1)
+     */
+    ListIterator<T> erase(ListIterator<T> position)
+    {
+        Node<T>* node = getNode(position);
+        if (node == nullptr)
+        {
+            throw std::out_of_range("Can not erase end() in List::erase");
+        }
+
+        Node<T>* next = node->next;
+        unlink(node, node);
+        destroyNode(node);
+        mSize--;
+
+        return next != nullptr ? ListIterator<T>(next) : end();
+    }
+
+    /**
+     * @brief Move every element of the other list before the given position, other is left empty.
+     *
+     * The nodes are relinked, not copied: their slabs are taken over from the pool of other, so they stay valid
+     * after other is destroyed. If the allocators of the lists differ the elements are copied instead.
+     *
+     * @param position Iterator to the element the elements are inserted before, end() to append.
+     * @param other The list whose elements are moved.
+     *
+     * @complexity O(1) when the allocators are equal, O(m) otherwise, where m is the size of other.
+     */
+    void splice(ListIterator<T> position, List& other)
+    {
+        if (&other == this || other.isEmpty())
+        {
+            return;
+        }
+        if (!canTakeNodesOf(other))
+        {
+            for (const auto& item : other)
+            {
+                insert(position, item);
+            }
+            other.clear();
+            return;
+        }
+
+        linkBefore(getNode(position), other.mHead, other.mTail);
+        takeNodesOf(other);
+    }
+
+    /**
+     * @brief Move the elements of [first, last) of this list before the given position.
+     *
+     * @param position Iterator to the element the range is moved before, end() to move it to the back. It must
+     * not be inside of the range.
+     * @param first Iterator to the first element to move.
+     * @param last Iterator past the last element to move.
+     *
+     * @complexity O(1)
+     */
+    void splice(ListIterator<T> position, ListIterator<T> first, ListIterator<T> last)
+    {
+        Node<T>* firstNode = getNode(first);
+        Node<T>* lastNode = getNode(last);
+        if (firstNode == lastNode)
+        {
+            return;
+        }
+        Node<T>* rangeTail = lastNode != nullptr ? lastNode->prev : mTail;
+
+        unlink(firstNode, rangeTail);
+        linkBefore(getNode(position), firstNode, rangeTail);
+    }
+
+    /**
+     * @brief Merge the sorted other list into this sorted list, other is left empty.
+     *
+     * The nodes of other are relinked, not copied, as in splice(). The merge is stable: of equal elements, the
+     * ones of this list come first.
+     *
+     * @param other The sorted list whose elements are moved.
+     * @param compare The ordering of both lists (std::less by default).
+     *
+     * @complexity O(n + m) comparisons, no allocation when the allocators are equal.
+     */
+    template <typename Compare = std::less<>>
+    void merge(List& other, Compare compare = Compare())
+    {
+        if (&other == this || other.isEmpty())
+        {
+            return;
+        }
+        if (!canTakeNodesOf(other))
+        {
+            // A node pointer, null past the last node: an end() iterator follows the tail, which the insertions move
+            Node<T>* position = mHead;
+            for (const auto& item : other)
+            {
+                while (position != nullptr && !compare(item, position->value))
+                {
+                    position = position->next;
+                }
+                insert(position != nullptr ? ListIterator<T>(position) : end(), item);
+            }
+            other.clear();
+            return;
+        }
+
+        Node<T>* mine = mHead;
+        Node<T>* theirs = other.mHead;
+        while (theirs != nullptr && mine != nullptr)
+        {
+            if (compare(theirs->value, mine->value))
+            {
+                Node<T>* next = theirs->next;
+                linkBefore(mine, theirs, theirs);
+                theirs = next;
+            }
+            else
+            {
+                mine = mine->next;
+            }
+        }
+        if (theirs != nullptr)
+        {
+            linkBefore(nullptr, theirs, other.mTail);  // The rest of other is larger than every element of this
+        }
+        takeNodesOf(other);
+    }
+
+    /**
+     * @brief Sort the list by relinking its nodes, with a bottom-up natural merge sort.
+     *
+     * The list is cut into its ascending runs, which are merged as in a binary counter: level k holds the merge of
+     * 2^k runs, and a new run merges its way up through the occupied levels. Merges of equal sized runs then follow
+     * each other closely, so they mostly touch nodes still in cache, where merging every run of the list pass after
+     * pass would walk the whole list once per level. The values are never copied or moved and iterators to elements
+     * stay valid, they follow their element. end() does not: it is the position after the last node, so an end()
+     * taken before the sort no longer compares equal to end() once another element is last, and must be taken
+     * again. The sort is stable and an already sorted list is a single run.
+     *
+     * @param compare The ordering to sort by (std::less by default).
+     *
+     * @complexity
+     * - Time Complexity: O(n log r) comparisons, where r <= n is the number of ascending runs of the list.
+     * - Space Complexity: O(1), the levels are a fixed array of 64 runs, no allocation.
+     */
+    template <typename Compare = std::less<>>
+    void sort(Compare compare = Compare())
+    {
+        if (mSize < 2)
+        {
+            return;
+        }
+
+        SortRun levels[SORT_LEVELS];  // levels[k] is empty or 2^k merged runs, older than the lower levels
+        int usedLevels = 0;
+        Node<T>* rest = mHead;
+        while (rest != nullptr)
+        {
+            SortRun run{rest, nullptr};
+            rest = cutRun(run, compare);
+
+            int level = 0;
+            for (; level < usedLevels && levels[level].head != nullptr; ++level)
+            {
+                run = mergeRuns(levels[level], run, compare);
+                levels[level] = SortRun();
+            }
+            usedLevels = std::max(usedLevels, level + 1);
+            levels[level] = run;
+        }
+
+        SortRun sorted;
+        for (int level = 0; level < usedLevels; ++level)
+        {
+            if (levels[level].head != nullptr)
+            {
+                sorted = sorted.head != nullptr ? mergeRuns(levels[level], sorted, compare) : levels[level];
+            }
+        }
+
+        // The merges only maintained the next links, restore the backward ones
+        Node<T>* previous = nullptr;
+        for (Node<T>* current = sorted.head; current != nullptr; current = current->next)
+        {
+            current->prev = previous;
+            previous = current;
+        }
+        mHead = sorted.head;
+        mTail = sorted.tail;
+    }
+
     /**
      * @brief Get the size of the linked list (dynamic size).
      *
@@ -880,20 +1163,192 @@ public:
     /**
      * @brief Clear the list.
      *
-     * Deallocates all nodes in the list, leaving the list empty.
+     * Destroys all elements, leaving the list empty. The nodes stay in the pool for the next insertions.
      *
      * @complexity O(n), where n is the number of elements in the list.
      * @spacecomplexity O(1), as no extra space is used for clearing the list.
      */
     void clear()
     {
+        releaseNodes();
         mHead = nullptr;
         mTail = nullptr;
         mSize = 0;
     }
 
+    /**
+     * @return A copy of the allocator used for the nodes, rebound to T.
+     */
+    [[nodiscard]] Allocator getAllocator() const noexcept
+    {
+        return Allocator(mNodes.getAllocator());
+    }
+
 private:
+    /**
+     * @brief Take a node from the pool and construct it through the node allocator.
+     *
+     * @param item The value stored in the node.
+     * @return Pointer to the new node.
+     */
+    Node<T>* createNode(const T& item)
+    {
+        Node<T>* node = mNodes.allocate();
+        try
+        {
+            NodeAllocatorTraits::construct(mNodes.getAllocator(), node, item);
+        }
+        catch (...)
+        {
+            mNodes.deallocate(node);
+            throw;
+        }
+        return node;
+    }
+
+    /**
+     * @brief Destroy a node obtained with createNode() and give it back to the pool.
+     *
+     * @param node The node to release.
+     */
+    void destroyNode(Node<T>* node) noexcept
+    {
+        NodeAllocatorTraits::destroy(mNodes.getAllocator(), node);
+        mNodes.deallocate(node);
+    }
+
+    /**
+     * @return The node an iterator points to, null for end().
+     */
+    static Node<T>* getNode(const ListIterator<T>& position) noexcept
+    {
+        return position.mIsFinished ? nullptr : position.mNode;
+    }
+
+    /**
+     * @brief Link the chain of nodes from first to last before position, at the back if position is null.
+     */
+    void linkBefore(Node<T>* position, Node<T>* first, Node<T>* last) noexcept
+    {
+        Node<T>* previous = position != nullptr ? position->prev : mTail;
+        first->prev = previous;
+        last->next = position;
+        (previous != nullptr ? previous->next : mHead) = first;
+        (position != nullptr ? position->prev : mTail) = last;
+    }
+
+    /**
+     * @brief Unlink the chain of nodes from first to last, the nodes keep their own links.
+     */
+    void unlink(Node<T>* first, Node<T>* last) noexcept
+    {
+        (first->prev != nullptr ? first->prev->next : mHead) = last->next;
+        (last->next != nullptr ? last->next->prev : mTail) = first->prev;
+    }
+
+    /**
+     * @return True if the nodes of other can be released by the allocator of this list.
+     */
+    bool canTakeNodesOf(const List& other) const noexcept
+    {
+        if constexpr (NodeAllocatorTraits::is_always_equal::value)
+        {
+            return true;
+        }
+        else
+        {
+            return mNodes.getAllocator() == other.mNodes.getAllocator();
+        }
+    }
+
+    /**
+     * @brief Account for the nodes of other, already linked into this list, and take over the slabs holding them.
+     */
+    void takeNodesOf(List& other) noexcept
+    {
+        mSize += other.mSize;
+        mNodes.adopt(other.mNodes);
+
+        other.mHead = nullptr;
+        other.mTail = nullptr;
+        other.mSize = 0;
+    }
+
+    // A sorted chain of nodes being merged by sort(), its last next link is null
+    struct SortRun
+    {
+        Node<T>* head{nullptr};
+        Node<T>* tail{nullptr};
+    };
+    static constexpr int SORT_LEVELS = 64;  ///< Enough levels for 2^64 runs.
+
+    /**
+     * @brief Cut the ascending run starting at run.head off the chain, and set run.tail to its last node.
+     *
+     * @return The node following the run, null if the run reached the end of the chain.
+     */
+    template <typename Compare>
+    static Node<T>* cutRun(SortRun& run, Compare& compare)
+    {
+        Node<T>* tail = run.head;
+        while (tail->next != nullptr && !compare(tail->next->value, tail->value))
+        {
+            tail = tail->next;
+        }
+        Node<T>* next = tail->next;
+        tail->next = nullptr;
+        run.tail = tail;
+        return next;
+    }
+
+    /**
+     * @brief Merge two non-empty runs, the nodes of left come first among equal values.
+     */
+    template <typename Compare>
+    static SortRun mergeRuns(SortRun left, SortRun right, Compare& compare)
+    {
+        Node<T>* head = nullptr;
+        Node<T>** link = &head;
+        while (left.head != nullptr && right.head != nullptr)
+        {
+            Node<T>*& smallest = compare(right.head->value, left.head->value) ? right.head : left.head;
+            *link = smallest;
+            link = &smallest->next;
+            smallest = smallest->next;
+        }
+        if (left.head != nullptr)
+        {
+            *link = left.head;
+            return {head, left.tail};
+        }
+        *link = right.head;
+        return {head, right.tail};
+    }
+
+    /**
+     * @brief Destroy every node reachable from the head of the list, the nodes go back to the pool.
+     */
+    void releaseNodes() noexcept
+    {
+        // Start from the head of the list
+        Node<T>* current = mHead;
+        while (current != nullptr)
+        {
+            Node<T>* nextNode = current->next;
+            destroyNode(current);  // Give the current node back to the pool
+            current = nextNode;    // Move to the next node
+        }
+    }
+
     Node<T>* mHead{nullptr};  ///< Pointer to the head (first) node of the linked list.
     Node<T>* mTail{nullptr};  ///< Pointer to the tail (last) node of the linked list.
     std::size_t mSize{0};     ///< The size of the linked list (number of nodes).
+
+    Pool mNodes;  ///< The pool providing the nodes, it owns the allocator.
 };
+
+/**
+ * @brief List whose nodes come from a std::pmr::memory_resource.
+ */
+template <typename T, typename Access = DefaultAccess>
+using PmrList = List<T, std::pmr::polymorphic_allocator<T>, Access>;
@@ -0,0 +1,573 @@
+#pragma once
+
+#include <access-policy.hpp>
+#include <climits>           // for INT_MAX
+#include <cstddef>           // for std::size_t
+#include <cstdint>           // for std::uintptr_t
+#include <cstring>           // for std::memcpy, std::memmove
+#include <initializer_list>  // for std::initializer_list
+#include <new>               // for std::bad_alloc, placement new
+#include <stdexcept>         // for std::out_of_range
+#include <type_traits>       // for std::is_trivially_copyable_v
+#include <utility>           // for std::move, std::forward
+
+#include <sys/mman.h>  // for mmap, mprotect, madvise, munmap
+
+/**
+ * @brief A growable array for very large element counts whose storage never moves.
+ *
+ * On the first append a large range of virtual address space is reserved with mmap (PROT_NONE, nothing is
+ * committed yet) and transparent huge pages are requested for it with madvise(MADV_HUGEPAGE). Growing the array
+ * only commits more of that range with mprotect, so elements are never copied or relocated, pointers to them stay
+ * valid while the array grows, and the backing 2 MiB pages cut the TLB misses of random access. The interface
+ * mirrors DynamicArray, so it can back Stack/Queue and be used with the algorithm templates.
+ *
+ * @tparam T The type of elements in the array.
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
+ *
+ * @note Requires a POSIX system (mmap). Huge pages are only requested where MADV_HUGEPAGE exists (Linux).
+ */
+template <typename T, typename Access = DefaultAccess>
+class MappedDynamicArray
+{
+public:
+    using value_type = T;
+    using iterator = T*;
+
+    /**
+     * @brief Creates an empty array that can grow up to the given number of elements.
+     *
+     * No memory is reserved until the first element is added.
+     *
+     * @param maxCapacity The maximum number of elements, i.e. the size of the reserved address range (defaults to
+     * getDefaultMaxCapacity()).
+     */
+    explicit MappedDynamicArray(int maxCapacity = getDefaultMaxCapacity()) : mMaxCapacity(maxCapacity)
+    {
+    }
+
+    // Constructor to initialize with an initializer list
+    MappedDynamicArray(std::initializer_list<T> list) : MappedDynamicArray()
+    {
+        reserve(static_cast<int>(list.size()));
+        for (auto& item : list)
+        {
+            new (mData + mSize) T(item);
+            mSize++;
+        }
+    }
+
+    ~MappedDynamicArray()
+    {
+        destroyElements();
+        releaseMapping();
+    }
+
+    // Copy constructor
+    MappedDynamicArray(const MappedDynamicArray& other) : mMaxCapacity(other.mMaxCapacity)
+    {
+        copyElementsFrom(other);
+    }
+
+    // Copy assignment operator
+    MappedDynamicArray& operator=(const MappedDynamicArray& other)
+    {
+        if (this == &other)
+        {
+            return *this;  // Return *this to avoid self-assignment
+        }
+
+        destroyElements();
+        mSize = 0;
+        if (other.mMaxCapacity > mMaxCapacity)
+        {
+            releaseMapping();
+            mMaxCapacity = other.mMaxCapacity;
+        }
+        copyElementsFrom(other);
+
+        return *this;
+    }
+
+    // Move constructor, the mapping changes owner and no element is touched
+    MappedDynamicArray(MappedDynamicArray&& other) noexcept
+        : mSize(other.mSize),
+          mCapacity(other.mCapacity),
+          mMaxCapacity(other.mMaxCapacity),
+          mReservedBytes(other.mReservedBytes),
+          mData(other.mData)
+    {
+        other.resetToEmpty();
+    }
+
+    // Move assignment operator
+    MappedDynamicArray& operator=(MappedDynamicArray&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;  // Return *this to avoid self-assignment
+        }
+
+        destroyElements();
+        releaseMapping();
+
+        mSize = other.mSize;
+        mCapacity = other.mCapacity;
+        mMaxCapacity = other.mMaxCapacity;
+        mReservedBytes = other.mReservedBytes;
+        mData = other.mData;
+        other.resetToEmpty();
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element in the array.
+     *
+     * @return A pointer to the first element of the array.
+     */
+    iterator begin()
+    {
+        return mData;
+    }
+    iterator begin() const
+    {
+        return mData;
+    }
+
+    /**
+     * @brief Returns an iterator pointing past the last element in the array.
+     *
+     * @return A pointer to one past the last element of the array.
+     */
+    iterator end()
+    {
+        return mData + mSize;
+    }
+    iterator end() const
+    {
+        return mData + mSize;
+    }
+
+    /**
+     * @brief Direct access to the underlying storage, never bounds-checked.
+     *
+     * @return A pointer to the first element. It stays valid while the array grows.
+     */
+    T* data() noexcept
+    {
+        return mData;
+    }
+    const T* data() const noexcept
+    {
+        return mData;
+    }
+
+    /**
+     * @brief Access an element at the given index.
+     *
+     * @param index The index of the element to access.
+     * @return A reference to the element at the specified index.
+     *
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
+     *
+     * @complexity
+     * - Time Complexity: O(1) (direct array access).
+     * - Space Complexity: O(1) (no additional memory is used).
+     */
+    T& operator[](int index)
+    {
+        Access::checkIndex(index, mSize, "Index out of bounds in MappedDynamicArray::operator[]");
+        return mData[index];
+    }
+
+    /**
+     * @brief Access a constant element at the given index (const version).
+     *
+     * @param index The index of the element to access.
+     * @return A constant reference to the element at the specified index.
+     *
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
+     */
+    const T& operator[](int index) const
+    {
+        Access::checkIndex(index, mSize, "Index out of bounds in MappedDynamicArray::operator[]");
+        return mData[index];
+    }
+
+    /**
+     * @brief Compares two MappedDynamicArray objects for equality (same size and same elements).
+     *
+     * @param other The array to compare with the current array.
+     * @return True if the arrays are equal, false otherwise.
+     *
+     * @complexity
+     * - Time Complexity: O(n), where n is the size of the arrays.
+     * - Space Complexity: O(1).
+     */
+    bool operator==(const MappedDynamicArray& other) const
+    {
+        if (mSize != other.mSize)
+        {
+            return false;
+        }
+
+        for (int i = 0; i < mSize; ++i)
+        {
+            if (mData[i] != other.mData[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Append an item to the array.
+     *
+     * @param item The item to append to the array.
+     *
+     * @throws std::bad_alloc if the array is already at its maximum capacity or the memory cannot be mapped.
+     *
+     * @complexity
+     * - Time Complexity: O(1). Growing commits more pages but never copies elements.
+     * - Space Complexity: O(1).
+     */
+    void append(const T& item)
+    {
+        emplaceBack(item);
+    }
+
+    /**
+     * @brief Append an item to the array, moving it into place.
+     *
+     * @param item The item to move into the array.
+     */
+    void append(T&& item)
+    {
+        emplaceBack(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the end of the array.
+     *
+     * The existing elements never move, so arguments referring to elements of this array stay valid.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A reference to the newly constructed element.
+     *
+     * @throws std::bad_alloc if the array is already at its maximum capacity or the memory cannot be mapped.
+     */
+    template <typename... Args>
+    T& emplaceBack(Args&&... args)
+    {
+        if (mSize == mCapacity)
+        {
+            reserve(mSize + 1);
+        }
+
+        new (mData + mSize) T(std::forward<Args>(args)...);
+        mSize++;
+        return mData[mSize - 1];
+    }
+
+    /**
+     * @brief Insert an element at the specified position in the array.
+     *
+     * @param item The element to insert.
+     * @param pos The position at which the element should be inserted.
+     * @return iterator to the inserted value.
+     *
+     * @throws std::out_of_range if the position is out of bounds (less than 0 or greater than the current size).
+     *
+     * @complexity
+     * - Time Complexity: worse case O(n) (shifting all elements to the right).
+     * - Space Complexity: O(1).
+     */
+    iterator insert(const T& item, int pos)
+    {
+        if (pos < 0 || pos > mSize)
+        {
+            throw std::out_of_range("Index out of bounds in MappedDynamicArray::insert");
+        }
+
+        if (pos == mSize)
+        {
+            return &emplaceBack(item);
+        }
+
+        T value(item);  // The item may live inside this array, copy it before shifting
+        if (mSize == mCapacity)
+        {
+            reserve(mSize + 1);
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(mData + pos + 1, mData + pos, sizeof(T) * (mSize - pos));
+            new (mData + pos) T(std::move(value));
+        }
+        else
+        {
+            // The slot past the end is raw memory, so the last element is move-constructed into it
+            new (mData + mSize) T(std::move(mData[mSize - 1]));
+            for (int i = mSize - 1; i > pos; i--)
+            {
+                mData[i] = std::move(mData[i - 1]);
+            }
+            mData[pos] = std::move(value);
+        }
+        mSize++;
+
+        return &mData[pos];
+    }
+
+    /**
+     * @brief Erase an element from the array at the specified position.
+     *
+     * @param pos The index of the element to erase.
+     * @return iterator to the value after erased value.
+     *
+     * @throws std::out_of_range if the array is empty or the position is invalid.
+     *
+     * @complexity
+     * - Time Complexity: worst case O(n) for shifting elements after removal.
+     * - Space Complexity: O(1).
+     */
+    iterator erase(int pos)
+    {
+        if (isEmpty())
+        {
+            throw std::out_of_range("The array is empty in MappedDynamicArray::erase");
+        }
+
+        if (pos < 0 || pos >= mSize)
+        {
+            throw std::out_of_range("Index out of bounds in MappedDynamicArray::erase");
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(mData + pos, mData + pos + 1, sizeof(T) * (mSize - pos - 1));
+        }
+        else
+        {
+            for (int i = pos; i < mSize - 1; i++)
+            {
+                mData[i] = std::move(mData[i + 1]);
+            }
+            mData[mSize - 1].~T();
+        }
+        mSize--;
+
+        return &mData[pos];
+    }
+
+    /**
+     * @brief Get the size of the array (dynamic size).
+     *
+     * @return The total number of elements inside the array.
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Get the capacity of the array.
+     * @return The number of elements that fit in the pages committed so far.
+     */
+    [[nodiscard]] int getCapacity() const noexcept
+    {
+        return mCapacity;
+    }
+
+    /**
+     * @brief Get the maximum capacity of the array.
+     * @return The number of elements that fit in the reserved address range, the array cannot grow past it.
+     */
+    [[nodiscard]] int getMaxCapacity() const noexcept
+    {
+        return mMaxCapacity;
+    }
+
+    /**
+     * @brief Checks if the container has no elements.
+     *
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @return The default maximum capacity: 64 GiB of address space, capped to the int range of the indices.
+     */
+    [[nodiscard]] static constexpr int getDefaultMaxCapacity() noexcept
+    {
+        constexpr std::size_t defaultReservation = std::size_t{64} << 30;
+        constexpr std::size_t elements = defaultReservation / sizeof(T);
+        return elements < INT_MAX ? static_cast<int>(elements) : INT_MAX;
+    }
+
+    /**
+     * @return The granularity in bytes of the reservation and of every commit (the size of a huge page).
+     */
+    [[nodiscard]] static constexpr std::size_t getPageSize() noexcept
+    {
+        return std::size_t{2} << 20;
+    }
+
+private:
+    /**
+     * @brief Make sure the committed storage can hold at least the given number of elements.
+     *
+     * Reserves the address range on first use, then commits whole pages, at least doubling the committed size so
+     * the number of mprotect calls stays logarithmic. Committed pages only take physical memory once touched.
+     *
+     * @param capacity The requested capacity.
+     *
+     * @throws std::bad_alloc if capacity exceeds the maximum capacity or the memory cannot be mapped.
+     */
+    void reserve(int capacity)
+    {
+        if (capacity <= mCapacity)
+        {
+            return;
+        }
+        if (capacity > mMaxCapacity)
+        {
+            throw std::bad_alloc();
+        }
+        if (mData == nullptr)
+        {
+            mapReservation();
+        }
+
+        const std::size_t committedBytes = roundUpToPage(static_cast<std::size_t>(mCapacity) * sizeof(T));
+        std::size_t newCommittedBytes = roundUpToPage(static_cast<std::size_t>(capacity) * sizeof(T));
+        if (newCommittedBytes < committedBytes * 2)
+        {
+            newCommittedBytes = committedBytes * 2;
+        }
+        if (newCommittedBytes > mReservedBytes)
+        {
+            newCommittedBytes = mReservedBytes;
+        }
+
+        auto* base = reinterpret_cast<std::byte*>(mData);
+        if (mprotect(base + committedBytes, newCommittedBytes - committedBytes, PROT_READ | PROT_WRITE) != 0)
+        {
+            throw std::bad_alloc();
+        }
+
+        const std::size_t newCapacity = newCommittedBytes / sizeof(T);
+        mCapacity = newCapacity < static_cast<std::size_t>(mMaxCapacity) ? static_cast<int>(newCapacity)
+                                                                           : mMaxCapacity;
+    }
+
+    /**
+     * @brief Reserve the whole address range, aligned to a huge page, without committing any of it.
+     */
+    void mapReservation()
+    {
+        const std::size_t reservedBytes = roundUpToPage(static_cast<std::size_t>(mMaxCapacity) * sizeof(T));
+
+        // Map one page more than needed and trim both ends, so the range starts on a huge page boundary
+        const std::size_t mappedBytes = reservedBytes + getPageSize();
+        void* mapping = mmap(nullptr, mappedBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        auto* mapped = static_cast<std::byte*>(mapping);
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mapped);
+        auto* aligned = mapped + (roundUpToPage(address) - address);
+        if (aligned != mapped)
+        {
+            munmap(mapped, aligned - mapped);
+        }
+        const std::size_t tailBytes = (mapped + mappedBytes) - (aligned + reservedBytes);
+        if (tailBytes > 0)
+        {
+            munmap(aligned + reservedBytes, tailBytes);
+        }
+
+#ifdef MADV_HUGEPAGE
+        madvise(aligned, reservedBytes, MADV_HUGEPAGE);  // Only a hint, small pages are used if it fails
+#endif
+
+        mData = reinterpret_cast<T*>(aligned);
+        mReservedBytes = reservedBytes;
+    }
+
+    /**
+     * @brief Unmap the whole range. Elements must be destroyed beforehand.
+     */
+    void releaseMapping() noexcept
+    {
+        if (mData != nullptr)
+        {
+            munmap(mData, mReservedBytes);
+        }
+        resetToEmpty();
+    }
+
+    void resetToEmpty() noexcept
+    {
+        mSize = 0;
+        mCapacity = 0;
+        mReservedBytes = 0;
+        mData = nullptr;
+    }
+
+    void destroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (int i = 0; i < mSize; ++i)
+            {
+                mData[i].~T();
+            }
+        }
+    }
+
+    /**
+     * @brief Copy-construct the elements of other into this (empty) array.
+     */
+    void copyElementsFrom(const MappedDynamicArray& other)
+    {
+        reserve(other.mSize);
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (other.mSize > 0)
+            {
+                std::memcpy(mData, other.mData, sizeof(T) * other.mSize);
+            }
+            mSize = other.mSize;
+        }
+        else
+        {
+            for (int i = 0; i < other.mSize; ++i)
+            {
+                new (mData + i) T(other.mData[i]);
+                mSize++;
+            }
+        }
+    }
+
+    static constexpr std::size_t roundUpToPage(std::size_t bytes) noexcept
+    {
+        return (bytes + getPageSize() - 1) / getPageSize() * getPageSize();
+    }
+
+    int mSize{0};                   ///< Number of constructed elements.
+    int mCapacity{0};               ///< Number of elements that fit in the committed pages.
+    int mMaxCapacity;               ///< Number of elements that fit in the reserved range.
+    std::size_t mReservedBytes{0};  ///< Size of the reserved range, 0 until it is mapped.
+    T* mData{nullptr};              ///< Start of the reserved range, only the first mSize slots hold elements.
+};
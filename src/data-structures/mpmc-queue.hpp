@@ -0,0 +1,272 @@
+#pragma once
+
+#include <atomic>       // for std::atomic
+#include <cache-line.hpp>
+#include <cstddef>      // for std::byte, std::size_t
+#include <cstdint>      // for std::uint64_t, std::int64_t
+#include <memory>       // for std::unique_ptr
+#include <new>          // for std::launder, placement new
+#include <stdexcept>    // for std::invalid_argument
+#include <thread>       // for std::this_thread::yield
+#include <type_traits>  // for std::is_trivially_destructible_v
+#include <utility>      // for std::forward, std::move
+
+/**
+ * @brief A bounded lock-free FIFO queue for any number of producer and consumer threads.
+ *
+ * The elements live in a power-of-two ring of slots, each with a sequence number telling whose turn it is (Dmitry
+ * Vyukov's bounded MPMC queue). A producer claims the position of the tail counter with a compare-and-swap once the
+ * sequence of its slot says the slot is free for that lap, constructs the element, and publishes it by setting the
+ * sequence to position + 1. A consumer claims the head position once the sequence says the element of that lap is
+ * published, moves it out, and frees the slot for the next lap by setting the sequence to position + capacity.
+ *
+ * Producers only contend on the tail counter and consumers on the head counter, each on its own cache line. A slot
+ * is only written by the thread that claimed it, and its sequence number orders the element between the producer
+ * and the consumer (release store, acquire load).
+ *
+ * No operation waits for another thread, but a producer preempted between claiming its position and publishing the
+ * element makes the consumers see the queue as empty at that position until it resumes. getSize() and isEmpty() are
+ * approximate while threads run. The elements pushed by one producer are claimed in the order it pushed them.
+ *
+ * @tparam T The type of elements in the queue.
+ */
+template <typename T>
+class MpmcQueue
+{
+    /**
+     * @brief Storage of one element and the sequence number of its slot.
+     */
+    struct Slot
+    {
+        std::atomic<std::uint64_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+
+        T* get() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Construct an empty queue holding up to the given number of elements.
+     *
+     * @param capacity The number of elements the ring holds, rounded up to a power of two, at least 2: with a single
+     * slot the sequence of a published element would equal the one freeing the slot for the next lap.
+     *
+     * @throws std::invalid_argument if the capacity is not positive.
+     */
+    explicit MpmcQueue(int capacity)
+    {
+        if (capacity <= 0)
+        {
+            throw std::invalid_argument("MpmcQueue capacity must be positive");
+        }
+        while (mCapacity < static_cast<std::size_t>(capacity))
+        {
+            mCapacity *= 2;
+        }
+        mSlots = std::make_unique<Slot[]>(mCapacity);
+        for (std::size_t i = 0; i < mCapacity; ++i)
+        {
+            mSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpmcQueue()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            const std::uint64_t tail = mTail.load(std::memory_order_acquire);
+            for (std::uint64_t position = mHead.load(std::memory_order_acquire); position != tail; ++position)
+            {
+                Slot& slot = mSlots[position & (mCapacity - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) == position + 1)
+                {
+                    slot.get()->~T();
+                }
+            }
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * @brief Construct an element at the back of the queue if there is room.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return True if the element was pushed, false if the queue is full.
+     *
+     * @complexity O(1) expected, lock-free: a failed compare-and-swap means another producer pushed.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args)
+    {
+        std::uint64_t position = mTail.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot& slot = mSlots[position & (mCapacity - 1)];
+            const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto lap = static_cast<std::int64_t>(sequence - position);
+            if (lap == 0)
+            {
+                // The slot is free for this lap, claim the position
+                if (mTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        new (slot.storage) T(std::forward<Args>(args)...);
+                    }
+                    catch (...)
+                    {
+                        // The position is taken, it is released as a hole the consumers skip
+                        slot.sequence.store(position + 1 + HOLE, std::memory_order_release);
+                        throw;
+                    }
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (lap < 0)
+            {
+                return false;  // The slot still holds the element of the previous lap: the queue is full
+            }
+            else
+            {
+                position = mTail.load(std::memory_order_relaxed);  // Another producer took the position
+            }
+        }
+    }
+
+    /**
+     * @brief Push an element if there is room.
+     *
+     * @return True if the element was pushed, false if the queue is full.
+     */
+    bool tryPush(const T& value)
+    {
+        return tryEmplace(value);
+    }
+    bool tryPush(T&& value)
+    {
+        return tryEmplace(std::move(value));
+    }
+
+    /**
+     * @brief Push an element, waiting for a consumer while the queue is full.
+     */
+    void push(const T& value)
+    {
+        while (!tryEmplace(value))
+        {
+            std::this_thread::yield();
+        }
+    }
+    void push(T&& value)
+    {
+        while (!tryEmplace(std::move(value)))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Move the front element out and remove it if the queue is not empty.
+     *
+     * @param value Where the element is moved to.
+     * @return True if an element was popped, false if the queue is empty.
+     *
+     * @complexity O(1) expected, lock-free: a failed compare-and-swap means another consumer popped.
+     */
+    bool tryPop(T& value)
+    {
+        std::uint64_t position = mHead.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot& slot = mSlots[position & (mCapacity - 1)];
+            const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto lap = static_cast<std::int64_t>((sequence & ~HOLE) - (position + 1));
+            if (lap == 0)
+            {
+                // The element of this lap is published, claim the position
+                if (mHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    const bool hole = (sequence & HOLE) != 0;
+                    if (!hole)
+                    {
+                        T* element = slot.get();
+                        value = std::move(*element);
+                        element->~T();
+                    }
+                    slot.sequence.store(position + mCapacity, std::memory_order_release);
+                    if (!hole)
+                    {
+                        return true;
+                    }
+                    position = mHead.load(std::memory_order_relaxed);
+                }
+            }
+            else if (lap < 0)
+            {
+                return false;  // The element of this lap is not pushed yet: the queue is empty
+            }
+            else
+            {
+                position = mHead.load(std::memory_order_relaxed);  // Another consumer took the position
+            }
+        }
+    }
+
+    /**
+     * @brief Pop the front element, waiting for a producer while the queue is empty.
+     *
+     * @param value Where the element is moved to.
+     */
+    void pop(T& value)
+    {
+        while (!tryPop(value))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @return The number of elements, exact only when no thread is running an operation (a push that threw counts
+     * until a consumer skips its position).
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        const std::uint64_t head = mHead.load(std::memory_order_acquire);
+        const std::uint64_t tail = mTail.load(std::memory_order_acquire);
+        return tail > head ? static_cast<int>(tail - head) : 0;
+    }
+
+    /**
+     * @return True if the queue looked empty, exact only when no thread is running an operation.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return getSize() == 0;
+    }
+
+    /**
+     * @return The largest number of elements the queue holds, a power of two.
+     */
+    [[nodiscard]] int getCapacity() const noexcept
+    {
+        return static_cast<int>(mCapacity);
+    }
+
+private:
+    // Set in the sequence of a slot whose producer threw while constructing the element
+    static constexpr std::uint64_t HOLE = std::uint64_t{1} << 63;
+
+    std::size_t mCapacity{2};        ///< The number of slots, a power of two, at least 2.
+    std::unique_ptr<Slot[]> mSlots;  ///< The ring.
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> mTail{0};  ///< The next position to push to.
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> mHead{0};  ///< The next position to pop from.
+};
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <atomic>     // for std::atomic
+#include <cache-line.hpp>
+#include <cstddef>    // for std::size_t
+#include <cstdint>    // for std::uint64_t
+#include <heap.hpp>
+#include <memory>     // for std::unique_ptr, std::make_unique
+#include <mutex>      // for std::mutex, std::unique_lock, std::try_to_lock
+#include <stdexcept>  // for std::invalid_argument
+
+/**
+ * @brief A relaxed priority queue for any number of threads (a MultiQueue): tryPop() returns one of the smallest
+ * elements, not always the smallest.
+ *
+ * A single MinHeap under a lock serializes every thread. The MultiQueue spreads the elements over c * P MinHeaps,
+ * P being the number of threads and c a small constant, each with its own lock:
+ * - push() inserts into a random heap.
+ * - tryPop() looks at two random heaps and takes the smaller of their tops.
+ * Locks are only taken with try_lock(): a thread finding a heap busy picks other random heaps instead of waiting, so
+ * with c * P heaps for P threads most attempts succeed at once and no thread waits behind a preempted one.
+ *
+ * Rank error: the rank of a popped element is the number of elements in the queue smaller than it, 0 for an exact
+ * priority queue. With n = c * P heaps filled and emptied at random, the choice of the better of two tops keeps the
+ * heaps balanced (the "power of two choices"): the expected rank of a popped element is O(n) and its rank is
+ * O(n log n) with high probability, independently of the number of elements (Rihani, Sanders and Dementiev 2015;
+ * Alistarh et al. 2017). A busy heap makes the thread draw a new pair, which keeps the choice uniform. Taking the top
+ * of one random heap instead would let the rank grow without bound over time. A larger c lowers contention and
+ * raises the rank error in proportion. The bounds assume locks are held briefly: when threads outnumber cores, a
+ * thread preempted while holding a lock hides its heap from the others for a whole time slice, and the elements of
+ * that heap fall behind by the number of pops made meanwhile.
+ *
+ * Each heap keeps its size in an atomic, so empty heaps are skipped without locking them. tryPop() only reports the
+ * queue empty after visiting every heap under its lock: it misses no element pushed before it started and not taken
+ * by another thread, but may miss one pushed meanwhile into a heap it already visited. getSize() and isEmpty() are
+ * approximate while threads run. Equal elements come out in no particular order.
+ *
+ * @tparam T The type of elements, ordered by operator< like the elements of MinHeap.
+ */
+template <typename T>
+class MultiQueue
+{
+    /**
+     * @brief One sequential heap with its lock, on its own cache lines.
+     */
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+        std::mutex mutex;
+        MinHeap<T> heap;
+        std::atomic<int> size{0};  ///< The size of the heap, written under the lock and read without it.
+    };
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Construct an empty queue for the given number of threads.
+     *
+     * @param threadCount The number of threads expected to use the queue at once.
+     * @param queuesPerThread The number c of heaps per thread, 2 by default.
+     *
+     * @throws std::invalid_argument if threadCount or queuesPerThread is not positive.
+     */
+    explicit MultiQueue(int threadCount, int queuesPerThread = 2)
+    {
+        if (threadCount <= 0 || queuesPerThread <= 0)
+        {
+            throw std::invalid_argument("MultiQueue thread count and queues per thread must be positive");
+        }
+        mQueueCount = threadCount * queuesPerThread > 1 ? threadCount * queuesPerThread : 2;
+        mShards = std::make_unique<Shard[]>(mQueueCount);
+    }
+
+    MultiQueue(const MultiQueue&) = delete;
+    MultiQueue& operator=(const MultiQueue&) = delete;
+
+    /**
+     * @brief Insert an element into a random heap. Safe to call from any number of threads.
+     *
+     * @complexity O(log m) for heaps of m elements, plus one attempt per busy heap met.
+     */
+    void push(const T& value)
+    {
+        for (;;)
+        {
+            Shard& shard = mShards[nextRandom() % mQueueCount];
+            std::unique_lock<std::mutex> lock(shard.mutex, std::try_to_lock);
+            if (lock.owns_lock())
+            {
+                shard.heap.insert(value);
+                shard.size.store(shard.heap.getSize(), std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Take the smaller of the tops of two random heaps. Safe to call from any number of threads.
+     *
+     * Pairs of empty heaps are drawn again; after as many empty pairs as there are heaps, every heap is visited in
+     * turn, waiting for its lock, and the first element found is taken.
+     *
+     * @param value Where the element is copied to.
+     * @return True if an element was taken, false if every heap was empty when visited.
+     *
+     * @complexity O(log m) for heaps of m elements, plus one attempt per busy or empty pair met.
+     */
+    bool tryPop(T& value)
+    {
+        for (int emptyPairs = 0; emptyPairs < mQueueCount;)
+        {
+            const std::uint64_t random = nextRandom();
+            Shard& first = mShards[random % mQueueCount];
+            Shard& second = mShards[(random % mQueueCount + 1 + (random >> 32) % (mQueueCount - 1)) % mQueueCount];
+            if (first.size.load(std::memory_order_relaxed) == 0 && second.size.load(std::memory_order_relaxed) == 0)
+            {
+                ++emptyPairs;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> firstLock(first.mutex, std::try_to_lock);
+            if (!firstLock.owns_lock())
+            {
+                continue;
+            }
+            std::unique_lock<std::mutex> secondLock(second.mutex, std::try_to_lock);
+            if (!secondLock.owns_lock())
+            {
+                continue;
+            }
+
+            Shard* best = &first;
+            if (first.heap.isEmpty() || (!second.heap.isEmpty() && second.heap.top() < first.heap.top()))
+            {
+                best = &second;
+            }
+            if (best->heap.isEmpty())
+            {
+                ++emptyPairs;
+                continue;
+            }
+            popFrom(*best, value);
+            return true;
+        }
+
+        const std::size_t start = nextRandom() % mQueueCount;
+        for (int i = 0; i < mQueueCount; ++i)
+        {
+            Shard& shard = mShards[(start + i) % mQueueCount];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (!shard.heap.isEmpty())
+            {
+                popFrom(shard, value);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @return The number of elements, exact only when no thread is running an operation.
+     *
+     * @complexity O(c * P).
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        int size = 0;
+        for (int i = 0; i < mQueueCount; ++i)
+        {
+            size += mShards[i].size.load(std::memory_order_relaxed);
+        }
+        return size;
+    }
+
+    /**
+     * @return True if the queue looked empty, exact only when no thread is running an operation.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return getSize() == 0;
+    }
+
+    /**
+     * @return The number of heaps, c * P (at least 2).
+     */
+    [[nodiscard]] int getQueueCount() const noexcept
+    {
+        return mQueueCount;
+    }
+
+private:
+    // Copy the top of a locked heap out, then pop it
+    static void popFrom(Shard& shard, T& value)
+    {
+        value = shard.heap.top();
+        shard.heap.pop();
+        shard.size.store(shard.heap.getSize(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief The next number of the xorshift generator of the calling thread, seeded differently for every thread.
+     */
+    static std::uint64_t nextRandom() noexcept
+    {
+        std::uint64_t& state = sRandomState;
+        if (state == 0)
+        {
+            state = sSeeds.fetch_add(0x9E3779B97F4A7C15, std::memory_order_relaxed) | 1;
+        }
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    std::unique_ptr<Shard[]> mShards;
+    int mQueueCount{0};
+
+    static inline std::atomic<std::uint64_t> sSeeds{0x2545F4914F6CDD1D};  ///< The seed of the next thread.
+    static inline thread_local std::uint64_t sRandomState = 0;             ///< The generator of the calling thread.
+};
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>  // for std::min, std::max
+#include <cstddef>    // for std::size_t
+#include <memory>     // for std::allocator, std::allocator_traits
+#include <utility>    // for std::exchange
+
+/**
+ * @brief A slab pool handing out storage for the nodes of one node based container.
+ *
+ * Nodes are carved out of slabs obtained from the allocator, a released node goes to a free list and is handed out
+ * again by the next allocate(), so a container whose size stays bounded (e.g. a queue that is pushed and popped)
+ * stops calling the allocator after it warmed up. The slabs only go back to the allocator, all at once, with
+ * release() or when the pool is destroyed.
+ *
+ * The pool only manages storage: allocate() returns uninitialized memory for one NodeType, the container constructs
+ * and destroys the node itself.
+ *
+ * @tparam NodeType The type of the nodes, it must be at least as large and as aligned as a pointer.
+ * @tparam Allocator The allocator of the slabs, rebound to NodeType (defaults to std::allocator<NodeType>).
+ */
+template <typename NodeType, typename Allocator = std::allocator<NodeType>>
+class NodePool
+{
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<NodeType>;
+    using SlotAllocatorTraits = std::allocator_traits<SlotAllocator>;
+
+    // A released node holds the link to the next free node, the first slots of a slab the link to the next slab
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+    struct SlabHeader
+    {
+        SlabHeader* next;
+        std::size_t slots;  ///< Number of slots of the slab, header included.
+    };
+
+    static_assert(sizeof(NodeType) >= sizeof(FreeSlot) && alignof(NodeType) >= alignof(FreeSlot),
+                  "A node must be able to hold a pointer while it is free.");
+    static_assert(alignof(NodeType) >= alignof(SlabHeader), "A node must be aligned like a pointer.");
+
+public:
+    using allocator_type = SlotAllocator;
+
+    static constexpr std::size_t FIRST_SLAB_SIZE = 8;   ///< Nodes in the first slab.
+    static constexpr std::size_t MAX_SLAB_SIZE = 1024;  ///< Slabs double in size until they hold this many nodes.
+
+    NodePool() = default;
+
+    /**
+     * @brief Constructs an empty pool whose slabs come from the given allocator.
+     *
+     * @param allocator The allocator of the slabs.
+     */
+    explicit NodePool(const SlotAllocator& allocator) : mAllocator(allocator)
+    {
+    }
+
+    /**
+     * @brief Takes over the slabs and the free nodes of the other pool, which is left empty.
+     */
+    NodePool(NodePool&& other) noexcept
+        : mSlabs(std::exchange(other.mSlabs, nullptr)),
+          mSlabsTail(std::exchange(other.mSlabsTail, nullptr)),
+          mFree(std::exchange(other.mFree, nullptr)),
+          mFreeTail(std::exchange(other.mFreeTail, nullptr)),
+          mBump(std::exchange(other.mBump, nullptr)),
+          mBumpEnd(std::exchange(other.mBumpEnd, nullptr)),
+          mNextSlabSize(std::exchange(other.mNextSlabSize, FIRST_SLAB_SIZE)),
+          mAllocator(std::move(other.mAllocator))
+    {
+    }
+
+    // The nodes of a container live in its pool, the containers decide how their pools are transferred
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    NodePool& operator=(NodePool&&) = delete;
+
+    ~NodePool()
+    {
+        release();
+    }
+
+    /**
+     * @brief Get storage for one node, a previously released node if there is one.
+     *
+     * @return Uninitialized storage for a NodeType.
+     *
+     * @complexity
+     * - Time Complexity: O(1), plus one call to the allocator when a new slab is needed.
+     * - Space Complexity: O(1) amortized.
+     */
+    NodeType* allocate()
+    {
+        if (mFree != nullptr)
+        {
+            FreeSlot* slot = mFree;
+            mFree = slot->next;
+            return reinterpret_cast<NodeType*>(slot);
+        }
+        if (mBump == mBumpEnd)
+        {
+            addSlab();
+        }
+        return mBump++;
+    }
+
+    /**
+     * @brief Give the storage of a node, already destroyed, back to the pool.
+     *
+     * @param node Storage obtained from allocate() of this pool.
+     *
+     * @complexity O(1), the memory stays in the pool.
+     */
+    void deallocate(NodeType* node) noexcept
+    {
+        auto* slot = reinterpret_cast<FreeSlot*>(node);
+        slot->next = mFree;
+        if (mFree == nullptr)
+        {
+            mFreeTail = slot;
+        }
+        mFree = slot;
+    }
+
+    /**
+     * @brief Return every slab to the allocator. All the nodes must have been destroyed.
+     *
+     * @complexity O(s), where s is the number of slabs.
+     */
+    void release() noexcept
+    {
+        while (mSlabs != nullptr)
+        {
+            SlabHeader* slab = mSlabs;
+            mSlabs = slab->next;
+            SlotAllocatorTraits::deallocate(mAllocator, reinterpret_cast<NodeType*>(slab), slab->slots);
+        }
+        reset();
+    }
+
+    /**
+     * @brief Take over every slab of the other pool, with the nodes still in use, which now belong to this pool.
+     *
+     * Lets a container relink the nodes of another container into itself, as List::splice() and List::merge() do:
+     * the slabs holding them must live as long as this pool. The other pool is left empty. The allocators must
+     * compare equal.
+     *
+     * @param other The pool whose slabs are taken over.
+     *
+     * @complexity O(1), plus threading the never used slots of the current slab of other into the free list
+     * (at most MAX_SLAB_SIZE).
+     */
+    void adopt(NodePool& other) noexcept
+    {
+        if (other.mSlabs == nullptr || &other == this)
+        {
+            return;
+        }
+
+        other.mSlabsTail->next = mSlabs;
+        if (mSlabs == nullptr)
+        {
+            mSlabsTail = other.mSlabsTail;
+        }
+        mSlabs = other.mSlabs;
+
+        if (other.mFree != nullptr)
+        {
+            other.mFreeTail->next = mFree;
+            if (mFree == nullptr)
+            {
+                mFreeTail = other.mFreeTail;
+            }
+            mFree = other.mFree;
+        }
+
+        if (mBump == mBumpEnd)
+        {
+            mBump = other.mBump;
+            mBumpEnd = other.mBumpEnd;
+        }
+        else
+        {
+            while (other.mBump != other.mBumpEnd)
+            {
+                deallocate(other.mBump++);
+            }
+        }
+        mNextSlabSize = std::max(mNextSlabSize, other.mNextSlabSize);
+
+        other.mSlabs = nullptr;
+        other.reset();
+    }
+
+    /**
+     * @brief Exchange the slabs and the free nodes of two pools, not their allocators.
+     *
+     * The allocators must compare equal, or the caller exchanges them as well (see swapAllocators()).
+     *
+     * @param other The pool to exchange the nodes with.
+     */
+    void swapNodes(NodePool& other) noexcept
+    {
+        std::swap(mSlabs, other.mSlabs);
+        std::swap(mSlabsTail, other.mSlabsTail);
+        std::swap(mFree, other.mFree);
+        std::swap(mFreeTail, other.mFreeTail);
+        std::swap(mBump, other.mBump);
+        std::swap(mBumpEnd, other.mBumpEnd);
+        std::swap(mNextSlabSize, other.mNextSlabSize);
+    }
+
+    /**
+     * @brief Exchange the allocators of two pools.
+     *
+     * @param other The pool to exchange the allocator with.
+     */
+    void swapAllocators(NodePool& other) noexcept
+    {
+        using std::swap;
+        swap(mAllocator, other.mAllocator);
+    }
+
+    /**
+     * @return The allocator of the slabs, also used by the containers to construct their nodes.
+     */
+    [[nodiscard]] SlotAllocator& getAllocator() noexcept
+    {
+        return mAllocator;
+    }
+    [[nodiscard]] const SlotAllocator& getAllocator() const noexcept
+    {
+        return mAllocator;
+    }
+
+    /**
+     * @brief Get the number of nodes the pool can hold without allocating.
+     *
+     * @return The number of node slots of all slabs.
+     *
+     * @complexity O(s), where s is the number of slabs.
+     */
+    [[nodiscard]] std::size_t getCapacity() const noexcept
+    {
+        std::size_t capacity = 0;
+        for (const SlabHeader* slab = mSlabs; slab != nullptr; slab = slab->next)
+        {
+            capacity += slab->slots - HEADER_SLOTS;
+        }
+        return capacity;
+    }
+
+private:
+    static constexpr std::size_t HEADER_SLOTS = (sizeof(SlabHeader) + sizeof(NodeType) - 1) / sizeof(NodeType);
+
+    // Forget the free nodes and the current slab, the slabs themselves are released or taken over by the caller
+    void reset() noexcept
+    {
+        mSlabsTail = nullptr;
+        mFree = nullptr;
+        mFreeTail = nullptr;
+        mBump = nullptr;
+        mBumpEnd = nullptr;
+        mNextSlabSize = FIRST_SLAB_SIZE;
+    }
+
+    void addSlab()
+    {
+        const std::size_t slots = HEADER_SLOTS + mNextSlabSize;
+        NodeType* memory = SlotAllocatorTraits::allocate(mAllocator, slots);
+
+        auto* slab = reinterpret_cast<SlabHeader*>(memory);
+        slab->next = mSlabs;
+        slab->slots = slots;
+        if (mSlabs == nullptr)
+        {
+            mSlabsTail = slab;
+        }
+        mSlabs = slab;
+
+        mBump = memory + HEADER_SLOTS;
+        mBumpEnd = memory + slots;
+        mNextSlabSize = std::min(mNextSlabSize * 2, MAX_SLAB_SIZE);
+    }
+
+    SlabHeader* mSlabs{nullptr};                 ///< Every slab of the pool, most recent first.
+    SlabHeader* mSlabsTail{nullptr};             ///< The oldest slab, the end of the slab chain.
+    FreeSlot* mFree{nullptr};                    ///< Released nodes, reused first.
+    FreeSlot* mFreeTail{nullptr};                ///< The last released node while there are free nodes.
+    NodeType* mBump{nullptr};                    ///< Next never used slot of the current slab.
+    NodeType* mBumpEnd{nullptr};                 ///< End of the current slab.
+    std::size_t mNextSlabSize{FIRST_SLAB_SIZE};  ///< Number of nodes of the next slab.
+
+    [[no_unique_address]] SlotAllocator mAllocator;  ///< The allocator providing the slabs.
+};
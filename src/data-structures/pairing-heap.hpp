@@ -0,0 +1,484 @@
+#pragma once
+
+#include <functional>   // for std::less
+#include <memory>       // for std::allocator, std::allocator_traits
+#include <node-pool.hpp>
+#include <stdexcept>    // for std::out_of_range, std::invalid_argument
+#include <type_traits>  // for std::is_trivially_destructible_v
+#include <utility>      // for std::move, std::forward, std::exchange, std::in_place_t
+#include <vector>
+
+/**
+ * @brief A node of a PairingHeap, linked to its first child and to its siblings.
+ *
+ * prev is the previous sibling, or the parent for a first child, so a node can be cut out of the tree in O(1).
+ *
+ * @tparam T The type of the value.
+ */
+template <typename T>
+struct PairingNode
+{
+    T value;                      ///< The value of the node.
+    PairingNode* child{nullptr};  ///< The first child, null for a leaf.
+    PairingNode* next{nullptr};   ///< The next sibling, null for the last child and for the root.
+    PairingNode* prev{nullptr};   ///< The previous sibling, the parent for a first child, null for the root.
+
+    template <typename... Args>
+    explicit PairingNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...)
+    {
+    }
+};
+
+/**
+ * @brief A priority queue stored as a pairing heap: a tree where every node comes after or with its parent, and
+ * whose root is the first element in the order of Compare.
+ *
+ * Two trees are joined by making the root that comes second the first child of the other, in O(1). insert() joins a
+ * single node with the root and meld() joins the roots of two heaps, both in O(1). pop() removes the root and joins
+ * its children in two passes, first by pairs from left to right, then from right to left, which keeps the tree
+ * shallow: O(log n) amortized. decreaseKey() cuts the subtree of an element from its parent and joins it with the
+ * root, O(1) actual and o(log n) amortized.
+ *
+ * insert() returns a Handle to the element, valid until the element is popped or erased, to decrease or erase it
+ * later. Like the nodes of a List, the nodes come from a NodePool: meld() takes over the pool of the other heap, so
+ * the handles of its elements stay valid and now refer to this heap, as long as the allocators compare equal.
+ *
+ * @tparam T The type of elements in the heap.
+ * @tparam Compare The strict weak ordering; the first element in that order is on top.
+ * @tparam Allocator The allocator of the node slabs, rebound to PairingNode<T>.
+ */
+template <typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+class PairingHeap
+{
+    using Node = PairingNode<T>;
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+    using Pool = NodePool<Node, Allocator>;
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief A reference to an element of the heap, to decrease or erase it.
+     */
+    class Handle
+    {
+    public:
+        Handle() = default;
+
+        const T& operator*() const
+        {
+            return mNode->value;
+        }
+        const T* operator->() const
+        {
+            return &mNode->value;
+        }
+
+        bool operator==(const Handle& other) const noexcept = default;
+
+    private:
+        friend class PairingHeap;
+
+        explicit Handle(Node* node) noexcept : mNode(node)
+        {
+        }
+
+        Node* mNode{nullptr};
+    };
+
+    PairingHeap() = default;
+
+    /**
+     * @brief Construct an empty heap with the given ordering and allocator.
+     */
+    explicit PairingHeap(const Compare& compare, const Allocator& allocator = Allocator())
+        : mNodes(NodeAllocator(allocator)), mCompare(compare)
+    {
+    }
+
+    /**
+     * @brief Take over the elements of the other heap, which is left empty. Handles stay valid.
+     */
+    PairingHeap(PairingHeap&& other) noexcept
+        : mNodes(std::move(other.mNodes)),
+          mRoot(std::exchange(other.mRoot, nullptr)),
+          mSize(std::exchange(other.mSize, 0)),
+          mCompare(other.mCompare)
+    {
+    }
+
+    // Handles point into the nodes, a copy would not have its own handles
+    PairingHeap(const PairingHeap&) = delete;
+    PairingHeap& operator=(const PairingHeap&) = delete;
+    PairingHeap& operator=(PairingHeap&&) = delete;
+
+    // Destroy the elements, the pool then returns all the nodes to the allocator at once
+    ~PairingHeap()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            forEachNode([this](Node* node) { NodeAllocatorTraits::destroy(mNodes.getAllocator(), node); });
+        }
+    }
+
+    /**
+     * @return The element on top of the heap.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(1).
+     */
+    [[nodiscard]] const T& top() const
+    {
+        if (mRoot == nullptr)
+        {
+            throw std::out_of_range("The heap is empty in PairingHeap::top");
+        }
+        return mRoot->value;
+    }
+
+    /**
+     * @brief Construct an element and join it with the root.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A handle to the element.
+     *
+     * @complexity O(1).
+     */
+    template <typename... Args>
+    Handle emplace(Args&&... args)
+    {
+        Node* node = createNode(std::forward<Args>(args)...);
+        mRoot = mRoot != nullptr ? link(mRoot, node) : node;
+        ++mSize;
+        return Handle(node);
+    }
+
+    /**
+     * @brief Insert an element.
+     *
+     * @return A handle to the element, valid until it is popped or erased.
+     *
+     * @complexity O(1).
+     */
+    Handle insert(const T& value)
+    {
+        return emplace(value);
+    }
+    Handle insert(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /**
+     * @brief Remove the element on top of the heap. Does nothing if the heap is empty, like MinHeap::pop().
+     *
+     * @complexity O(log n) amortized: the children of the root are joined in two passes.
+     */
+    void pop()
+    {
+        if (mRoot == nullptr)
+        {
+            return;
+        }
+        Node* root = mRoot;
+        mRoot = combineSiblings(root->child);
+        destroyNode(root);
+        --mSize;
+    }
+
+    /**
+     * @brief Give an element a value that does not come after its current value.
+     *
+     * @param handle A handle to an element of the heap.
+     * @param value The new value.
+     *
+     * @throws std::invalid_argument if the new value comes after the current one.
+     *
+     * @complexity O(1) actual, o(log n) amortized.
+     */
+    void decreaseKey(Handle handle, T value)
+    {
+        Node* node = handle.mNode;
+        if (mCompare(node->value, value))
+        {
+            throw std::invalid_argument("The new value comes after the current value in PairingHeap::decreaseKey");
+        }
+        node->value = std::move(value);
+        if (node != mRoot)
+        {
+            cut(node);
+            mRoot = link(mRoot, node);
+        }
+    }
+
+    /**
+     * @brief Remove an element from anywhere in the heap.
+     *
+     * The subtree of the element is cut out, its children are joined as in pop() and the result is joined with the
+     * root.
+     *
+     * @param handle A handle to an element of the heap, invalid afterwards.
+     *
+     * @complexity O(log n) amortized.
+     */
+    void erase(Handle handle)
+    {
+        Node* node = handle.mNode;
+        if (node == mRoot)
+        {
+            pop();
+            return;
+        }
+        cut(node);
+        if (Node* children = combineSiblings(node->child))
+        {
+            mRoot = link(mRoot, children);
+        }
+        destroyNode(node);
+        --mSize;
+    }
+
+    /**
+     * @brief Move every element of the other heap into this one, leaving it empty.
+     *
+     * The two roots are joined and this heap takes over the pool of the other one, so no element is copied and the
+     * handles of the other heap stay valid for this one. If the allocators of the heaps differ the elements are moved
+     * one by one into new nodes instead, and the handles of the other heap become invalid.
+     *
+     * @complexity O(1), plus O(s) for the s slabs of the other pool, when the allocators are equal. O(m log m)
+     * amortized otherwise, where m is the size of other.
+     */
+    void meld(PairingHeap& other)
+    {
+        if (&other == this || other.mRoot == nullptr)
+        {
+            return;
+        }
+        if (!canTakeNodesOf(other))
+        {
+            while (other.mRoot != nullptr)
+            {
+                emplace(std::move(other.mRoot->value));
+                other.pop();
+            }
+            return;
+        }
+        mNodes.adopt(other.mNodes);
+        mRoot = mRoot != nullptr ? link(mRoot, other.mRoot) : other.mRoot;
+        mSize += other.mSize;
+        other.mRoot = nullptr;
+        other.mSize = 0;
+    }
+
+    /**
+     * @brief Remove every element. The nodes stay in the pool for the next insertions.
+     *
+     * @complexity O(n).
+     */
+    void clear() noexcept
+    {
+        forEachNode([this](Node* node) { destroyNode(node); });
+        mRoot = nullptr;
+        mSize = 0;
+    }
+
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mSize;
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mRoot == nullptr;
+    }
+
+    /**
+     * @return The elements in preorder: the top first, then the subtree of each child in turn.
+     */
+    std::vector<T> toVector() const
+    {
+        std::vector<T> out;
+        out.reserve(mSize);
+        std::vector<const Node*> pending;
+        if (mRoot != nullptr)
+        {
+            pending.push_back(mRoot);
+        }
+        while (!pending.empty())
+        {
+            const Node* node = pending.back();
+            pending.pop_back();
+            out.push_back(node->value);
+            if (node->next != nullptr)
+            {
+                pending.push_back(node->next);
+            }
+            if (node->child != nullptr)
+            {
+                pending.push_back(node->child);
+            }
+        }
+        return out;
+    }
+
+private:
+    /**
+     * @return True if the nodes of other can be released by the allocator of this heap.
+     */
+    bool canTakeNodesOf(const PairingHeap& other) const noexcept
+    {
+        if constexpr (NodeAllocatorTraits::is_always_equal::value)
+        {
+            return true;
+        }
+        else
+        {
+            return mNodes.getAllocator() == other.mNodes.getAllocator();
+        }
+    }
+
+    template <typename... Args>
+    Node* createNode(Args&&... args)
+    {
+        Node* node = mNodes.allocate();
+        try
+        {
+            NodeAllocatorTraits::construct(mNodes.getAllocator(), node, std::in_place, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            mNodes.deallocate(node);
+            throw;
+        }
+        return node;
+    }
+
+    void destroyNode(Node* node) noexcept
+    {
+        NodeAllocatorTraits::destroy(mNodes.getAllocator(), node);
+        mNodes.deallocate(node);
+    }
+
+    /**
+     * @brief Join two roots: the one that comes second becomes the first child of the other, which is returned.
+     *
+     * The sibling links of the returned root are left to the caller.
+     */
+    Node* link(Node* first, Node* second) noexcept
+    {
+        if (mCompare(second->value, first->value))
+        {
+            std::swap(first, second);
+        }
+        second->prev = first;
+        second->next = first->child;
+        if (first->child != nullptr)
+        {
+            first->child->prev = second;
+        }
+        first->child = second;
+        return first;
+    }
+
+    /**
+     * @brief Unlink a node that is not the root, with its subtree, from its parent and siblings.
+     */
+    static void cut(Node* node) noexcept
+    {
+        if (node->prev->child == node)
+        {
+            node->prev->child = node->next;  // A first child: prev is the parent
+        }
+        else
+        {
+            node->prev->next = node->next;
+        }
+        if (node->next != nullptr)
+        {
+            node->next->prev = node->prev;
+        }
+        node->next = nullptr;
+        node->prev = nullptr;
+    }
+
+    /**
+     * @brief Join a list of siblings into one tree, in two passes.
+     *
+     * The first pass links the siblings by pairs from left to right and stacks the results through their next link,
+     * so the second pass, which links each result into the accumulated tree, goes from right to left. Neither pass
+     * recurses, so a long list of children does not exhaust the stack.
+     *
+     * @param first The first sibling, null for none.
+     * @return The root of the joined tree, null if there were no siblings.
+     */
+    Node* combineSiblings(Node* first) noexcept
+    {
+        if (first == nullptr)
+        {
+            return nullptr;
+        }
+
+        Node* pairs = nullptr;
+        while (first != nullptr)
+        {
+            Node* second = first->next;
+            if (second == nullptr)
+            {
+                first->next = pairs;
+                pairs = first;
+                break;
+            }
+            Node* rest = second->next;
+            Node* joined = link(first, second);
+            joined->next = pairs;
+            pairs = joined;
+            first = rest;
+        }
+
+        Node* root = pairs;
+        pairs = pairs->next;
+        while (pairs != nullptr)
+        {
+            Node* rest = pairs->next;
+            root = link(root, pairs);
+            pairs = rest;
+        }
+        root->next = nullptr;
+        root->prev = nullptr;
+        return root;
+    }
+
+    /**
+     * @brief Visit every node once, in an order that lets the visitor destroy it.
+     *
+     * The first child of a node is rotated above it until the node has no child, then the node is visited and the
+     * walk continues with its next sibling: O(n) without a stack.
+     */
+    template <typename Visitor>
+    void forEachNode(Visitor visit) noexcept
+    {
+        Node* node = mRoot;
+        while (node != nullptr)
+        {
+            if (Node* child = node->child)
+            {
+                node->child = child->next;
+                child->next = node;
+                node = child;
+            }
+            else
+            {
+                Node* next = node->next;
+                visit(node);
+                node = next;
+            }
+        }
+    }
+
+    Pool mNodes;
+    Node* mRoot{nullptr};  ///< The top of the heap, null if the heap is empty.
+    int mSize{0};
+    [[no_unique_address]] Compare mCompare{};
+};
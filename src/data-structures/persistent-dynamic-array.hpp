@@ -0,0 +1,548 @@
+#pragma once
+
+#include <access-policy.hpp>
+#include <cerrno>       // for errno
+#include <climits>      // for INT_MAX
+#include <cstddef>      // for std::size_t
+#include <cstdint>      // for std::uint32_t, std::uint64_t, std::int64_t
+#include <cstring>      // for std::memmove, std::strerror
+#include <new>          // for placement new
+#include <stdexcept>    // for std::out_of_range, std::runtime_error
+#include <string>       // for std::string
+#include <type_traits>  // for std::is_trivially_copyable_v
+#include <utility>      // for std::forward, std::exchange
+
+#include <fcntl.h>     // for open
+#include <sys/mman.h>  // for mmap, msync, munmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close, ftruncate
+
+/**
+ * @brief A growable array of trivially copyable elements stored in a memory-mapped file.
+ *
+ * The file starts with a small header (magic, version, element size, size and capacity) followed by the raw
+ * elements. Opening an existing file maps it and the array is usable right away: nothing is parsed or copied, pages
+ * are read from disk on first access. Every change is written to the mapping, so the data outlives the process;
+ * flush() forces it to disk. Appending past the capacity grows the file, the mapping is extended in place inside an
+ * address range reserved up front, so pointers to the elements stay valid.
+ *
+ * @tparam T The type of elements in the array, it must be trivially copyable (stored as raw bytes).
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
+ *
+ * @note Requires a POSIX system (mmap). The file format uses the byte order and layout of the machine.
+ */
+template <typename T, typename Access = DefaultAccess>
+class PersistentDynamicArray
+{
+    static_assert(std::is_trivially_copyable_v<T>, "PersistentDynamicArray stores its elements as raw bytes.");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+
+    /**
+     * @brief Opens the array stored in the given file, creating an empty one if the file does not exist.
+     *
+     * @param path The file backing the array.
+     * @param maxCapacity The maximum number of elements, i.e. the size of the reserved address range (defaults to
+     * getDefaultMaxCapacity()). Raised to the capacity of the file if that is larger.
+     *
+     * @throws std::runtime_error if the file cannot be opened or mapped, or if it is not an array of T.
+     */
+    explicit PersistentDynamicArray(const std::string& path, int maxCapacity = getDefaultMaxCapacity())
+        : mPath(path), mMaxCapacity(maxCapacity)
+    {
+        mFile = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (mFile < 0)
+        {
+            throw std::runtime_error("Cannot open " + path + ": " + std::strerror(errno));
+        }
+
+        try
+        {
+            openMapping();
+        }
+        catch (...)
+        {
+            releaseMapping();
+            throw;
+        }
+    }
+
+    ~PersistentDynamicArray()
+    {
+        releaseMapping();
+    }
+
+    // The file has a single owner: moving is allowed, copying is not
+    PersistentDynamicArray(const PersistentDynamicArray&) = delete;
+    PersistentDynamicArray& operator=(const PersistentDynamicArray&) = delete;
+
+    // Move constructor, the moved-from array can only be destroyed or assigned to
+    PersistentDynamicArray(PersistentDynamicArray&& other) noexcept
+        : mPath(std::move(other.mPath)),
+          mMaxCapacity(other.mMaxCapacity),
+          mFile(std::exchange(other.mFile, -1)),
+          mReservedBytes(std::exchange(other.mReservedBytes, 0)),
+          mHeader(std::exchange(other.mHeader, nullptr)),
+          mData(std::exchange(other.mData, nullptr))
+    {
+    }
+
+    // Move assignment operator
+    PersistentDynamicArray& operator=(PersistentDynamicArray&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;  // Return *this to avoid self-assignment
+        }
+
+        releaseMapping();
+        mPath = std::move(other.mPath);
+        mMaxCapacity = other.mMaxCapacity;
+        mFile = std::exchange(other.mFile, -1);
+        mReservedBytes = std::exchange(other.mReservedBytes, 0);
+        mHeader = std::exchange(other.mHeader, nullptr);
+        mData = std::exchange(other.mData, nullptr);
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element in the array.
+     *
+     * @return A pointer to the first element of the array.
+     */
+    iterator begin()
+    {
+        return mData;
+    }
+    iterator begin() const
+    {
+        return mData;
+    }
+
+    /**
+     * @brief Returns an iterator pointing past the last element in the array.
+     *
+     * @return A pointer to one past the last element of the array.
+     */
+    iterator end()
+    {
+        return mData + getSize();
+    }
+    iterator end() const
+    {
+        return mData + getSize();
+    }
+
+    /**
+     * @brief Direct access to the mapped elements, never bounds-checked.
+     *
+     * @return A pointer to the first element. It stays valid while the array grows.
+     */
+    T* data() noexcept
+    {
+        return mData;
+    }
+    const T* data() const noexcept
+    {
+        return mData;
+    }
+
+    /**
+     * @brief Access an element at the given index.
+     *
+     * @param index The index of the element to access.
+     * @return A reference to the element at the specified index, writes go straight to the mapped file.
+     *
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
+     *
+     * @complexity
+     * - Time Complexity: O(1) (direct array access, plus a page fault the first time a page is touched).
+     * - Space Complexity: O(1) (no additional memory is used).
+     */
+    T& operator[](int index)
+    {
+        Access::checkIndex(index, getSize(), "Index out of bounds in PersistentDynamicArray::operator[]");
+        return mData[index];
+    }
+
+    /**
+     * @brief Access a constant element at the given index (const version).
+     *
+     * @param index The index of the element to access.
+     * @return A constant reference to the element at the specified index.
+     *
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
+     */
+    const T& operator[](int index) const
+    {
+        Access::checkIndex(index, getSize(), "Index out of bounds in PersistentDynamicArray::operator[]");
+        return mData[index];
+    }
+
+    /**
+     * @brief Compares two PersistentDynamicArray objects for equality (same size and same elements).
+     *
+     * @param other The array to compare with the current array.
+     * @return True if the arrays are equal, false otherwise.
+     *
+     * @complexity
+     * - Time Complexity: O(n), where n is the size of the arrays.
+     * - Space Complexity: O(1).
+     */
+    bool operator==(const PersistentDynamicArray& other) const
+    {
+        if (getSize() != other.getSize())
+        {
+            return false;
+        }
+
+        for (int i = 0; i < getSize(); ++i)
+        {
+            if (mData[i] != other.mData[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Append an item to the array.
+     *
+     * @param item The item to append to the array.
+     *
+     * @throws std::runtime_error if the file cannot grow.
+     *
+     * @complexity
+     * - Time Complexity: amortized O(1). Growing the file extends the mapping in place, nothing is copied.
+     * - Space Complexity: O(1).
+     */
+    void append(const T& item)
+    {
+        emplaceBack(item);
+    }
+
+    /**
+     * @brief Construct an element in place at the end of the array.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A reference to the newly constructed element.
+     *
+     * @throws std::runtime_error if the file cannot grow.
+     */
+    template <typename... Args>
+    T& emplaceBack(Args&&... args)
+    {
+        const int size = getSize();
+        if (size == getCapacity())
+        {
+            grow(size + 1);
+        }
+
+        new (mData + size) T(std::forward<Args>(args)...);
+        mHeader->size = size + 1;
+        return mData[size];
+    }
+
+    /**
+     * @brief Insert an element at the specified position in the array.
+     *
+     * @param item The element to insert.
+     * @param pos The position at which the element should be inserted.
+     * @return iterator to the inserted value.
+     *
+     * @throws std::out_of_range if the position is out of bounds (less than 0 or greater than the current size).
+     *
+     * @complexity
+     * - Time Complexity: worse case O(n) (shifting all elements to the right).
+     * - Space Complexity: O(1).
+     */
+    iterator insert(const T& item, int pos)
+    {
+        const int size = getSize();
+        if (pos < 0 || pos > size)
+        {
+            throw std::out_of_range("Index out of bounds in PersistentDynamicArray::insert");
+        }
+
+        const T value(item);  // The item may live inside this array, copy it before shifting
+        if (size == getCapacity())
+        {
+            grow(size + 1);
+        }
+
+        std::memmove(mData + pos + 1, mData + pos, sizeof(T) * (size - pos));
+        new (mData + pos) T(value);
+        mHeader->size = size + 1;
+
+        return &mData[pos];
+    }
+
+    /**
+     * @brief Erase an element from the array at the specified position.
+     *
+     * @param pos The index of the element to erase.
+     * @return iterator to the value after erased value.
+     *
+     * @throws std::out_of_range if the array is empty or the position is invalid.
+     *
+     * @complexity
+     * - Time Complexity: worst case O(n) for shifting elements after removal.
+     * - Space Complexity: O(1).
+     */
+    iterator erase(int pos)
+    {
+        const int size = getSize();
+        if (size == 0)
+        {
+            throw std::out_of_range("The array is empty in PersistentDynamicArray::erase");
+        }
+
+        if (pos < 0 || pos >= size)
+        {
+            throw std::out_of_range("Index out of bounds in PersistentDynamicArray::erase");
+        }
+
+        std::memmove(mData + pos, mData + pos + 1, sizeof(T) * (size - pos - 1));
+        mHeader->size = size - 1;
+
+        return &mData[pos];
+    }
+
+    /**
+     * @brief Write the mapped pages back to the file and wait for the write to complete.
+     *
+     * Without it the changes still reach the file, but at a time chosen by the operating system.
+     *
+     * @throws std::runtime_error if the pages cannot be written.
+     */
+    void flush()
+    {
+        if (msync(mHeader, getFileBytes(getCapacity()), MS_SYNC) != 0)
+        {
+            throw std::runtime_error("Cannot flush " + mPath + ": " + std::strerror(errno));
+        }
+    }
+
+    /**
+     * @brief Get the size of the array (dynamic size).
+     *
+     * @return The total number of elements inside the array.
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return static_cast<int>(mHeader->size);
+    }
+
+    /**
+     * @brief Get the capacity of the array.
+     * @return The number of elements that fit in the file without growing it.
+     */
+    [[nodiscard]] int getCapacity() const noexcept
+    {
+        return static_cast<int>(mHeader->capacity);
+    }
+
+    /**
+     * @brief Get the maximum capacity of the array.
+     * @return The number of elements that fit in the reserved address range, the array cannot grow past it.
+     */
+    [[nodiscard]] int getMaxCapacity() const noexcept
+    {
+        return mMaxCapacity;
+    }
+
+    /**
+     * @brief Checks if the container has no elements.
+     *
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return getSize() == 0;
+    }
+
+    /**
+     * @return The file backing the array.
+     */
+    [[nodiscard]] const std::string& getPath() const noexcept
+    {
+        return mPath;
+    }
+
+    /**
+     * @return The default maximum capacity: 64 GiB of address space, capped to the int range of the indices.
+     */
+    [[nodiscard]] static constexpr int getDefaultMaxCapacity() noexcept
+    {
+        constexpr std::size_t defaultReservation = std::size_t{64} << 30;
+        constexpr std::size_t elements = defaultReservation / sizeof(T);
+        return elements < INT_MAX ? static_cast<int>(elements) : INT_MAX;
+    }
+
+private:
+    /**
+     * @brief The layout of the start of the file. The elements follow at DATA_OFFSET.
+     */
+    struct Header
+    {
+        std::uint64_t magic;        ///< Always MAGIC, identifies the file format.
+        std::uint32_t version;      ///< Always VERSION, bumped when the layout changes.
+        std::uint32_t elementSize;  ///< sizeof(T) of the array that created the file.
+        std::int64_t size;          ///< Number of elements in the array.
+        std::int64_t capacity;      ///< Number of elements the file has room for.
+    };
+
+    static constexpr std::uint64_t MAGIC = 0x5941525241594E44;  // "DNYARRAY" read as little endian bytes
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::size_t DATA_OFFSET = 4096;  ///< Keeps the elements page aligned
+    static constexpr int INITIAL_CAPACITY_BYTES = 4096;
+
+    static_assert(sizeof(Header) <= DATA_OFFSET);
+    static_assert(alignof(T) <= DATA_OFFSET, "The elements start at DATA_OFFSET, which must be suitably aligned.");
+
+    /**
+     * @brief Reserve the address range, then create or validate the file and map it at the start of the range.
+     */
+    void openMapping()
+    {
+        struct stat status{};
+        if (fstat(mFile, &status) != 0)
+        {
+            throw std::runtime_error("Cannot read the size of " + mPath + ": " + std::strerror(errno));
+        }
+
+        const bool created = status.st_size == 0;
+        std::int64_t capacity = INITIAL_CAPACITY_BYTES / static_cast<std::int64_t>(sizeof(T));
+        if (created)
+        {
+            capacity = capacity < mMaxCapacity ? capacity : mMaxCapacity;
+            capacity = capacity > 0 ? capacity : 1;
+            resizeFile(static_cast<int>(capacity));
+        }
+        else
+        {
+            capacity = readHeader(status.st_size).capacity;
+        }
+        if (capacity > mMaxCapacity)
+        {
+            mMaxCapacity = static_cast<int>(capacity);
+        }
+
+        void* reservation = mmap(
+            nullptr, getFileBytes(mMaxCapacity), PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (reservation == MAP_FAILED)
+        {
+            throw std::runtime_error("Cannot reserve address space for " + mPath + ": " + std::strerror(errno));
+        }
+        mReservedBytes = getFileBytes(mMaxCapacity);
+        mHeader = static_cast<Header*>(reservation);
+        mapFile(static_cast<int>(capacity));
+        mData = reinterpret_cast<T*>(reinterpret_cast<std::byte*>(mHeader) + DATA_OFFSET);
+
+        if (created)
+        {
+            *mHeader = Header{MAGIC, VERSION, static_cast<std::uint32_t>(sizeof(T)), 0, capacity};
+        }
+    }
+
+    /**
+     * @brief Read and validate the header of an existing file.
+     *
+     * @throws std::runtime_error if the file is not an array of T.
+     */
+    Header readHeader(off_t fileBytes) const
+    {
+        Header header{};
+        const bool complete = fileBytes >= static_cast<off_t>(DATA_OFFSET) &&
+                              pread(mFile, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header));
+        if (!complete || header.magic != MAGIC || header.version != VERSION || header.elementSize != sizeof(T) ||
+            header.size < 0 || header.size > header.capacity || header.capacity > INT_MAX ||
+            static_cast<off_t>(getFileBytes(static_cast<int>(header.capacity))) > fileBytes)
+        {
+            throw std::runtime_error(mPath + " is not a PersistentDynamicArray file of this element type");
+        }
+        return header;
+    }
+
+    /**
+     * @brief Grow the file to hold at least the given number of elements (at least doubling its capacity).
+     *
+     * @throws std::runtime_error if the array is at its maximum capacity or the file cannot grow.
+     */
+    void grow(int required)
+    {
+        if (required > mMaxCapacity)
+        {
+            throw std::runtime_error("PersistentDynamicArray " + mPath + " is at its maximum capacity");
+        }
+
+        const int capacity = getCapacity();
+        int newCapacity = capacity <= mMaxCapacity / 2 ? capacity * 2 : mMaxCapacity;
+        if (newCapacity < required)
+        {
+            newCapacity = required;
+        }
+
+        resizeFile(newCapacity);
+        mapFile(newCapacity);
+        mHeader->capacity = newCapacity;
+    }
+
+    void resizeFile(int capacity)
+    {
+        if (ftruncate(mFile, static_cast<off_t>(getFileBytes(capacity))) != 0)
+        {
+            throw std::runtime_error("Cannot resize " + mPath + ": " + std::strerror(errno));
+        }
+    }
+
+    /**
+     * @brief Map the first bytes of the file over the start of the reserved range, replacing the previous mapping.
+     */
+    void mapFile(int capacity)
+    {
+        void* mapping =
+            mmap(mHeader, getFileBytes(capacity), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, mFile, 0);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::runtime_error("Cannot map " + mPath + ": " + std::strerror(errno));
+        }
+    }
+
+    /**
+     * @brief Unmap the range and close the file. The changes already are in the page cache of the file.
+     */
+    void releaseMapping() noexcept
+    {
+        if (mHeader != nullptr)
+        {
+            munmap(mHeader, mReservedBytes);
+            mHeader = nullptr;
+            mData = nullptr;
+            mReservedBytes = 0;
+        }
+        if (mFile >= 0)
+        {
+            close(mFile);
+            mFile = -1;
+        }
+    }
+
+    static constexpr std::size_t getFileBytes(int capacity) noexcept
+    {
+        return DATA_OFFSET + static_cast<std::size_t>(capacity) * sizeof(T);
+    }
+
+    std::string mPath;              ///< The file backing the array.
+    int mMaxCapacity;               ///< Number of elements that fit in the reserved range.
+    int mFile{-1};                  ///< Descriptor of the open file, -1 once released.
+    std::size_t mReservedBytes{0};  ///< Size of the reserved range (header included).
+    Header* mHeader{nullptr};       ///< Start of the reserved range, where the file is mapped.
+    T* mData{nullptr};              ///< First element, DATA_OFFSET bytes into the mapping.
+};
@@ -1,19 +1,44 @@
 #pragma once
 
-#include <list.hpp>
+#include <ring-buffer.hpp>
+#include <stdexcept>  // for std::out_of_range
 #include <useful-concepts.hpp>
 #include <utility>
 
-template <typename T, typename Container = List<T>>
+/**
+ * @brief A FIFO queue adapting a sequence container.
+ *
+ * The default RingBuffer keeps the elements in contiguous storage and pushes and pops them in O(1) without an
+ * allocation per element. List also pops in O(1) but allocates a node per push, DynamicArray shifts every element on
+ * a pop.
+ *
+ * @tparam T The type of elements in the queue.
+ * @tparam Container The underlying container (defaults to RingBuffer<T>).
+ */
+template <typename T, typename Container = RingBuffer<T>>
 requires(HasAppend<Container>&& HasGetSize<Container>) class Queue
 {
 public:
     static_assert(std::is_same<typename Container::value_type, T>::value, "Container items should be same type as T.");
 
+    Queue() = default;
+
+    /**
+     * @brief Constructs an empty queue whose container draws its memory from the given allocator.
+     * @param allocator The allocator forwarded to the underlying container.
+     * @requires Container must expose allocator_type (e.g. RingBuffer, DynamicArray or List).
+     */
+    template <typename Allocator>
+    requires std::same_as<Allocator, typename Container::allocator_type>
+    explicit Queue(const Allocator& allocator) : data(allocator)
+    {
+    }
+
     /**
      * @brief Adds an element to the back of the queue.
      * @param value The element to be enqueued.
-     * @complexity Time: O(1) on average or O(n) if resizing is needed (DynamicArray), O(1) always (List). Space: O(1).
+     * @complexity Time: amortized O(1), O(n) if resizing is needed (RingBuffer, DynamicArray), O(1) always (List).
+     * Space: O(1).
      */
     void push(const T& value)
     {
@@ -23,7 +48,7 @@ public:
     /**
      * @brief Removes the front element from the queue.
      * @throws std::out_of_range if the queue is empty.
-     * @complexity Time: O(n) (DynamicArray), O(1) (List). Space: O(1).
+     * @complexity Time: O(1) (RingBuffer, List), O(n) (DynamicArray). Space: O(1).
      */
     void pop()
     {
@@ -32,7 +57,18 @@ public:
             throw std::out_of_range("Queue::pop() called on empty queue");
         }
 
-        data.erase(0);
+        if constexpr (HasRemoveFirst<Container>)
+        {
+            data.removeFirst();  // Only advances the head (RingBuffer)
+        }
+        else if constexpr (HasIteratorErase<Container>)
+        {
+            data.erase(data.begin());  // No walk to a position (List)
+        }
+        else
+        {
+            data.erase(0);
+        }
     }
 
     /**
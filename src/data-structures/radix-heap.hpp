@@ -0,0 +1,281 @@
+#pragma once
+
+#include <bit>          // for std::bit_width
+#include <dynamic-array.hpp>
+#include <limits>       // for std::numeric_limits
+#include <stdexcept>    // for std::out_of_range, std::invalid_argument
+#include <string>
+#include <type_traits>  // for std::conditional_t, std::is_integral_v, std::is_signed_v, std::make_unsigned_t
+#include <utility>      // for std::pair, std::move
+#include <vector>
+
+/**
+ * @brief A priority queue of integer keys for monotone workloads: no key inserted is smaller than the last key
+ * popped, as in Dijkstra's algorithm with non-negative integer weights or in an event simulation.
+ *
+ * Elements are kept in buckets by the highest bit where their key differs from the last key popped: bucket 0 holds
+ * the keys equal to it, bucket b the keys that first differ at bit b - 1, so bucket b only holds keys smaller than
+ * those of bucket b + 1. Bucket 0 is popped from directly; when it is empty, the first non-empty bucket is scanned
+ * for its smallest key, which becomes the last key, and its elements go down to lower buckets. Every key only goes
+ * down, at most once per bit, so a pop costs O(log C) amortized for keys in [0, C), with no comparison between
+ * elements in the buckets and only sequential scans.
+ *
+ * Signed keys are ordered through their bits with the sign bit flipped.
+ *
+ * @tparam Key An integer type.
+ * @tparam Value The type of the value carried with every key, void for keys alone.
+ */
+template <typename Key, typename Value = void>
+class RadixHeap
+{
+    static_assert(std::is_integral_v<Key>, "RadixHeap keys must be integers");
+
+    using Bits = std::make_unsigned_t<Key>;
+    static constexpr int BUCKET_COUNT = std::numeric_limits<Bits>::digits + 1;
+
+public:
+    using key_type = Key;
+    using value_type = std::conditional_t<std::is_void_v<Value>, Key, std::pair<Key, Value>>;
+
+    /**
+     * @brief Insert a key, for a heap without values.
+     *
+     * @throws std::invalid_argument if the key is smaller than the last key (see getLastKey()).
+     *
+     * @complexity O(1).
+     */
+    void insert(Key key) requires std::is_void_v<Value>
+    {
+        const int bucket = getBucket(key, "RadixHeap::insert");
+        mBuckets[bucket].append(key);
+        ++mSize;
+        updateTop(key, bucket);
+    }
+
+    /**
+     * @brief Insert a key with its value.
+     *
+     * @throws std::invalid_argument if the key is smaller than the last key (see getLastKey()).
+     *
+     * @complexity O(1).
+     */
+    template <typename V = Value>
+    requires(!std::is_void_v<V>)
+    void insert(Key key, V value)
+    {
+        const int bucket = getBucket(key, "RadixHeap::insert");
+        mBuckets[bucket].emplaceBack(key, std::move(value));
+        ++mSize;
+        updateTop(key, bucket);
+    }
+
+    /**
+     * @return An element with the smallest key.
+     *
+     * Reading the top does not change the last key: keys smaller than the top may still be inserted until it is
+     * popped. When bucket 0 is empty the first non-empty bucket is scanned for its smallest key, and the position found
+     * is kept until the next pop, so that pop() does not scan again.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(log C) amortized: the scanned bucket is the one pop() brings down next.
+     */
+    [[nodiscard]] const value_type& top() const
+    {
+        if (mSize == 0)
+        {
+            throw std::out_of_range("The heap is empty in RadixHeap::top");
+        }
+        if (!mBuckets[0].isEmpty())
+        {
+            return mBuckets[0].data()[mBuckets[0].getSize() - 1];
+        }
+        findTop();
+        return mBuckets[mTopBucket].data()[mTopIndex];
+    }
+
+    /**
+     * @return The smallest key.
+     *
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity O(log C) amortized.
+     */
+    [[nodiscard]] Key topKey() const
+    {
+        return getKey(top());
+    }
+
+    /**
+     * @brief Remove the element with the smallest key. Does nothing if the heap is empty, like MinHeap::pop().
+     *
+     * @complexity O(log C) amortized.
+     */
+    void pop()
+    {
+        if (mSize == 0)
+        {
+            return;
+        }
+        fillFirstBucket();
+        mBuckets[0].erase(mBuckets[0].getSize() - 1);
+        --mSize;
+        mTopBucket = NO_TOP;
+    }
+
+    /**
+     * @brief Remove every element. The last key popped is kept: the keys inserted next must not be smaller.
+     */
+    void clear()
+    {
+        for (DynamicArray<value_type>& bucket : mBuckets)
+        {
+            bucket.eraseRange(0, bucket.getSize());
+        }
+        mSize = 0;
+        mTopBucket = NO_TOP;
+    }
+
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mSize;
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @return The smallest key an insertion accepts: the last key popped, the smallest Key before.
+     */
+    [[nodiscard]] Key getLastKey() const noexcept
+    {
+        return mLastKey;
+    }
+
+    /**
+     * @return The elements bucket by bucket: every key in a bucket is smaller than the keys of the next buckets, in
+     * no particular order inside a bucket.
+     */
+    std::vector<value_type> toVector() const
+    {
+        std::vector<value_type> out;
+        out.reserve(mSize);
+        for (const DynamicArray<value_type>& bucket : mBuckets)
+        {
+            out.insert(out.end(), bucket.data(), bucket.data() + bucket.getSize());
+        }
+        return out;
+    }
+
+private:
+    static Key getKey(const value_type& element) noexcept
+    {
+        if constexpr (std::is_void_v<Value>)
+        {
+            return element;
+        }
+        else
+        {
+            return element.first;
+        }
+    }
+
+    // The bits of a key, in the same order as the keys
+    static constexpr Bits toBits(Key key) noexcept
+    {
+        if constexpr (std::is_signed_v<Key>)
+        {
+            return static_cast<Bits>(static_cast<Bits>(key) ^ (Bits{1} << (std::numeric_limits<Bits>::digits - 1)));
+        }
+        else
+        {
+            return key;
+        }
+    }
+
+    // The bucket of a key not smaller than the last key: 0 if equal, otherwise one plus the highest differing bit
+    int getBucketOf(Key key) const noexcept
+    {
+        return static_cast<int>(std::bit_width(static_cast<Bits>(toBits(key) ^ toBits(mLastKey))));
+    }
+
+    int getBucket(Key key, const char* operation) const
+    {
+        if (key < mLastKey)
+        {
+            throw std::invalid_argument(std::string("Key smaller than the last key in ") + operation);
+        }
+        return getBucketOf(key);
+    }
+
+    // Keep the position of an inserted key if it is smaller than the top found by top()
+    void updateTop(Key key, int bucket) noexcept
+    {
+        if (mTopBucket != NO_TOP && key < getKey(mBuckets[mTopBucket].data()[mTopIndex]))
+        {
+            mTopBucket = bucket;
+            mTopIndex = mBuckets[bucket].getSize() - 1;
+        }
+    }
+
+    /**
+     * @brief Find the smallest key in the first non-empty bucket, unless it is already known. Bucket 0 must be empty
+     * and the heap not empty.
+     */
+    void findTop() const noexcept
+    {
+        if (mTopBucket != NO_TOP)
+        {
+            return;
+        }
+        int index = 1;
+        while (mBuckets[index].isEmpty())
+        {
+            ++index;
+        }
+
+        const value_type* elements = mBuckets[index].data();
+        const int count = mBuckets[index].getSize();
+        int smallest = 0;
+        for (int i = 1; i < count; ++i)
+        {
+            smallest = getKey(elements[i]) < getKey(elements[smallest]) ? i : smallest;
+        }
+        mTopBucket = index;
+        mTopIndex = smallest;
+    }
+
+    /**
+     * @brief If bucket 0 is empty, make the smallest key the last key and move the elements of the first non-empty
+     * bucket down to the buckets below it. The heap must not be empty.
+     */
+    void fillFirstBucket()
+    {
+        if (!mBuckets[0].isEmpty())
+        {
+            return;
+        }
+        findTop();
+
+        DynamicArray<value_type>& bucket = mBuckets[mTopBucket];
+        const int count = bucket.getSize();
+        mLastKey = getKey(bucket.data()[mTopIndex]);
+        for (int i = 0; i < count; ++i)
+        {
+            mBuckets[getBucketOf(getKey(bucket.data()[i]))].append(std::move(bucket.data()[i]));
+        }
+        bucket.eraseRange(0, count);
+    }
+
+    static constexpr int NO_TOP = -1;
+
+    DynamicArray<value_type> mBuckets[BUCKET_COUNT];
+    Key mLastKey{std::numeric_limits<Key>::min()};  ///< The last key popped, the origin of the buckets.
+    int mSize{0};
+
+    // The position of the smallest key found by top() while bucket 0 is empty, kept until the next pop
+    mutable int mTopBucket{NO_TOP};
+    mutable int mTopIndex{0};
+};
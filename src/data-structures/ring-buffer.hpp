@@ -0,0 +1,677 @@
+#pragma once
+
+#include <access-policy.hpp>
+#include <compare>           // for std::strong_ordering
+#include <cstddef>           // for std::ptrdiff_t
+#include <cstring>           // for std::memcpy
+#include <initializer_list>  // for std::initializer_list
+#include <iterator>          // for std::random_access_iterator_tag
+#include <memory>            // for std::allocator, std::allocator_traits
+#include <memory_resource>   // for std::pmr::polymorphic_allocator
+#include <stdexcept>         // for std::out_of_range
+#include <type_traits>       // for std::is_trivially_copyable_v, std::is_const_v
+#include <utility>           // for std::move, std::move_if_noexcept, std::forward
+
+/**
+ * @brief Random access iterator over the elements of a RingBuffer, from the oldest to the newest.
+ *
+ * The iterator keeps the unwrapped position of its element, the slot is only masked when it is dereferenced, so
+ * positions stay ordered across the wrap-around of the storage.
+ *
+ * @tparam T The type of elements in the buffer.
+ * @tparam Value T or const T.
+ */
+template <typename T, typename Value = T>
+class RingBufferIterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;  ///< Required iterator category.
+    using value_type = T;                                       ///< Type of value pointed to.
+    using difference_type = std::ptrdiff_t;  ///< Type to represent the difference between two iterators.
+    using pointer = Value*;                  ///< Pointer type to the value type.
+    using reference = Value&;                ///< Reference type to the value type.
+
+    RingBufferIterator() = default;
+
+    /**
+     * @brief Construct a new RingBufferIterator.
+     *
+     * @param data The storage of the buffer.
+     * @param mask The capacity of the buffer minus one.
+     * @param position The unwrapped position of the element.
+     */
+    RingBufferIterator(T* data, int mask, int position) : mData(data), mMask(mask), mPosition(position)
+    {
+    }
+
+    /**
+     * @brief Converts a mutable iterator to a const one.
+     */
+    template <typename Other>
+    requires(std::is_const_v<Value> && std::is_same_v<Other, T>)
+    RingBufferIterator(const RingBufferIterator<T, Other>& other)
+        : mData(other.mData), mMask(other.mMask), mPosition(other.mPosition)
+    {
+    }
+
+    reference operator*() const
+    {
+        return mData[mPosition & mMask];
+    }
+    pointer operator->() const
+    {
+        return &mData[mPosition & mMask];
+    }
+    reference operator[](difference_type offset) const
+    {
+        return mData[(mPosition + static_cast<int>(offset)) & mMask];
+    }
+
+    RingBufferIterator& operator++()
+    {
+        ++mPosition;
+        return *this;
+    }
+    RingBufferIterator& operator--()
+    {
+        --mPosition;
+        return *this;
+    }
+    RingBufferIterator operator++(int)
+    {
+        RingBufferIterator previous = *this;
+        ++mPosition;
+        return previous;
+    }
+    RingBufferIterator operator--(int)
+    {
+        RingBufferIterator previous = *this;
+        --mPosition;
+        return previous;
+    }
+
+    RingBufferIterator& operator+=(difference_type offset)
+    {
+        mPosition += static_cast<int>(offset);
+        return *this;
+    }
+    RingBufferIterator& operator-=(difference_type offset)
+    {
+        mPosition -= static_cast<int>(offset);
+        return *this;
+    }
+    friend RingBufferIterator operator+(RingBufferIterator iterator, difference_type offset)
+    {
+        return iterator += offset;
+    }
+    friend RingBufferIterator operator+(difference_type offset, RingBufferIterator iterator)
+    {
+        return iterator += offset;
+    }
+    friend RingBufferIterator operator-(RingBufferIterator iterator, difference_type offset)
+    {
+        return iterator -= offset;
+    }
+    difference_type operator-(const RingBufferIterator& other) const
+    {
+        return mPosition - other.mPosition;
+    }
+
+    bool operator==(const RingBufferIterator& other) const
+    {
+        return mPosition == other.mPosition;
+    }
+    std::strong_ordering operator<=>(const RingBufferIterator& other) const
+    {
+        return mPosition <=> other.mPosition;
+    }
+
+private:
+    template <typename, typename>
+    friend class RingBufferIterator;
+
+    T* mData{nullptr};  ///< The storage of the buffer.
+    int mMask{0};       ///< The capacity of the buffer minus one.
+    int mPosition{0};   ///< The unwrapped position, the slot is mPosition & mMask.
+};
+
+/**
+ * @brief A growable circular buffer, a FIFO sequence in contiguous storage.
+ *
+ * The elements live in one power-of-two array, from a head slot that wraps around its end, so appending at the back
+ * and removing from the front are O(1) without moving the other elements, and the position of an element is a mask
+ * away from its index. A full buffer doubles its storage and relocates the elements to its start. There is no
+ * allocation per element: once the buffer reached the largest size of a workload, pushes and pops do not allocate.
+ *
+ * This is the default container of Queue.
+ *
+ * @tparam T The type of elements in the buffer.
+ * @tparam Allocator The allocator used for the storage (defaults to std::allocator<T>). Use
+ * std::pmr::polymorphic_allocator<T> (see PmrRingBuffer) to draw the storage from a memory resource.
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename Access = DefaultAccess>
+class RingBuffer
+{
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using iterator = RingBufferIterator<T>;
+    using const_iterator = RingBufferIterator<T, const T>;
+
+    RingBuffer() = default;
+
+    explicit RingBuffer(const Allocator& allocator) : mAllocator(allocator)
+    {
+    }
+
+    /**
+     * @brief Construct an empty buffer with room for at least the given number of elements.
+     *
+     * @param initialCapacity The number of elements to allocate for, rounded up to a power of two.
+     * @param allocator The allocator providing the storage.
+     */
+    explicit RingBuffer(int initialCapacity, const Allocator& allocator = Allocator()) : mAllocator(allocator)
+    {
+        reserve(initialCapacity);
+    }
+
+    // Constructor to initialize with an initializer list
+    RingBuffer(std::initializer_list<T> list, const Allocator& allocator = Allocator()) : mAllocator(allocator)
+    {
+        reserve(static_cast<int>(list.size()));
+        try
+        {
+            for (const T& item : list)
+            {
+                construct(mData + mSize, item);
+                mSize++;
+            }
+        }
+        catch (...)
+        {
+            destroyElements();
+            deallocate(mData, mCapacity);
+            throw;
+        }
+    }
+
+    ~RingBuffer()
+    {
+        destroyElements();
+        deallocate(mData, mCapacity);
+    }
+
+    // Copy constructor
+    RingBuffer(const RingBuffer& other)
+        : mAllocator(AllocatorTraits::select_on_container_copy_construction(other.mAllocator))
+    {
+        try
+        {
+            copyElementsFrom(other);
+        }
+        catch (...)
+        {
+            destroyElements();  // The elements copied before the throw, no destructor runs for this buffer
+            deallocate(mData, mCapacity);
+            throw;
+        }
+    }
+
+    // Copy assignment operator
+    RingBuffer& operator=(const RingBuffer& other)
+    {
+        if (this == &other)
+        {
+            return *this;  // Return *this to avoid self-assignment
+        }
+
+        // Release any existing resources
+        destroyElements();
+        deallocate(mData, mCapacity);
+        mData = nullptr;
+        mCapacity = 0;
+        mHead = 0;
+        mSize = 0;
+
+        if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+        {
+            mAllocator = other.mAllocator;
+        }
+        copyElementsFrom(other);
+
+        return *this;
+    }
+
+    // Move constructor
+    RingBuffer(RingBuffer&& other) noexcept
+        : mSize(other.mSize),
+          mCapacity(other.mCapacity),
+          mHead(other.mHead),
+          mAllocator(std::move(other.mAllocator)),
+          mData(other.mData)
+    {
+        // Transfer ownership of the resources
+        other.mData = nullptr;
+        other.mCapacity = 0;
+        other.mHead = 0;
+        other.mSize = 0;
+    }
+
+    // Move assignment operator
+    RingBuffer& operator=(RingBuffer&& other) noexcept(
+        AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value)
+    {
+        if (this == &other)
+        {
+            return *this;  // Return *this to avoid self-assignment
+        }
+
+        if constexpr (
+            !AllocatorTraits::propagate_on_container_move_assignment::value && !AllocatorTraits::is_always_equal::value)
+        {
+            if (mAllocator != other.mAllocator)
+            {
+                // The storage of other can not be released by our allocator, move the elements one by one
+                clear();
+                reserve(other.mSize);
+                for (T& item : other)
+                {
+                    construct(mData + mSize, std::move(item));
+                    mSize++;
+                }
+                return *this;
+            }
+        }
+
+        // Release any existing resources
+        destroyElements();
+        deallocate(mData, mCapacity);
+
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            mAllocator = std::move(other.mAllocator);
+        }
+
+        // Transfer ownership of the resources
+        mData = other.mData;
+        mCapacity = other.mCapacity;
+        mHead = other.mHead;
+        mSize = other.mSize;
+
+        // Set the other object to a valid state
+        other.mData = nullptr;
+        other.mCapacity = 0;
+        other.mHead = 0;
+        other.mSize = 0;
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns an iterator to the oldest element of the buffer.
+     */
+    iterator begin()
+    {
+        return iterator(mData, mCapacity - 1, mHead);
+    }
+    const_iterator begin() const
+    {
+        return const_iterator(mData, mCapacity - 1, mHead);
+    }
+
+    /**
+     * @brief Returns an iterator past the newest element of the buffer.
+     */
+    iterator end()
+    {
+        return iterator(mData, mCapacity - 1, mHead + mSize);
+    }
+    const_iterator end() const
+    {
+        return const_iterator(mData, mCapacity - 1, mHead + mSize);
+    }
+
+    /**
+     * @brief Access an element by its index, 0 being the oldest element.
+     *
+     * @param index The index of the element to access.
+     * @return A reference to the element at the specified index.
+     *
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
+     *
+     * @complexity
+     * - Time Complexity: O(1) (one mask of the head plus the index).
+     * - Space Complexity: O(1).
+     */
+    T& operator[](int index)
+    {
+        Access::checkIndex(index, mSize, "Index out of bounds in RingBuffer::operator[]");
+        return mData[slot(index)];
+    }
+    const T& operator[](int index) const
+    {
+        Access::checkIndex(index, mSize, "Index out of bounds in RingBuffer::operator[]");
+        return mData[slot(index)];
+    }
+
+    /**
+     * @brief Compares the elements of two buffers in order, wherever their heads are.
+     *
+     * @complexity
+     * - Time Complexity: O(n).
+     * - Space Complexity: O(1).
+     */
+    bool operator==(const RingBuffer& other) const
+    {
+        if (mSize != other.mSize)
+        {
+            return false;
+        }
+
+        for (int i = 0; i < mSize; ++i)
+        {
+            if (mData[slot(i)] != other.mData[other.slot(i)])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Append an item at the back of the buffer.
+     *
+     * @param item The item to append.
+     *
+     * @complexity
+     * - Time Complexity: amortized O(1), O(n) when the storage has to grow.
+     * - Space Complexity: O(1), or O(n) when the storage has to grow.
+     */
+    void append(const T& item)
+    {
+        emplaceBack(item);
+    }
+
+    /**
+     * @brief Append an item at the back of the buffer, moving it into place.
+     *
+     * @complexity Same as append(const T&), without copying the item.
+     */
+    void append(T&& item)
+    {
+        emplaceBack(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the back of the buffer.
+     *
+     * When the buffer is full, the new element is constructed in the grown storage before the existing elements are
+     * relocated, which keeps arguments that refer to elements of this buffer valid.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A reference to the newly constructed element.
+     *
+     * @complexity
+     * - Time Complexity: amortized O(1), O(n) when the storage has to grow.
+     * - Space Complexity: O(1), or O(n) when the storage has to grow.
+     */
+    template <typename... Args>
+    T& emplaceBack(Args&&... args)
+    {
+        if (mSize < mCapacity)
+        {
+            construct(mData + slot(mSize), std::forward<Args>(args)...);
+        }
+        else
+        {
+            const int newCapacity = mCapacity > 0 ? mCapacity * 2 : MINIMUM_CAPACITY;
+            T* newData = allocate(newCapacity);
+            try
+            {
+                construct(newData + mSize, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                deallocate(newData, newCapacity);
+                throw;
+            }
+            try
+            {
+                relocateTo(newData);
+            }
+            catch (...)
+            {
+                AllocatorTraits::destroy(mAllocator, newData + mSize);
+                deallocate(newData, newCapacity);
+                throw;
+            }
+            deallocate(mData, mCapacity);
+            mData = newData;
+            mCapacity = newCapacity;
+            mHead = 0;
+        }
+
+        mSize++;
+        return mData[slot(mSize - 1)];
+    }
+
+    /**
+     * @brief Remove the oldest element of the buffer.
+     *
+     * @throws std::out_of_range if the buffer is empty.
+     *
+     * @complexity
+     * - Time Complexity: O(1), no element is moved.
+     * - Space Complexity: O(1).
+     */
+    void removeFirst()
+    {
+        if (isEmpty())
+        {
+            throw std::out_of_range("The buffer is empty in RingBuffer::removeFirst");
+        }
+
+        AllocatorTraits::destroy(mAllocator, mData + mHead);
+        mHead = (mHead + 1) & (mCapacity - 1);
+        mSize--;
+    }
+
+    /**
+     * @brief Make room for at least the given number of elements, so that appending up to it does not allocate.
+     *
+     * @param capacity The number of elements to make room for, rounded up to a power of two.
+     *
+     * @complexity
+     * - Time Complexity: O(n) when the storage grows, O(1) otherwise.
+     * - Space Complexity: O(capacity) when the storage grows.
+     */
+    void reserve(int capacity)
+    {
+        if (capacity <= mCapacity)
+        {
+            return;
+        }
+
+        int newCapacity = mCapacity > 0 ? mCapacity : MINIMUM_CAPACITY;
+        while (newCapacity < capacity)
+        {
+            newCapacity *= 2;
+        }
+
+        T* newData = allocate(newCapacity);
+        try
+        {
+            relocateTo(newData);
+        }
+        catch (...)
+        {
+            deallocate(newData, newCapacity);
+            throw;
+        }
+        deallocate(mData, mCapacity);
+        mData = newData;
+        mCapacity = newCapacity;
+        mHead = 0;
+    }
+
+    /**
+     * @brief Destroy every element, the storage is kept for the next elements.
+     *
+     * @complexity O(n) for elements with a destructor, O(1) otherwise.
+     */
+    void clear() noexcept
+    {
+        destroyElements();
+        mHead = 0;
+        mSize = 0;
+    }
+
+    /**
+     * @return The number of elements in the buffer.
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mSize;
+    }
+
+    /**
+     * @return The number of elements the storage holds, 0 or a power of two.
+     */
+    [[nodiscard]] int getCapacity() const noexcept
+    {
+        return mCapacity;
+    }
+
+    /**
+     * @return True if the buffer holds no element.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @return A copy of the allocator used for the storage.
+     */
+    [[nodiscard]] Allocator getAllocator() const noexcept
+    {
+        return mAllocator;
+    }
+
+private:
+    static constexpr int MINIMUM_CAPACITY = 8;  ///< The capacity of the first allocation.
+
+    /**
+     * @return The slot of the storage holding the element of the given index.
+     */
+    [[nodiscard]] int slot(int index) const noexcept
+    {
+        return (mHead + index) & (mCapacity - 1);
+    }
+
+    T* allocate(int capacity)
+    {
+        return AllocatorTraits::allocate(mAllocator, capacity);
+    }
+
+    void deallocate(T* data, int capacity) noexcept
+    {
+        if (data)
+        {
+            AllocatorTraits::deallocate(mAllocator, data, capacity);
+        }
+    }
+
+    template <typename... Args>
+    void construct(T* location, Args&&... args)
+    {
+        AllocatorTraits::construct(mAllocator, location, std::forward<Args>(args)...);
+    }
+
+    void destroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (int i = 0; i < mSize; ++i)
+            {
+                AllocatorTraits::destroy(mAllocator, mData + slot(i));
+            }
+        }
+    }
+
+    /**
+     * @brief Move the elements, in order, to the start of uninitialized storage and destroy the originals.
+     *
+     * The elements are in at most two segments: from the head to the end of the storage, and the wrapped part from
+     * its start. Trivially copyable types are transferred with one memcpy per segment. Other types are
+     * move-constructed when their move constructor is noexcept and copy-constructed otherwise, so a throwing element
+     * leaves the buffer untouched.
+     *
+     * @param destination Uninitialized storage with room for at least mSize elements.
+     */
+    void relocateTo(T* destination)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (mSize > 0)
+            {
+                const int first = mCapacity - mHead < mSize ? mCapacity - mHead : mSize;
+                std::memcpy(destination, mData + mHead, sizeof(T) * first);
+                std::memcpy(destination + first, mData, sizeof(T) * (mSize - first));
+            }
+        }
+        else
+        {
+            int constructed = 0;
+            try
+            {
+                for (; constructed < mSize; constructed++)
+                {
+                    construct(destination + constructed, std::move_if_noexcept(mData[slot(constructed)]));
+                }
+            }
+            catch (...)
+            {
+                for (int i = 0; i < constructed; ++i)
+                {
+                    AllocatorTraits::destroy(mAllocator, destination + i);
+                }
+                throw;
+            }
+            destroyElements();
+        }
+    }
+
+    /**
+     * @brief Copy-construct the elements of other, in order, into this (empty) buffer.
+     *
+     * @param other The buffer to copy the elements from.
+     */
+    void copyElementsFrom(const RingBuffer& other)
+    {
+        reserve(other.mSize);
+        for (const T& item : other)
+        {
+            construct(mData + mSize, item);
+            mSize++;
+        }
+    }
+
+    int mSize{0};      ///< The number of elements.
+    int mCapacity{0};  ///< The number of slots of the storage, 0 or a power of two.
+    int mHead{0};      ///< The slot of the oldest element.
+
+    [[no_unique_address]] Allocator mAllocator;  ///< The allocator providing the storage.
+
+    T* mData{nullptr};  ///< Raw storage, the mSize slots from mHead on, wrapping around, hold constructed elements.
+};
+
+/**
+ * @brief RingBuffer whose storage comes from a std::pmr::memory_resource.
+ */
+template <typename T, typename Access = DefaultAccess>
+using PmrRingBuffer = RingBuffer<T, std::pmr::polymorphic_allocator<T>, Access>;
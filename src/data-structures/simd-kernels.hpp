@@ -0,0 +1,516 @@
+#pragma once
+
+#include <cstddef>      // for std::size_t
+#include <cstring>      // for std::memcmp
+#include <type_traits>  // for std::is_integral_v, std::is_signed_v, std::is_constant_evaluated
+
+/**
+ * @brief Selects the vector instruction set of the bulk kernels at compile time.
+ *
+ * AVX2 (32 byte registers) when the translation unit is compiled with it (e.g. -mavx2 or -march=native), SSE2
+ * (16 byte registers, always available on x86-64) otherwise, and plain scalar loops on other architectures.
+ */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define DSA_SIMD_WIDTH 32
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+#define DSA_SIMD_WIDTH 16
+#else
+#define DSA_SIMD_WIDTH 0
+#endif
+
+/**
+ * @brief Alignment of the arrays meant for the bulk kernels: a cache line, a multiple of every x86-64 register.
+ */
+inline constexpr std::size_t SIMD_ALIGNMENT = 64;
+
+/**
+ * @brief The vector register of an element type, LANES is 0 when T has no vector kernels.
+ *
+ * The specializations wrap the intrinsics of float, double and the 32 and 64 bit integers. hasMinMax is false
+ * when the instruction set has no lane-wise minimum for T (64 bit integers, unsigned 32 bit integers before SSE4.1).
+ * Only the floating point registers compare, integers are compared as bytes (see simdEqual()).
+ */
+template <typename T>
+struct SimdRegister
+{
+    static constexpr std::size_t LANES = 0;
+    static constexpr bool hasMinMax = false;
+};
+
+#if DSA_SIMD_WIDTH == 32
+
+template <>
+struct SimdRegister<float>
+{
+    using Type = __m256;
+    static constexpr std::size_t LANES = 8;
+    static constexpr bool hasMinMax = true;
+
+    static Type load(const float* data)
+    {
+        return _mm256_loadu_ps(data);
+    }
+    static void store(float* data, Type value)
+    {
+        _mm256_storeu_ps(data, value);
+    }
+    static Type broadcast(float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+    static Type add(Type a, Type b)
+    {
+        return _mm256_add_ps(a, b);
+    }
+    static Type min(Type a, Type b)
+    {
+        return _mm256_min_ps(a, b);
+    }
+    static Type max(Type a, Type b)
+    {
+        return _mm256_max_ps(a, b);
+    }
+    static bool equal(Type a, Type b)
+    {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)) == 0xFF;
+    }
+};
+
+template <>
+struct SimdRegister<double>
+{
+    using Type = __m256d;
+    static constexpr std::size_t LANES = 4;
+    static constexpr bool hasMinMax = true;
+
+    static Type load(const double* data)
+    {
+        return _mm256_loadu_pd(data);
+    }
+    static void store(double* data, Type value)
+    {
+        _mm256_storeu_pd(data, value);
+    }
+    static Type broadcast(double value)
+    {
+        return _mm256_set1_pd(value);
+    }
+    static Type add(Type a, Type b)
+    {
+        return _mm256_add_pd(a, b);
+    }
+    static Type min(Type a, Type b)
+    {
+        return _mm256_min_pd(a, b);
+    }
+    static Type max(Type a, Type b)
+    {
+        return _mm256_max_pd(a, b);
+    }
+    static bool equal(Type a, Type b)
+    {
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)) == 0xF;
+    }
+};
+
+template <typename T>
+    requires(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8))
+struct SimdRegister<T>
+{
+    using Type = __m256i;
+    static constexpr std::size_t LANES = 32 / sizeof(T);
+    static constexpr bool hasMinMax = sizeof(T) == 4;
+
+    static Type load(const T* data)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    }
+    static void store(T* data, Type value)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value);
+    }
+    static Type broadcast(T value)
+    {
+        if constexpr (sizeof(T) == 4)
+        {
+            return _mm256_set1_epi32(static_cast<int>(value));
+        }
+        else
+        {
+            return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+    }
+    static Type add(Type a, Type b)
+    {
+        if constexpr (sizeof(T) == 4)
+        {
+            return _mm256_add_epi32(a, b);
+        }
+        else
+        {
+            return _mm256_add_epi64(a, b);
+        }
+    }
+    static Type min(Type a, Type b)
+        requires(hasMinMax)
+    {
+        return std::is_signed_v<T> ? _mm256_min_epi32(a, b) : _mm256_min_epu32(a, b);
+    }
+    static Type max(Type a, Type b)
+        requires(hasMinMax)
+    {
+        return std::is_signed_v<T> ? _mm256_max_epi32(a, b) : _mm256_max_epu32(a, b);
+    }
+};
+
+#elif DSA_SIMD_WIDTH == 16
+
+template <>
+struct SimdRegister<float>
+{
+    using Type = __m128;
+    static constexpr std::size_t LANES = 4;
+    static constexpr bool hasMinMax = true;
+
+    static Type load(const float* data)
+    {
+        return _mm_loadu_ps(data);
+    }
+    static void store(float* data, Type value)
+    {
+        _mm_storeu_ps(data, value);
+    }
+    static Type broadcast(float value)
+    {
+        return _mm_set1_ps(value);
+    }
+    static Type add(Type a, Type b)
+    {
+        return _mm_add_ps(a, b);
+    }
+    static Type min(Type a, Type b)
+    {
+        return _mm_min_ps(a, b);
+    }
+    static Type max(Type a, Type b)
+    {
+        return _mm_max_ps(a, b);
+    }
+    static bool equal(Type a, Type b)
+    {
+        return _mm_movemask_ps(_mm_cmpeq_ps(a, b)) == 0xF;
+    }
+};
+
+template <>
+struct SimdRegister<double>
+{
+    using Type = __m128d;
+    static constexpr std::size_t LANES = 2;
+    static constexpr bool hasMinMax = true;
+
+    static Type load(const double* data)
+    {
+        return _mm_loadu_pd(data);
+    }
+    static void store(double* data, Type value)
+    {
+        _mm_storeu_pd(data, value);
+    }
+    static Type broadcast(double value)
+    {
+        return _mm_set1_pd(value);
+    }
+    static Type add(Type a, Type b)
+    {
+        return _mm_add_pd(a, b);
+    }
+    static Type min(Type a, Type b)
+    {
+        return _mm_min_pd(a, b);
+    }
+    static Type max(Type a, Type b)
+    {
+        return _mm_max_pd(a, b);
+    }
+    static bool equal(Type a, Type b)
+    {
+        return _mm_movemask_pd(_mm_cmpeq_pd(a, b)) == 0x3;
+    }
+};
+
+template <typename T>
+    requires(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8))
+struct SimdRegister<T>
+{
+    using Type = __m128i;
+    static constexpr std::size_t LANES = 16 / sizeof(T);
+#ifdef __SSE4_1__
+    static constexpr bool hasMinMax = sizeof(T) == 4;
+#else
+    static constexpr bool hasMinMax = sizeof(T) == 4 && std::is_signed_v<T>;
+#endif
+
+    static Type load(const T* data)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+    static void store(T* data, Type value)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+    }
+    static Type broadcast(T value)
+    {
+        if constexpr (sizeof(T) == 4)
+        {
+            return _mm_set1_epi32(static_cast<int>(value));
+        }
+        else
+        {
+            return _mm_set1_epi64x(static_cast<long long>(value));
+        }
+    }
+    static Type add(Type a, Type b)
+    {
+        if constexpr (sizeof(T) == 4)
+        {
+            return _mm_add_epi32(a, b);
+        }
+        else
+        {
+            return _mm_add_epi64(a, b);
+        }
+    }
+    static Type min(Type a, Type b)
+        requires(hasMinMax)
+    {
+#ifdef __SSE4_1__
+        return std::is_signed_v<T> ? _mm_min_epi32(a, b) : _mm_min_epu32(a, b);
+#else
+        return select(_mm_cmpgt_epi32(a, b), b, a);
+#endif
+    }
+    static Type max(Type a, Type b)
+        requires(hasMinMax)
+    {
+#ifdef __SSE4_1__
+        return std::is_signed_v<T> ? _mm_max_epi32(a, b) : _mm_max_epu32(a, b);
+#else
+        return select(_mm_cmpgt_epi32(a, b), a, b);
+#endif
+    }
+
+private:
+    // The lanes of a where mask is set, the lanes of b elsewhere (SSE2 has no blend)
+    static Type select(Type mask, Type a, Type b)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+};
+
+#endif
+
+/**
+ * @brief Assign the value to every element of the range.
+ *
+ * Stores whole registers with the vector kernels of T, element by element otherwise, at compile time, and for
+ * the remainder that does not fill a register.
+ *
+ * @param data The first element of the range.
+ * @param count The number of elements of the range.
+ * @param value The value assigned to every element.
+ *
+ * @complexity O(n / L), where L is the number of lanes of a register (1 without vector kernels).
+ */
+template <typename T>
+constexpr void simdFill(T* data, std::size_t count, const T& value)
+{
+    using Register = SimdRegister<T>;
+    std::size_t i = 0;
+    if constexpr (Register::LANES > 0)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto vector = Register::broadcast(value);
+            for (const std::size_t vectorEnd = count - count % Register::LANES; i < vectorEnd; i += Register::LANES)
+            {
+                Register::store(data + i, vector);
+            }
+        }
+    }
+    for (; i < count; ++i)
+    {
+        data[i] = value;
+    }
+}
+
+/**
+ * @brief Compare two ranges of the same length element by element.
+ *
+ * Floating point elements compare like operator==: NaN differs from everything, -0.0 equals 0.0. Integers are
+ * compared as bytes with memcmp, which the C library dispatches to the widest vector instructions of the CPU.
+ *
+ * @param first The first element of a range.
+ * @param second The first element of the other range.
+ * @param count The number of elements of each range.
+ * @return True if every element of first equals the element of second at the same index.
+ *
+ * @complexity O(n / L), stops at the first group of four registers holding a difference.
+ */
+template <typename T>
+[[nodiscard]] constexpr bool simdEqual(const T* first, const T* second, std::size_t count)
+{
+    using Register = SimdRegister<T>;
+    std::size_t i = 0;
+    if constexpr (std::is_integral_v<T>)
+    {
+        // Equal integers have equal bytes, memcmp compares them with the widest registers of the running CPU
+        if (!std::is_constant_evaluated())
+        {
+            return std::memcmp(first, second, count * sizeof(T)) == 0;
+        }
+    }
+    else if constexpr (Register::LANES > 0)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            // Four registers per branch, the comparisons do not depend on each other
+            constexpr std::size_t STEP = 4 * Register::LANES;
+            for (; i + STEP <= count; i += STEP)
+            {
+                const bool equal = Register::equal(Register::load(first + i), Register::load(second + i)) &
+                                   Register::equal(Register::load(first + i + Register::LANES),
+                                                   Register::load(second + i + Register::LANES)) &
+                                   Register::equal(Register::load(first + i + 2 * Register::LANES),
+                                                   Register::load(second + i + 2 * Register::LANES)) &
+                                   Register::equal(Register::load(first + i + 3 * Register::LANES),
+                                                   Register::load(second + i + 3 * Register::LANES));
+                if (!equal)
+                {
+                    return false;
+                }
+            }
+            for (; i + Register::LANES <= count; i += Register::LANES)
+            {
+                if (!Register::equal(Register::load(first + i), Register::load(second + i)))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    for (; i < count; ++i)
+    {
+        if (!(first[i] == second[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief The folds of simdReduce().
+ */
+enum class SimdReduction
+{
+    Sum,
+    Min,
+    Max
+};
+
+/**
+ * @brief Fold a range with a sum, a minimum or a maximum.
+ *
+ * The vector kernels keep four independent accumulators, so that the loop is bound by the loads rather than by
+ * the latency of the additions, and fold their lanes at the end. Floating point sums are therefore added in a
+ * different order than by a sequential loop and may round differently. Min and Max with NaN elements give an
+ * unspecified element.
+ *
+ * @tparam Reduction The fold to apply.
+ * @param data The first element of the range.
+ * @param count The number of elements of the range, at least 1 for Min and Max.
+ * @return The sum (T{} for an empty range), the smallest or the largest element.
+ *
+ * @complexity O(n / L).
+ */
+template <SimdReduction Reduction, typename T>
+[[nodiscard]] constexpr T simdReduce(const T* data, std::size_t count)
+{
+    auto combine = [](const T& result, const T& value) -> T
+    {
+        if constexpr (Reduction == SimdReduction::Sum)
+        {
+            return result + value;
+        }
+        else if constexpr (Reduction == SimdReduction::Min)
+        {
+            return value < result ? value : result;
+        }
+        else
+        {
+            return result < value ? value : result;
+        }
+    };
+
+    using Register = SimdRegister<T>;
+    T result = Reduction == SimdReduction::Sum ? T{} : data[0];
+    std::size_t i = 0;
+    if constexpr (Register::LANES > 0 && (Reduction == SimdReduction::Sum || Register::hasMinMax))
+    {
+        constexpr std::size_t STEP = 4 * Register::LANES;
+        if (!std::is_constant_evaluated() && count >= STEP)
+        {
+            auto combineVectors = [](auto a, auto b)
+            {
+                if constexpr (Reduction == SimdReduction::Sum)
+                {
+                    return Register::add(a, b);
+                }
+                else if constexpr (Reduction == SimdReduction::Min)
+                {
+                    return Register::min(a, b);
+                }
+                else
+                {
+                    return Register::max(a, b);
+                }
+            };
+
+            auto accumulator0 = Register::load(data);
+            auto accumulator1 = Register::load(data + Register::LANES);
+            auto accumulator2 = Register::load(data + 2 * Register::LANES);
+            auto accumulator3 = Register::load(data + 3 * Register::LANES);
+            for (i = STEP; i + STEP <= count; i += STEP)
+            {
+                accumulator0 = combineVectors(accumulator0, Register::load(data + i));
+                accumulator1 = combineVectors(accumulator1, Register::load(data + i + Register::LANES));
+                accumulator2 = combineVectors(accumulator2, Register::load(data + i + 2 * Register::LANES));
+                accumulator3 = combineVectors(accumulator3, Register::load(data + i + 3 * Register::LANES));
+            }
+            accumulator0 = combineVectors(combineVectors(accumulator0, accumulator1),
+                                          combineVectors(accumulator2, accumulator3));
+            for (; i + Register::LANES <= count; i += Register::LANES)
+            {
+                accumulator0 = combineVectors(accumulator0, Register::load(data + i));
+            }
+
+            T lanes[Register::LANES];
+            Register::store(lanes, accumulator0);
+            for (const T& lane : lanes)
+            {
+                result = combine(result, lane);
+            }
+        }
+    }
+    for (; i < count; ++i)
+    {
+        result = combine(result, data[i]);
+    }
+    return result;
+}
@@ -0,0 +1,924 @@
+#pragma once
+
+#include <access-policy.hpp>
+#include <algorithm>         // for std::max
+#include <bit>               // for std::countr_zero
+#include <cstddef>           // for std::byte, std::ptrdiff_t, std::size_t
+#include <cstdint>           // for std::uint64_t
+#include <functional>        // for std::less
+#include <initializer_list>  // for std::initializer_list
+#include <iterator>          // for std::bidirectional_iterator_tag
+#include <memory>            // for std::allocator, std::allocator_traits
+#include <type_traits>       // for std::is_const_v
+#include <utility>           // for std::pair, std::exchange
+
+/**
+ * @brief A forward link of a SkipList node at one level.
+ *
+ * @tparam NodeType The type of the nodes.
+ */
+template <typename NodeType>
+struct SkipLink
+{
+    NodeType* next{nullptr};  ///< The next node with at least this level, null at the end of the level.
+    int span{1};              ///< Number of elements from this node to next, to the end of the list if next is null.
+};
+
+/**
+ * @brief A node of a SkipList: the value, the backward link of the bottom level and a tower of forward links.
+ *
+ * The links are stored right after the node, in the same allocation, so a node of height h costs h links.
+ *
+ * @tparam T The type of the value.
+ */
+template <typename T>
+struct SkipNode
+{
+    T value;                  ///< The value of the node.
+    SkipNode* prev{nullptr};  ///< The previous node of the bottom level, null for the first node.
+    int height{1};            ///< Number of levels the node is linked in, the size of its tower.
+
+    template <typename... Args>
+    explicit SkipNode(int _height, Args&&... args) : value(std::forward<Args>(args)...), height(_height)
+    {
+    }
+
+    SkipLink<SkipNode>* links() noexcept
+    {
+        return linksOf(this);
+    }
+    const SkipLink<SkipNode>* links() const noexcept
+    {
+        return linksOf(const_cast<SkipNode*>(this));
+    }
+
+    /**
+     * @brief The tower of a node, also of a node whose value is destroyed.
+     */
+    static SkipLink<SkipNode>* linksOf(SkipNode* node) noexcept
+    {
+        return reinterpret_cast<SkipLink<SkipNode>*>(reinterpret_cast<std::byte*>(node) + LINKS_OFFSET);
+    }
+
+    static constexpr std::size_t LINK_ALIGNMENT = alignof(SkipLink<SkipNode>);
+    static constexpr std::size_t LINKS_OFFSET =
+        (sizeof(SkipNode) + LINK_ALIGNMENT - 1) / LINK_ALIGNMENT * LINK_ALIGNMENT;
+};
+
+/**
+ * @brief Iterator for traversing a SkipList in order, along the bottom level.
+ *
+ * Like ListIterator it is bidirectional and end() can be decremented to the last element.
+ *
+ * @tparam T The type of elements stored in the list.
+ * @tparam Value T or const T.
+ */
+template <typename T, typename Value>
+class SkipListIterator
+{
+    using Node = SkipNode<T>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;  ///< Required iterator category.
+    using value_type = T;                                       ///< Type of value pointed to.
+    using difference_type = std::ptrdiff_t;  ///< Type to represent the difference between two iterators.
+    using pointer = Value*;                  ///< Pointer type to the value type.
+    using reference = Value&;                ///< Reference type to the value type.
+
+    SkipListIterator() = default;
+
+    /**
+     * @brief Construct a new SkipListIterator.
+     *
+     * @param node The current node, null for end().
+     * @param tail The tail of the list, where end() steps back to.
+     */
+    SkipListIterator(Node* node, Node* const* tail) : mNode(node), mTail(tail)
+    {
+    }
+
+    /**
+     * @brief Converts a mutable iterator to a const one.
+     */
+    template <typename Other>
+    requires(std::is_const_v<Value> && std::is_same_v<Other, T>)
+    SkipListIterator(const SkipListIterator<T, Other>& other) : mNode(other.mNode), mTail(other.mTail)
+    {
+    }
+
+    reference operator*() const
+    {
+        return mNode->value;
+    }
+    pointer operator->() const
+    {
+        return &mNode->value;
+    }
+
+    SkipListIterator& operator++()
+    {
+        mNode = mNode->links()[0].next;
+        return *this;
+    }
+    SkipListIterator& operator--()
+    {
+        mNode = mNode != nullptr ? mNode->prev : *mTail;
+        return *this;
+    }
+    SkipListIterator operator++(int)
+    {
+        SkipListIterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+    SkipListIterator operator--(int)
+    {
+        SkipListIterator previous = *this;
+        --(*this);
+        return previous;
+    }
+
+    bool operator==(const SkipListIterator& other) const
+    {
+        return mNode == other.mNode;
+    }
+
+private:
+    template <typename, typename, typename, typename>
+    friend class SkipList;
+    template <typename, typename>
+    friend class SkipListIterator;
+
+    Node* mNode{nullptr};         ///< The current node, null past the end.
+    Node* const* mTail{nullptr};  ///< The tail pointer of the list.
+};
+
+/**
+ * @brief An ordered set kept in a skip list, with O(log n) search, insertion, erasure and positional access.
+ *
+ * The bottom level is a doubly linked list of the elements in order, iterated like a List. Each node is also linked
+ * in the levels above with probability 1/4 per level, and every forward link records how many elements it skips,
+ * so the rank of an element and the element at an index are found in O(log n) as well. An insertion or an erasure
+ * only relinks the neighbours of one node, there is no rebalancing.
+ *
+ * Nodes hold their tower of links in the same allocation. Erased nodes are kept, by height, for the next
+ * insertions and returned to the allocator by clear() and the destructor.
+ *
+ * The keys are unique. Lookups take any key the comparator accepts, so with a transparent comparator comparing
+ * entries to keys (e.g. by their first member) the list also serves as an ordered map.
+ *
+ * @tparam T The type of elements stored in the list.
+ * @tparam Compare The ordering of the elements (defaults to std::less<>).
+ * @tparam Allocator The allocator of the nodes (defaults to std::allocator<T>).
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
+ */
+template <typename T, typename Compare = std::less<>, typename Allocator = std::allocator<T>,
+          typename Access = DefaultAccess>
+class SkipList
+{
+    using Node = SkipNode<T>;
+    using Link = SkipLink<Node>;
+
+    // Nodes are allocated in units of their alignment, enough for the node and its tower
+    struct alignas(Node) alignas(Link) Unit
+    {
+        std::byte bytes[std::max(alignof(Node), alignof(Link))];
+    };
+    using UnitAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Unit>;
+    using UnitAllocatorTraits = std::allocator_traits<UnitAllocator>;
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using iterator = SkipListIterator<T, T>;
+    using const_iterator = SkipListIterator<T, const T>;
+
+    static constexpr int MAX_LEVEL = 16;  ///< Levels of the list, 4^16 elements before the search degrades.
+
+    SkipList() = default;
+
+    /**
+     * @brief Constructs an empty list whose nodes are obtained from the given allocator.
+     *
+     * @param allocator The allocator for the nodes.
+     */
+    explicit SkipList(const Allocator& allocator) : mAllocator(allocator)
+    {
+    }
+
+    /**
+     * @brief Constructor to initialize with an initializer list, duplicates are ignored.
+     *
+     * @complexity O(n log n), where n is the number of elements in the initializer list.
+     */
+    SkipList(std::initializer_list<T> list, const Allocator& allocator = Allocator()) : mAllocator(allocator)
+    {
+        try
+        {
+            for (const auto& item : list)
+            {
+                insert(item);
+            }
+        }
+        catch (...)
+        {
+            clear();
+            throw;
+        }
+    }
+
+    /**
+     * @brief Copy Constructor, the elements are appended in order without searching.
+     *
+     * @complexity O(n), where n is the number of elements in the other list.
+     */
+    SkipList(const SkipList& other)
+        : mCompare(other.mCompare),
+          mAllocator(UnitAllocatorTraits::select_on_container_copy_construction(other.mAllocator))
+    {
+        try
+        {
+            appendAll(other);
+        }
+        catch (...)
+        {
+            clear();  // No destructor runs for a constructor that throws
+            throw;
+        }
+    }
+
+    /**
+     * @brief Copy Assignment Operator.
+     *
+     * @complexity O(n + m), where n and m are the sizes of both lists.
+     */
+    SkipList& operator=(const SkipList& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        clear();
+        if constexpr (UnitAllocatorTraits::propagate_on_container_copy_assignment::value)
+        {
+            mAllocator = other.mAllocator;
+        }
+        mCompare = other.mCompare;
+        appendAll(other);
+        return *this;
+    }
+
+    /**
+     * @brief Move Constructor, takes over the nodes of the other list which is left empty.
+     *
+     * @complexity O(1)
+     */
+    SkipList(SkipList&& other) noexcept : mCompare(other.mCompare), mAllocator(std::move(other.mAllocator))
+    {
+        takeNodesOf(other);
+    }
+
+    /**
+     * @brief Move Assignment Operator.
+     *
+     * If the allocators differ and do not propagate, the elements are copied instead.
+     *
+     * @complexity O(n) to clear this list, plus O(m) if the elements have to be copied.
+     */
+    SkipList& operator=(SkipList&& other) noexcept(UnitAllocatorTraits::propagate_on_container_move_assignment::value ||
+                                                  UnitAllocatorTraits::is_always_equal::value)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        clear();
+        mCompare = other.mCompare;
+        if constexpr (UnitAllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            mAllocator = std::move(other.mAllocator);
+        }
+        else if constexpr (!UnitAllocatorTraits::is_always_equal::value)
+        {
+            if (mAllocator != other.mAllocator)
+            {
+                appendAll(other);
+                other.clear();
+                return *this;
+            }
+        }
+        takeNodesOf(other);
+        return *this;
+    }
+
+    // Destructor to destroy the elements and return every node, the free ones included, to the allocator.
+    ~SkipList()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Access the element at the specified position in the order, following the spans of the links.
+     *
+     * @param index The position of the element.
+     * @return Reference to the element.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
+     *
+     * @complexity O(log n) expected.
+     */
+    const T& operator[](int index) const
+    {
+        Access::checkIndex(index, mSize, "Index out of range in SkipList::operator[]");
+
+        const int target = index + 1;  // The head is at position 0
+        int position = 0;
+        const Link* links = mHead;
+        Node* node = nullptr;
+        for (int level = mLevel - 1; level >= 0; --level)
+        {
+            while (links[level].next != nullptr && position + links[level].span <= target)
+            {
+                position += links[level].span;
+                node = links[level].next;
+                links = node->links();
+            }
+        }
+        return node->value;
+    }
+
+    /**
+     * @brief Compares the elements of two lists in order.
+     *
+     * @complexity O(n)
+     */
+    bool operator==(const SkipList& other) const
+    {
+        if (mSize != other.mSize)
+        {
+            return false;
+        }
+        for (auto it = begin(), otherIt = other.begin(); it != end(); ++it, ++otherIt)
+        {
+            if (!(*it == *otherIt))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @return An iterator to the smallest element.
+     */
+    iterator begin() noexcept
+    {
+        return iterator(mHead[0].next, &mTail);
+    }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(mHead[0].next, &mTail);
+    }
+
+    /**
+     * @return An iterator past the largest element.
+     */
+    iterator end() noexcept
+    {
+        return iterator(nullptr, &mTail);
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(nullptr, &mTail);
+    }
+
+    /**
+     * @brief Insert a value if no element is equivalent to it.
+     *
+     * @param value The value to insert.
+     * @return An iterator to the element with the key of value, and true if value was inserted.
+     *
+     * @complexity O(log n) expected, the node comes from the free nodes if one of its height is available.
+     */
+    std::pair<iterator, bool> insert(const T& value)
+    {
+        Link* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        Node* previous = findPredecessors(value, update, rank);
+        Node* next = update[0][0].next;
+        if (next != nullptr && !mCompare(value, next->value))
+        {
+            return {iterator(next, &mTail), false};
+        }
+
+        Node* node = createNode(randomHeight(), value);
+        linkNode(node, previous, update, rank);
+        return {iterator(node, &mTail), true};
+    }
+
+    /**
+     * @brief Construct an element in place if no element is equivalent to it.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return An iterator to the element with the key of the new value, and true if it was inserted.
+     *
+     * @complexity O(log n) expected.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        Node* node = createNode(randomHeight(), std::forward<Args>(args)...);
+
+        Link* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        Node* previous = findPredecessors(node->value, update, rank);
+        Node* next = update[0][0].next;
+        if (next != nullptr && !mCompare(node->value, next->value))
+        {
+            destroyNode(node);  // An equivalent element is already in the list
+            return {iterator(next, &mTail), false};
+        }
+
+        linkNode(node, previous, update, rank);
+        return {iterator(node, &mTail), true};
+    }
+
+    /**
+     * @brief Erase the element equivalent to a key.
+     *
+     * @param key The key to erase.
+     * @return True if an element was erased.
+     *
+     * @complexity O(log n) expected, the node is kept for the next insertions.
+     */
+    template <typename Key>
+    bool erase(const Key& key)
+    {
+        Link* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        findPredecessors(key, update, rank);
+        Node* node = update[0][0].next;
+        if (node == nullptr || mCompare(key, node->value))
+        {
+            return false;
+        }
+
+        unlinkNode(node, update);
+        return true;
+    }
+
+    /**
+     * @brief Erase the element at the given position.
+     *
+     * @param position Iterator to the element to erase.
+     * @return Iterator to the next element.
+     *
+     * @complexity O(log n) expected, the links pointing to the node are found by searching its value.
+     */
+    iterator erase(iterator position)
+    {
+        return erase(const_iterator(position));
+    }
+    iterator erase(const_iterator position)
+    {
+        Node* node = position.mNode;
+        Node* next = node->links()[0].next;
+
+        Link* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        findPredecessors(node->value, update, rank);
+        unlinkNode(node, update);
+        return iterator(next, &mTail);
+    }
+
+    /**
+     * @brief Find the element equivalent to a key.
+     *
+     * @return Iterator to the element, end() if there is none.
+     *
+     * @complexity O(log n) expected.
+     */
+    template <typename Key>
+    iterator find(const Key& key)
+    {
+        iterator it = lowerBound(key);
+        return it != end() && !mCompare(key, *it) ? it : end();
+    }
+    template <typename Key>
+    const_iterator find(const Key& key) const
+    {
+        const_iterator it = lowerBound(key);
+        return it != end() && !mCompare(key, *it) ? it : end();
+    }
+
+    /**
+     * @return True if an element is equivalent to the key.
+     */
+    template <typename Key>
+    [[nodiscard]] bool contains(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Find the first element not less than a key.
+     *
+     * @return Iterator to the element, end() if every element is less than the key.
+     *
+     * @complexity O(log n) expected.
+     */
+    template <typename Key>
+    iterator lowerBound(const Key& key)
+    {
+        return iterator(searchLowerBound(key).first, &mTail);
+    }
+    template <typename Key>
+    const_iterator lowerBound(const Key& key) const
+    {
+        return const_iterator(searchLowerBound(key).first, &mTail);
+    }
+
+    /**
+     * @brief Find the first element greater than a key.
+     *
+     * @return Iterator to the element, end() if no element is greater than the key.
+     *
+     * @complexity O(log n) expected.
+     */
+    template <typename Key>
+    iterator upperBound(const Key& key)
+    {
+        iterator it = lowerBound(key);
+        return it != end() && !mCompare(key, *it) ? std::next(it) : it;
+    }
+    template <typename Key>
+    const_iterator upperBound(const Key& key) const
+    {
+        const_iterator it = lowerBound(key);
+        return it != end() && !mCompare(key, *it) ? std::next(it) : it;
+    }
+
+    /**
+     * @brief Get the number of elements less than a key, the position of lowerBound(key).
+     *
+     * @complexity O(log n) expected.
+     */
+    template <typename Key>
+    [[nodiscard]] int getRank(const Key& key) const
+    {
+        return searchLowerBound(key).second;
+    }
+
+    /**
+     * @brief Visit in order the elements in [low, high), the elements not less than low and less than high.
+     *
+     * @param low The lower bound of the range, included.
+     * @param high The upper bound of the range, excluded.
+     * @param visit Called with each element of the range, as a const reference.
+     * @return The number of elements visited.
+     *
+     * @complexity O(log n + k) expected, where k is the number of elements in the range.
+     */
+    template <typename Key, typename Visitor>
+    int scan(const Key& low, const Key& high, Visitor&& visit) const
+    {
+        int visited = 0;
+        for (const Node* node = searchLowerBound(low).first; node != nullptr && mCompare(node->value, high);
+             node = node->links()[0].next)
+        {
+            visit(node->value);
+            visited++;
+        }
+        return visited;
+    }
+
+    /**
+     * @brief Count the elements in [low, high) without visiting them, from the ranks of the bounds.
+     *
+     * @complexity O(log n) expected.
+     */
+    template <typename Key>
+    [[nodiscard]] int countRange(const Key& low, const Key& high) const
+    {
+        return std::max(0, getRank(high) - getRank(low));
+    }
+
+    /**
+     * @brief Get the number of elements.
+     *
+     * @complexity O(1)
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Checks if the list has no elements.
+     *
+     * @complexity O(1)
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @brief Destroy every element and return every node to the allocator.
+     *
+     * @complexity O(n), where n is the number of elements.
+     */
+    void clear() noexcept
+    {
+        Node* current = mHead[0].next;
+        while (current != nullptr)
+        {
+            Node* next = current->links()[0].next;
+            destroyNode(current);
+            current = next;
+        }
+        for (int height = 1; height <= MAX_LEVEL; ++height)
+        {
+            Node* free = mFree[height - 1];
+            while (free != nullptr)
+            {
+                Node* node = free;
+                free = Node::linksOf(node)[0].next;
+                UnitAllocatorTraits::deallocate(mAllocator, reinterpret_cast<Unit*>(node), getUnits(height));
+            }
+            mFree[height - 1] = nullptr;
+        }
+        resetLinks();
+    }
+
+    /**
+     * @return A copy of the allocator used for the nodes, rebound to T.
+     */
+    [[nodiscard]] Allocator getAllocator() const noexcept
+    {
+        return Allocator(mAllocator);
+    }
+
+private:
+    /**
+     * @brief Draw the height of a new node: 1, then one more level with probability 1/4, up to MAX_LEVEL.
+     */
+    int randomHeight() noexcept
+    {
+        // xorshift64, two random bits per level
+        mRandom ^= mRandom << 13;
+        mRandom ^= mRandom >> 7;
+        mRandom ^= mRandom << 17;
+        return 1 + std::countr_zero(mRandom | (std::uint64_t{1} << (2 * (MAX_LEVEL - 1)))) / 2;
+    }
+
+    /**
+     * @brief Find, at every level, the last link before the first element not less than the key.
+     *
+     * @param update Set to the links (of the head or of a node) whose next is the first element not less than the
+     * key, at every level below mLevel.
+     * @param rank Set to the position of the owner of update[level], the head being at 0.
+     * @return The last node less than the key, null if there is none.
+     */
+    template <typename Key>
+    Node* findPredecessors(const Key& key, Link** update, int* rank)
+    {
+        Link* links = mHead;
+        Node* node = nullptr;
+        int position = 0;
+        for (int level = mLevel - 1; level >= 0; --level)
+        {
+            while (links[level].next != nullptr && mCompare(links[level].next->value, key))
+            {
+                position += links[level].span;
+                node = links[level].next;
+                links = node->links();
+            }
+            update[level] = links;
+            rank[level] = position;
+        }
+        return node;
+    }
+
+    /**
+     * @return The first node not less than the key (null if there is none) and its position.
+     */
+    template <typename Key>
+    std::pair<Node*, int> searchLowerBound(const Key& key) const
+    {
+        const Link* links = mHead;
+        int position = 0;
+        for (int level = mLevel - 1; level >= 0; --level)
+        {
+            while (links[level].next != nullptr && mCompare(links[level].next->value, key))
+            {
+                position += links[level].span;
+                links = links[level].next->links();
+            }
+        }
+        return {links[0].next, position};
+    }
+
+    /**
+     * @brief Link a new node after its predecessors at every level, found by findPredecessors().
+     */
+    void linkNode(Node* node, Node* previous, Link** update, int* rank) noexcept
+    {
+        const int height = node->height;
+        for (int level = mLevel; level < height; ++level)
+        {
+            update[level] = mHead;
+            rank[level] = 0;
+            mHead[level].span = mSize + 1;
+        }
+        mLevel = std::max(mLevel, height);
+
+        Link* links = node->links();
+        for (int level = 0; level < height; ++level)
+        {
+            const int skipped = rank[0] - rank[level];  // Elements between update[level] and the new node
+            links[level].next = update[level][level].next;
+            links[level].span = update[level][level].span - skipped;
+            update[level][level].next = node;
+            update[level][level].span = skipped + 1;
+        }
+        for (int level = height; level < mLevel; ++level)
+        {
+            update[level][level].span++;
+        }
+
+        Node* next = links[0].next;
+        node->prev = previous;
+        (next != nullptr ? next->prev : mTail) = node;
+        mSize++;
+    }
+
+    /**
+     * @brief Unlink a node, whose predecessors at every level are in update, and keep it for reuse.
+     */
+    void unlinkNode(Node* node, Link** update) noexcept
+    {
+        Link* links = node->links();
+        for (int level = 0; level < mLevel; ++level)
+        {
+            if (level < node->height)
+            {
+                update[level][level].span += links[level].span - 1;
+                update[level][level].next = links[level].next;
+            }
+            else
+            {
+                update[level][level].span--;
+            }
+        }
+
+        Node* next = links[0].next;
+        (next != nullptr ? next->prev : mTail) = node->prev;
+        while (mLevel > 1 && mHead[mLevel - 1].next == nullptr)
+        {
+            mLevel--;
+        }
+        mSize--;
+        destroyNode(node);
+    }
+
+    /**
+     * @brief Append copies of the elements of other, already sorted and unique, without searching.
+     *
+     * If a copy throws, the elements appended so far stay in a valid list.
+     */
+    void appendAll(const SkipList& other)
+    {
+        Link* last[MAX_LEVEL];
+        int lastPosition[MAX_LEVEL];
+        for (int level = 0; level < MAX_LEVEL; ++level)
+        {
+            last[level] = mHead;
+            lastPosition[level] = 0;
+        }
+
+        // The last link of every level runs to the end of the list
+        const auto terminateLevels = [&]() noexcept
+        {
+            for (int level = 0; level < MAX_LEVEL; ++level)
+            {
+                last[level][level].next = nullptr;
+                last[level][level].span = mSize + 1 - lastPosition[level];
+            }
+        };
+
+        try
+        {
+            for (const T& value : other)
+            {
+                const int height = randomHeight();
+                Node* node = createNode(height, value);
+                const int position = mSize + 1;
+                for (int level = 0; level < height; ++level)
+                {
+                    last[level][level].next = node;
+                    last[level][level].span = position - lastPosition[level];
+                    last[level] = node->links();
+                    lastPosition[level] = position;
+                }
+                node->prev = mTail;
+                mTail = node;
+                mSize++;
+                mLevel = std::max(mLevel, height);
+            }
+        }
+        catch (...)
+        {
+            terminateLevels();
+            throw;
+        }
+        terminateLevels();
+    }
+
+    void takeNodesOf(SkipList& other) noexcept
+    {
+        for (int level = 0; level < MAX_LEVEL; ++level)
+        {
+            mHead[level] = other.mHead[level];
+            mFree[level] = std::exchange(other.mFree[level], nullptr);
+        }
+        mTail = other.mTail;
+        mSize = other.mSize;
+        mLevel = other.mLevel;
+        other.resetLinks();
+    }
+
+    void resetLinks() noexcept
+    {
+        for (Link& link : mHead)
+        {
+            link = Link();
+        }
+        mTail = nullptr;
+        mSize = 0;
+        mLevel = 1;
+    }
+
+    static constexpr std::size_t getUnits(int height) noexcept
+    {
+        return (Node::LINKS_OFFSET + height * sizeof(Link) + sizeof(Unit) - 1) / sizeof(Unit);
+    }
+
+    /**
+     * @brief Get a node of the given height, a free one if there is one, and construct its value.
+     */
+    template <typename... Args>
+    Node* createNode(int height, Args&&... args)
+    {
+        Node* node = mFree[height - 1];
+        if (node != nullptr)
+        {
+            mFree[height - 1] = Node::linksOf(node)[0].next;
+        }
+        else
+        {
+            node = reinterpret_cast<Node*>(UnitAllocatorTraits::allocate(mAllocator, getUnits(height)));
+        }
+
+        try
+        {
+            NodeAllocator nodeAllocator(mAllocator);
+            NodeAllocatorTraits::construct(nodeAllocator, node, height, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            Node::linksOf(node)[0].next = mFree[height - 1];
+            mFree[height - 1] = node;
+            throw;
+        }
+        return node;
+    }
+
+    /**
+     * @brief Destroy the value of a node and keep the node with the free nodes of its height, chained through the
+     * first link of its tower.
+     */
+    void destroyNode(Node* node) noexcept
+    {
+        const int height = node->height;
+        NodeAllocator nodeAllocator(mAllocator);
+        NodeAllocatorTraits::destroy(nodeAllocator, node);
+
+        Node::linksOf(node)[0].next = mFree[height - 1];
+        mFree[height - 1] = node;
+    }
+
+    Link mHead[MAX_LEVEL]{};                    ///< The links of the head, before the first element at every level.
+    Node* mTail{nullptr};                       ///< The last element, null if the list is empty.
+    int mSize{0};                               ///< Number of elements.
+    int mLevel{1};                              ///< Number of levels in use, the height of the tallest node.
+    Node* mFree[MAX_LEVEL]{};                   ///< Erased nodes by height, reused by the next insertions.
+    std::uint64_t mRandom{0x9E3779B97F4A7C15};  ///< State of the generator of the node heights.
+
+    [[no_unique_address]] Compare mCompare;          ///< The ordering of the elements.
+    [[no_unique_address]] UnitAllocator mAllocator;  ///< The allocator of the nodes.
+};
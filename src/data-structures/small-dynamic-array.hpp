@@ -0,0 +1,572 @@
+#pragma once
+
+#include <cstddef>           // for std::byte
+#include <cstring>           // for std::memcpy, std::memmove
+#include <initializer_list>  // for std::initializer_list
+#include <memory>            // for std::allocator
+#include <new>               // for placement new
+#include <stdexcept>         // for std::out_of_range
+#include <type_traits>       // for std::is_trivially_copyable_v
+#include <utility>           // for std::move, std::move_if_noexcept, std::forward
+
+/**
+ * @brief A growable array that keeps up to N elements inside the object itself.
+ *
+ * While the array holds at most N elements they live in an inline buffer and no heap memory is used, which
+ * makes creating, filling and destroying many small arrays cheap. When the array grows past N the elements
+ * spill to heap storage that doubles like DynamicArray. The interface mirrors DynamicArray, so it can back
+ * Stack/Queue and be used with the algorithm templates.
+ *
+ * @tparam T The type of elements in the array.
+ * @tparam N The number of elements stored inline before spilling to the heap.
+ */
+template <typename T, int N = 16>
+class SmallDynamicArray
+{
+    static_assert(N > 0, "SmallDynamicArray needs room for at least one inline element.");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+
+    SmallDynamicArray() = default;
+
+    // Constructor to initialize with an initializer list
+    SmallDynamicArray(std::initializer_list<T> list)
+    {
+        reserve(static_cast<int>(list.size()));
+        try
+        {
+            for (auto& item : list)
+            {
+                new (mData + mSize) T(item);
+                mSize++;
+            }
+        }
+        catch (...)
+        {
+            destroyElements();
+            releaseHeapStorage();
+            throw;
+        }
+    }
+
+    ~SmallDynamicArray()
+    {
+        destroyElements();
+        releaseHeapStorage();
+    }
+
+    // Copy constructor
+    SmallDynamicArray(const SmallDynamicArray& other)
+    {
+        try
+        {
+            copyElementsFrom(other);
+        }
+        catch (...)
+        {
+            destroyElements();  // The elements copied before the throw, no destructor runs for this array
+            releaseHeapStorage();
+            throw;
+        }
+    }
+
+    // Copy assignment operator
+    SmallDynamicArray& operator=(const SmallDynamicArray& other)
+    {
+        if (this == &other)
+        {
+            return *this;  // Return *this to avoid self-assignment
+        }
+
+        destroyElements();
+        mSize = 0;
+        copyElementsFrom(other);
+
+        return *this;
+    }
+
+    // Move constructor
+    SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        takeElementsFrom(other);
+    }
+
+    // Move assignment operator
+    SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this == &other)
+        {
+            return *this;  // Return *this to avoid self-assignment
+        }
+
+        destroyElements();
+        releaseHeapStorage();
+        mSize = 0;
+        takeElementsFrom(other);
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element in the array.
+     *
+     * @return A pointer to the first element of the array.
+     */
+    iterator begin()
+    {
+        return mData;
+    }
+    iterator begin() const
+    {
+        return mData;
+    }
+
+    /**
+     * @brief Returns an iterator pointing past the last element in the array.
+     *
+     * @return A pointer to one past the last element of the array.
+     */
+    iterator end()
+    {
+        return mData + mSize;
+    }
+    iterator end() const
+    {
+        return mData + mSize;
+    }
+
+    /**
+     * @brief Access an element at the given index.
+     *
+     * @param index The index of the element to access.
+     * @return A reference to the element at the specified index.
+     *
+     * @throws std::out_of_range if the index is out of bounds.
+     *
+     * @complexity
+     * - Time Complexity: O(1) (direct array access).
+     * - Space Complexity: O(1) (no additional memory is used).
+     */
+    T& operator[](int index)
+    {
+        if (index < 0 || index >= mSize)
+        {
+            throw std::out_of_range("Index out of bounds in SmallDynamicArray::operator[]");
+        }
+        return mData[index];
+    }
+
+    /**
+     * @brief Access a constant element at the given index (const version).
+     *
+     * @param index The index of the element to access.
+     * @return A constant reference to the element at the specified index.
+     *
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    const T& operator[](int index) const
+    {
+        if (index < 0 || index >= mSize)
+        {
+            throw std::out_of_range("Index out of bounds in SmallDynamicArray::operator[]");
+        }
+        return mData[index];
+    }
+
+    /**
+     * @brief Compares two SmallDynamicArray objects for equality (same size and same elements).
+     *
+     * @param other The array to compare with the current array.
+     * @return True if the arrays are equal, false otherwise.
+     *
+     * @complexity
+     * - Time Complexity: O(n), where n is the size of the arrays.
+     * - Space Complexity: O(1).
+     */
+    bool operator==(const SmallDynamicArray& other) const
+    {
+        if (mSize != other.mSize)
+        {
+            return false;
+        }
+
+        for (int i = 0; i < mSize; ++i)
+        {
+            if (mData[i] != other.mData[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Append an item to the array.
+     *
+     * @param item The item to append to the array.
+     *
+     * @complexity
+     * - Time Complexity: O(1) while the array fits inline, amortized O(1) once on the heap.
+     * - Space Complexity: O(1), or O(n) when the storage has to grow.
+     */
+    void append(const T& item)
+    {
+        emplaceBack(item);
+    }
+
+    /**
+     * @brief Append an item to the array, moving it into place.
+     *
+     * @param item The item to move into the array.
+     */
+    void append(T&& item)
+    {
+        emplaceBack(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the end of the array.
+     *
+     * When the storage is full the new element is constructed in the grown storage before the existing
+     * elements are relocated, so arguments referring to elements of this array stay valid.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A reference to the newly constructed element.
+     */
+    template <typename... Args>
+    T& emplaceBack(Args&&... args)
+    {
+        if (mSize < mCapacity)
+        {
+            new (mData + mSize) T(std::forward<Args>(args)...);
+        }
+        else
+        {
+            const int newCapacity = mCapacity * 2;
+            T* newData = std::allocator<T>().allocate(newCapacity);
+            try
+            {
+                new (newData + mSize) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                std::allocator<T>().deallocate(newData, newCapacity);
+                throw;
+            }
+            try
+            {
+                relocate(mData, mSize, newData);
+            }
+            catch (...)
+            {
+                newData[mSize].~T();
+                std::allocator<T>().deallocate(newData, newCapacity);
+                throw;
+            }
+            releaseHeapStorage();
+            mData = newData;
+            mCapacity = newCapacity;
+        }
+
+        mSize++;
+        return mData[mSize - 1];
+    }
+
+    /**
+     * @brief Insert an element at the specified position in the array.
+     *
+     * @param item The element to insert.
+     * @param pos The position at which the element should be inserted.
+     * @return iterator to the inserted value.
+     *
+     * @throws std::out_of_range if the position is out of bounds (less than 0 or greater than the current size).
+     *
+     * @complexity
+     * - Time Complexity: worse case O(n) (shifting all elements to the right and resizing if necessary).
+     * - Space Complexity: O(1), or O(n) when the storage has to grow.
+     */
+    iterator insert(const T& item, int pos)
+    {
+        if (pos < 0 || pos > mSize)
+        {
+            throw std::out_of_range("Index out of bounds in SmallDynamicArray::insert");
+        }
+
+        if (pos == mSize)
+        {
+            return &emplaceBack(item);
+        }
+
+        T value(item);  // The item may live inside this array, copy it before shifting or resizing
+        if (mSize == mCapacity)
+        {
+            reserve(mCapacity * 2);
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(mData + pos + 1, mData + pos, sizeof(T) * (mSize - pos));
+            new (mData + pos) T(std::move(value));
+        }
+        else
+        {
+            // The slot past the end is raw memory, so the last element is move-constructed into it
+            new (mData + mSize) T(std::move(mData[mSize - 1]));
+            for (int i = mSize - 1; i > pos; i--)
+            {
+                mData[i] = std::move(mData[i - 1]);
+            }
+            mData[pos] = std::move(value);
+        }
+        mSize++;
+
+        return &mData[pos];
+    }
+
+    /**
+     * @brief Erase an element from the array at the specified position.
+     *
+     * @param pos The index of the element to erase.
+     * @return iterator to the value after erased value.
+     *
+     * @throws std::out_of_range if the array is empty or the position is invalid.
+     *
+     * @complexity
+     * - Time Complexity: worst case O(n) for shifting elements after removal.
+     * - Space Complexity: O(1).
+     */
+    iterator erase(int pos)
+    {
+        if (isEmpty())
+        {
+            throw std::out_of_range("The array is empty in SmallDynamicArray::erase");
+        }
+
+        if (pos < 0 || pos >= mSize)
+        {
+            throw std::out_of_range("Index out of bounds in SmallDynamicArray::erase");
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(mData + pos, mData + pos + 1, sizeof(T) * (mSize - pos - 1));
+        }
+        else
+        {
+            for (int i = pos; i < mSize - 1; i++)
+            {
+                mData[i] = std::move(mData[i + 1]);
+            }
+            mData[mSize - 1].~T();
+        }
+        mSize--;
+
+        return &mData[pos];
+    }
+
+    /**
+     * @brief Get the size of the array (dynamic size).
+     *
+     * @return The total number of elements inside the array.
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Get the capacity of the array.
+     * @return The number of elements that can be held in the current storage (at least N).
+     */
+    [[nodiscard]] int getCapacity() const noexcept
+    {
+        return mCapacity;
+    }
+
+    /**
+     * @brief Checks if the container has no elements.
+     *
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @brief Checks if the elements are stored in the inline buffer (no heap memory in use).
+     *
+     * @return True while the array has never grown past N elements since its storage was last reset.
+     */
+    [[nodiscard]] bool isInline() const noexcept
+    {
+        return mData == inlineData();
+    }
+
+    /**
+     * @return The number of elements stored inline before spilling to the heap.
+     */
+    [[nodiscard]] static constexpr int getInlineCapacity() noexcept
+    {
+        return N;
+    }
+
+private:
+    T* inlineData() noexcept
+    {
+        return reinterpret_cast<T*>(mInlineStorage);
+    }
+    const T* inlineData() const noexcept
+    {
+        return reinterpret_cast<const T*>(mInlineStorage);
+    }
+
+    /**
+     * @brief Make sure the storage can hold at least the given number of elements.
+     *
+     * @param capacity The requested capacity.
+     */
+    void reserve(int capacity)
+    {
+        if (capacity <= mCapacity)
+        {
+            return;
+        }
+
+        T* newData = std::allocator<T>().allocate(capacity);
+        try
+        {
+            relocate(mData, mSize, newData);
+        }
+        catch (...)
+        {
+            std::allocator<T>().deallocate(newData, capacity);
+            throw;
+        }
+        releaseHeapStorage();
+        mData = newData;
+        mCapacity = capacity;
+    }
+
+    /**
+     * @brief Return heap storage (if any) and fall back to the inline buffer. Elements must be destroyed or
+     * relocated beforehand.
+     */
+    void releaseHeapStorage() noexcept
+    {
+        if (!isInline())
+        {
+            std::allocator<T>().deallocate(mData, mCapacity);
+            mData = inlineData();
+            mCapacity = N;
+        }
+    }
+
+    void destroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (int i = 0; i < mSize; ++i)
+            {
+                mData[i].~T();
+            }
+        }
+    }
+
+    /**
+     * @brief Move elements into uninitialized storage and destroy the originals.
+     *
+     * Trivially copyable types are transferred with memcpy, other types are moved when their move
+     * constructor is noexcept and copied otherwise.
+     */
+    static void relocate(T* source, int count, T* destination)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (count > 0)
+            {
+                std::memcpy(destination, source, sizeof(T) * count);
+            }
+        }
+        else
+        {
+            int constructed = 0;
+            try
+            {
+                for (; constructed < count; constructed++)
+                {
+                    new (destination + constructed) T(std::move_if_noexcept(source[constructed]));
+                }
+            }
+            catch (...)
+            {
+                for (int i = 0; i < constructed; ++i)
+                {
+                    destination[i].~T();
+                }
+                throw;
+            }
+            for (int i = 0; i < count; ++i)
+            {
+                source[i].~T();
+            }
+        }
+    }
+
+    /**
+     * @brief Copy-construct the elements of other into this (empty) array.
+     */
+    void copyElementsFrom(const SmallDynamicArray& other)
+    {
+        reserve(other.mSize);
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (other.mSize > 0)
+            {
+                std::memcpy(mData, other.mData, sizeof(T) * other.mSize);
+            }
+            mSize = other.mSize;
+        }
+        else
+        {
+            for (; mSize < other.mSize; ++mSize)
+            {
+                new (mData + mSize) T(other.mData[mSize]);
+            }
+        }
+    }
+
+    /**
+     * @brief Take the elements of other into this (empty, inline) array, leaving other empty.
+     *
+     * Heap storage changes hands without touching the elements, inline elements are moved one by one.
+     */
+    void takeElementsFrom(SmallDynamicArray& other)
+    {
+        if (!other.isInline())
+        {
+            mData = other.mData;
+            mCapacity = other.mCapacity;
+            mSize = other.mSize;
+
+            other.mData = other.inlineData();
+            other.mCapacity = N;
+            other.mSize = 0;
+            return;
+        }
+
+        relocate(other.mData, other.mSize, mData);
+        mSize = other.mSize;
+        other.mSize = 0;
+    }
+
+    alignas(T) std::byte mInlineStorage[sizeof(T) * N];  ///< Inline buffer for the first N elements.
+
+    int mSize{0};      ///< The number of elements.
+    int mCapacity{N};  ///< The number of elements that can be held in the current storage.
+
+    T* mData{inlineData()};  ///< Points to the inline buffer or to heap storage once the array spilled.
+};
@@ -0,0 +1,324 @@
+#pragma once
+
+#include <atomic>       // for std::atomic
+#include <cache-line.hpp>
+#include <cstddef>      // for std::size_t
+#include <cstdint>      // for std::uint64_t
+#include <memory>       // for std::allocator, std::allocator_traits
+#include <stdexcept>    // for std::out_of_range, std::invalid_argument
+#include <thread>       // for std::this_thread::yield
+#include <type_traits>  // for std::is_trivially_destructible_v
+#include <utility>      // for std::forward, std::move
+
+/**
+ * @brief A bounded lock-free FIFO queue between one producer thread and one consumer thread.
+ *
+ * The elements live in a power-of-two ring of slots. The producer owns the tail counter and the consumer the head
+ * counter; each publishes its counter with a release store and reads the other one with an acquire load, so an
+ * element is fully constructed before the consumer can see it, and fully destroyed before the producer reuses its
+ * slot. The counters are never wrapped, a slot is the counter masked by the capacity.
+ *
+ * The two counters sit on separate cache lines, and each side keeps a private copy of the other side's counter on
+ * its own line. A side only reloads the shared counter when its copy says the ring is full (producer) or empty
+ * (consumer), so in steady state each operation touches one shared line instead of bouncing both. The batch
+ * operations tryPushN() and tryPopN() publish many elements with a single store.
+ *
+ * push(), tryPush(), tryEmplace() and tryPushN() may only be called by the producer thread; front(), pop(),
+ * tryPop() and tryPopN() only by the consumer thread. getSize() and isEmpty() are approximate while both run.
+ *
+ * @tparam T The type of elements in the queue.
+ * @tparam Allocator The allocator used for the ring (defaults to std::allocator<T>).
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class SpscQueue
+{
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    /**
+     * @brief Construct an empty queue holding up to the given number of elements.
+     *
+     * @param capacity The number of elements the ring holds, rounded up to a power of two.
+     * @param allocator The allocator providing the ring.
+     *
+     * @throws std::invalid_argument if the capacity is not positive.
+     */
+    explicit SpscQueue(int capacity, const Allocator& allocator = Allocator()) : mAllocator(allocator)
+    {
+        if (capacity <= 0)
+        {
+            throw std::invalid_argument("SpscQueue capacity must be positive");
+        }
+        while (mCapacity < static_cast<std::size_t>(capacity))
+        {
+            mCapacity *= 2;
+        }
+        mData = AllocatorTraits::allocate(mAllocator, mCapacity);
+    }
+
+    ~SpscQueue()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            const std::uint64_t tail = mTail.load(std::memory_order_acquire);
+            for (std::uint64_t i = mHead.load(std::memory_order_relaxed); i != tail; ++i)
+            {
+                AllocatorTraits::destroy(mAllocator, slot(i));
+            }
+        }
+        AllocatorTraits::deallocate(mAllocator, mData, mCapacity);
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Construct an element at the back of the queue if there is room. Producer only.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return True if the element was pushed, false if the queue is full.
+     *
+     * @complexity O(1), wait-free.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args)
+    {
+        const std::uint64_t tail = mTail.load(std::memory_order_relaxed);
+        if (tail - mCachedHead == mCapacity)
+        {
+            mCachedHead = mHead.load(std::memory_order_acquire);
+            if (tail - mCachedHead == mCapacity)
+            {
+                return false;
+            }
+        }
+
+        AllocatorTraits::construct(mAllocator, slot(tail), std::forward<Args>(args)...);
+        mTail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Push an element if there is room. Producer only.
+     *
+     * @return True if the element was pushed, false if the queue is full.
+     */
+    bool tryPush(const T& value)
+    {
+        return tryEmplace(value);
+    }
+    bool tryPush(T&& value)
+    {
+        return tryEmplace(std::move(value));
+    }
+
+    /**
+     * @brief Push an element, waiting for the consumer while the queue is full. Producer only.
+     *
+     * @complexity O(1) when there is room, otherwise until the consumer pops.
+     */
+    void push(const T& value)
+    {
+        while (!tryEmplace(value))
+        {
+            std::this_thread::yield();
+        }
+    }
+    void push(T&& value)
+    {
+        while (!tryEmplace(std::move(value)))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Push as many of count elements as there is room for, with one publication. Producer only.
+     *
+     * @param first An input iterator to the elements to push, copied in order.
+     * @param count The number of elements available from first.
+     * @return The number of elements pushed, from 0 to count.
+     *
+     * @throws Whatever the copy of an element throws, the elements copied before it are pushed.
+     *
+     * @complexity O(pushed), wait-free.
+     */
+    template <typename Iterator>
+    int tryPushN(Iterator first, int count)
+    {
+        const std::uint64_t tail = mTail.load(std::memory_order_relaxed);
+        std::uint64_t room = mCapacity - (tail - mCachedHead);
+        if (room < static_cast<std::uint64_t>(count))
+        {
+            mCachedHead = mHead.load(std::memory_order_acquire);
+            room = mCapacity - (tail - mCachedHead);
+        }
+
+        const int pushed = room < static_cast<std::uint64_t>(count) ? static_cast<int>(room) : count;
+        int constructed = 0;
+        try
+        {
+            for (; constructed < pushed; ++constructed, ++first)
+            {
+                AllocatorTraits::construct(mAllocator, slot(tail + constructed), *first);
+            }
+        }
+        catch (...)
+        {
+            mTail.store(tail + constructed, std::memory_order_release);  // The elements before the throw are pushed
+            throw;
+        }
+        if (pushed > 0)
+        {
+            mTail.store(tail + pushed, std::memory_order_release);
+        }
+        return pushed;
+    }
+
+    /**
+     * @brief Move the front element out and remove it if the queue is not empty. Consumer only.
+     *
+     * @param value Where the element is moved to.
+     * @return True if an element was popped, false if the queue is empty.
+     *
+     * @complexity O(1), wait-free.
+     */
+    bool tryPop(T& value)
+    {
+        const std::uint64_t head = mHead.load(std::memory_order_relaxed);
+        if (!hasElement(head))
+        {
+            return false;
+        }
+
+        T* element = slot(head);
+        value = std::move(*element);
+        AllocatorTraits::destroy(mAllocator, element);
+        mHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Move up to count elements out, in order, with one publication. Consumer only.
+     *
+     * @param output An output iterator the popped elements are moved to.
+     * @param count The largest number of elements to pop.
+     * @return The number of elements popped, from 0 to count.
+     *
+     * @complexity O(popped), wait-free.
+     */
+    template <typename OutputIterator>
+    int tryPopN(OutputIterator output, int count)
+    {
+        const std::uint64_t head = mHead.load(std::memory_order_relaxed);
+        std::uint64_t available = mCachedTail - head;
+        if (available < static_cast<std::uint64_t>(count))
+        {
+            mCachedTail = mTail.load(std::memory_order_acquire);
+            available = mCachedTail - head;
+        }
+
+        const int popped = available < static_cast<std::uint64_t>(count) ? static_cast<int>(available) : count;
+        for (int i = 0; i < popped; ++i, ++output)
+        {
+            T* element = slot(head + i);
+            *output = std::move(*element);
+            AllocatorTraits::destroy(mAllocator, element);
+        }
+        if (popped > 0)
+        {
+            mHead.store(head + popped, std::memory_order_release);
+        }
+        return popped;
+    }
+
+    /**
+     * @brief Returns the front element. Consumer only.
+     *
+     * @return A reference to the front element, valid until it is popped.
+     * @throws std::out_of_range if the queue is empty.
+     */
+    [[nodiscard]] T& front()
+    {
+        const std::uint64_t head = mHead.load(std::memory_order_relaxed);
+        if (!hasElement(head))
+        {
+            throw std::out_of_range("SpscQueue::front() Empty queue");
+        }
+        return *slot(head);
+    }
+
+    /**
+     * @brief Removes the front element. Consumer only.
+     *
+     * @throws std::out_of_range if the queue is empty.
+     */
+    void pop()
+    {
+        const std::uint64_t head = mHead.load(std::memory_order_relaxed);
+        if (!hasElement(head))
+        {
+            throw std::out_of_range("SpscQueue::pop() called on empty queue");
+        }
+        AllocatorTraits::destroy(mAllocator, slot(head));
+        mHead.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @return The number of elements, exact only when neither thread is running an operation.
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        const std::uint64_t head = mHead.load(std::memory_order_acquire);
+        const std::uint64_t tail = mTail.load(std::memory_order_acquire);
+        return tail > head ? static_cast<int>(tail - head) : 0;
+    }
+
+    /**
+     * @return True if the queue looked empty, exact only when neither thread is running an operation.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return getSize() == 0;
+    }
+
+    /**
+     * @return The largest number of elements the queue holds, a power of two.
+     */
+    [[nodiscard]] int getCapacity() const noexcept
+    {
+        return static_cast<int>(mCapacity);
+    }
+
+private:
+    T* slot(std::uint64_t index) const noexcept
+    {
+        return mData + (index & (mCapacity - 1));
+    }
+
+    // Whether the element at head has been published, reloading the producer's counter only when needed
+    bool hasElement(std::uint64_t head)
+    {
+        if (head == mCachedTail)
+        {
+            mCachedTail = mTail.load(std::memory_order_acquire);
+        }
+        return head != mCachedTail;
+    }
+
+    // Read-only once constructed, shared by both threads
+    std::size_t mCapacity{1};                    ///< The number of slots, a power of two.
+    T* mData{nullptr};                           ///< The ring, the slots from head to tail hold elements.
+    [[no_unique_address]] Allocator mAllocator;  ///< The allocator providing the ring.
+
+    // Written by the consumer
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> mHead{0};  ///< Number of elements popped.
+    std::uint64_t mCachedTail{0};  ///< The consumer's copy of mTail, at most the real one.
+
+    // Written by the producer
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> mTail{0};  ///< Number of elements pushed.
+    std::uint64_t mCachedHead{0};  ///< The producer's copy of mHead, at most the real one.
+};
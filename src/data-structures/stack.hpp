@@ -18,6 +18,19 @@ requires(HasAppend<Container>&& HasGetSize<Container>) class Stack
     static_assert(std::is_same<typename Container::value_type, T>::value, "Container items should be same type as T.");
 
 public:
+    Stack() = default;
+
+    /**
+     * @brief Constructs an empty stack whose container draws its memory from the given allocator.
+     * @param allocator The allocator forwarded to the underlying container.
+     * @requires Container must expose allocator_type (e.g. DynamicArray or List).
+     */
+    template <typename Allocator>
+    requires std::same_as<Allocator, typename Container::allocator_type>
+    explicit Stack(const Allocator& allocator) : data(allocator)
+    {
+    }
+
     /**
      * @brief Pushes an element onto the stack.
      * @param value The element to be added.
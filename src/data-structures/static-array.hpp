@@ -1,7 +1,12 @@
 #pragma once
 
+#include <access-policy.hpp>
+#include <cstddef>           // for std::size_t
 #include <initializer_list>  // for std::initializer_list
+#include <memory>            // for std::assume_aligned
+#include <simd-kernels.hpp>
 #include <stdexcept>         // for std::out_of_range
+#include <utility>           // for std::in_place_t, std::integer_sequence
 
 /**
  * @brief A fixed-size array that provides bounds-checked element access and appending functionality.
@@ -10,27 +15,34 @@
  * and perform bounds-checked access to elements. If the array is full or an index is out
  * of bounds, exceptions are thrown.
  *
+ * The bulk operations fill(), operator==, sum(), min() and max() use the SSE2/AVX2 kernels of simd-kernels.hpp
+ * when T is float, double or a 32/64 bit integer, and plain loops otherwise or during constant evaluation. Every
+ * constructor is constexpr, so an array can be built at compile time.
+ *
  * @tparam T The type of elements in the array.
  * @tparam size The number of elements in the array.
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
+ * @tparam Alignment The alignment of the elements, at least alignof(T) (e.g. SIMD_ALIGNMENT to start them on a
+ * cache line, so that no register load straddles two lines).
  */
-template <typename T, int size>
+template <typename T, int size, typename Access = DefaultAccess, std::size_t Alignment = alignof(T)>
 class StaticArray
 {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                  "The alignment must be a power of two, at least the alignment of T.");
+
 public:
     using value_type = T;
     using iterator = T*;
 
+    static constexpr std::size_t ALIGNMENT = Alignment;  ///< The alignment of the first element.
+
     // Default constructor - Initializes all elements to default value of T (e.g., 0 for int)
-    StaticArray()
-    {
-        for (int i = 0; i < size; ++i)
-        {
-            mData[i] = T();
-        }
-    }
+    constexpr StaticArray() = default;
 
-    // Constructor to initialize with an initializer list
-    StaticArray(std::initializer_list<T> list)
+    // Constructor to initialize with an initializer list, the elements past the list are value-initialized
+    constexpr StaticArray(std::initializer_list<T> list)
     {
         int i = 0;
         for (auto& item : list)
@@ -46,24 +58,35 @@ public:
         }
     }
 
+    /**
+     * @brief Constructs every element of the array from the same constructor arguments.
+     *
+     * Used when the elements must not be default constructed, e.g. containers that all have to share
+     * one allocator.
+     *
+     * @param args The arguments passed to the constructor of each element.
+     */
+    template <typename... Args>
+    constexpr explicit StaticArray(std::in_place_t, const Args&... args)
+        : StaticArray(std::make_integer_sequence<int, size>{}, args...)
+    {
+    }
+
     /**
      * @brief Access an element at the given index.
      *
      * @param index The index of the element to access.
      * @return A reference to the element at the specified index.
      *
-     * @throws std::out_of_range if the index is out of bounds.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
      *
      * @complexity
      * - Time Complexity: O(1) (direct array access).
      * - Space Complexity: O(1) (no additional memory is used).
      */
-    T& operator[](int index)
+    constexpr T& operator[](int index)
     {
-        if (index < 0 || index >= size)
-        {
-            throw std::out_of_range("Index out of bounds in StaticArray::operator[]");
-        }
+        Access::checkIndex(index, size, "Index out of bounds in StaticArray::operator[]");
         return mData[index];
     }
 
@@ -73,46 +96,127 @@ public:
      * @param index The index of the element to access.
      * @return A constant reference to the element at the specified index.
      *
-     * @throws std::out_of_range if the index is out of bounds.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
      *
      * @complexity
      * - Time Complexity: O(1) (direct array access).
      * - Space Complexity: O(1) (no additional memory is used).
      */
-    const T& operator[](int index) const
+    constexpr const T& operator[](int index) const
     {
-        if (index < 0 || index >= size)
-        {
-            throw std::out_of_range("Index out of bounds in StaticArray::operator[]");
-        }
+        Access::checkIndex(index, size, "Index out of bounds in StaticArray::operator[]");
         return mData[index];
     }
 
     /**
      * @brief Compares two StaticArray objects for equality.
      *
-     * This operator checks if two StaticArray objects contain the same elements at each index.
+     * This operator checks if two StaticArray objects contain the same elements at each index, a whole register
+     * at a time when T has vector kernels.
      *
      * @param other The StaticArray object to compare to.
      * @return True if all elements are equal, false otherwise.
      *
-     * @throws std::out_of_range if the size of the StaticArray is mismatched (inconsistent use of template
-     * specialization).
-     *
      * @complexity
      * - Time Complexity: O(n), where n is the number of elements in the array (`size`). Each element is compared once.
      * - Space Complexity: O(1), as no additional memory is allocated besides the local variables for the loop.
      */
-    bool operator==(const StaticArray<T, size>& other) const
+    constexpr bool operator==(const StaticArray& other) const
+    {
+        return simdEqual(data(), other.data(), size);
+    }
+
+    /**
+     * @brief Assign the same value to every element.
+     *
+     * @param value The value to assign.
+     *
+     * @complexity O(n), a register of elements per store when T has vector kernels.
+     */
+    constexpr void fill(const T& value)
+    {
+        simdFill(data(), size, value);
+    }
+
+    /**
+     * @brief Get the sum of the elements.
+     *
+     * The vector kernels add in a different order than a sequential loop, floating point sums may round
+     * differently.
+     *
+     * @return The sum of all elements, T{} for an empty array.
+     *
+     * @complexity O(n).
+     */
+    [[nodiscard]] constexpr T sum() const
     {
+        return simdReduce<SimdReduction::Sum>(data(), size);
+    }
+
+    /**
+     * @brief Get the smallest element.
+     *
+     * @return The smallest element, unspecified if the array holds NaN.
+     *
+     * @complexity O(n).
+     */
+    [[nodiscard]] constexpr T min() const
+        requires(size > 0)
+    {
+        return simdReduce<SimdReduction::Min>(data(), size);
+    }
+
+    /**
+     * @brief Get the largest element.
+     *
+     * @return The largest element, unspecified if the array holds NaN.
+     *
+     * @complexity O(n).
+     */
+    [[nodiscard]] constexpr T max() const
+        requires(size > 0)
+    {
+        return simdReduce<SimdReduction::Max>(data(), size);
+    }
+
+    /**
+     * @brief Replace every element by the result of the operation on it.
+     *
+     * The loop runs on storage the compiler knows to be aligned, so it vectorizes any operation it can see
+     * through (arithmetic lambdas, std::plus, ...).
+     *
+     * @param operation The operation, called with each element.
+     *
+     * @complexity O(n).
+     */
+    template <typename UnaryOperation>
+    constexpr void transform(UnaryOperation operation)
+    {
+        T* values = alignedData();
         for (int i = 0; i < size; ++i)
         {
-            if (mData[i] != other.mData[i])
-            {
-                return false;  // If any elements differ, return false
-            }
+            values[i] = operation(values[i]);
+        }
+    }
+
+    /**
+     * @brief Replace every element by the result of the operation on it and on the element of the other array at
+     * the same index.
+     *
+     * @param other The array providing the second operands, it may be this array.
+     * @param operation The operation, called with an element of this array and one of other.
+     *
+     * @complexity O(n).
+     */
+    template <typename BinaryOperation>
+    constexpr void transform(const StaticArray& other, BinaryOperation operation)
+    {
+        T* values = alignedData();
+        const T* operands = other.alignedData();
+        for (int i = 0; i < size; ++i)
+        {
+            values[i] = operation(values[i], operands[i]);
         }
-        return true;  // All elements are equal
     }
 
     /**
@@ -123,11 +227,11 @@ public:
      *
      * @return A pointer to the first element of the array.
      */
-    T* begin()
+    constexpr T* begin()
     {
         return mData;
     }
-    const T* begin() const
+    constexpr const T* begin() const
     {
         return mData;
     }
@@ -140,15 +244,29 @@ public:
      *
      * @return A pointer to one past the last element of the array.
      */
-    T* end()
+    constexpr T* end()
     {
         return mData + size;
     }
-    const T* end() const
+    constexpr const T* end() const
     {
         return mData + size;
     }
 
+    /**
+     * @brief Direct access to the underlying storage, never bounds-checked.
+     *
+     * @return A pointer to the first element of the array.
+     */
+    constexpr T* data() noexcept
+    {
+        return mData;
+    }
+    constexpr const T* data() const noexcept
+    {
+        return mData;
+    }
+
     /**
      * @brief Get the size of the array (static size).
      *
@@ -170,5 +288,27 @@ public:
     }
 
 private:
-    T mData[size];  ///< The actual data of the static array
+    template <int... Indices, typename... Args>
+    constexpr StaticArray(std::integer_sequence<int, Indices...>, const Args&... args)
+        : mData{makeElement<Indices>(args...)...}
+    {
+    }
+
+    template <int Index, typename... Args>
+    static constexpr T makeElement(const Args&... args)
+    {
+        return T(args...);
+    }
+
+    // The storage, with the alignment the compiler can assume outside of constant evaluation
+    constexpr T* alignedData() noexcept
+    {
+        return std::is_constant_evaluated() ? mData : std::assume_aligned<Alignment>(mData);
+    }
+    constexpr const T* alignedData() const noexcept
+    {
+        return std::is_constant_evaluated() ? mData : std::assume_aligned<Alignment>(mData);
+    }
+
+    alignas(Alignment) T mData[size]{};  ///< The actual data of the static array, value-initialized
 };
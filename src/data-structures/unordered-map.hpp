@@ -1,5 +1,6 @@
 #pragma once
 
+#include <intrusive-list.hpp>
 #include <list.hpp>
 #include <optional>
 #include <static-array.hpp>
@@ -10,11 +11,25 @@
  *
  * @tparam T Type of the value to be stored.
  * @tparam BUCKETS Number of buckets used for hashing.
+ * @tparam Allocator The allocator shared by the bucket lists for their nodes.
  */
-template <typename T, size_t BUCKETS = 16>
+template <typename T, size_t BUCKETS = 16, typename Allocator = std::allocator<std::pair<uint8_t, T>>>
 class UnorderedMap
 {
 public:
+    using allocator_type = Allocator;
+
+    UnorderedMap() = default;
+
+    /**
+     * @brief Constructs an empty map whose bucket nodes are obtained from the given allocator.
+     *
+     * @param allocator The allocator passed to every bucket list.
+     */
+    explicit UnorderedMap(const Allocator& allocator) : mBuckets(std::in_place, allocator)
+    {
+    }
+
     /**
      * @brief Inserts or updates the value associated with the given key.
      *
@@ -60,13 +75,11 @@ public:
         const size_t bucket_id = hashFunction(key);
         auto& bucket = mBuckets[bucket_id];
 
-        int index{-1};
         for (auto it = bucket.begin(); it != bucket.end(); ++it)
         {
-            index++;
             if (it->first == key)
             {
-                bucket.erase(index);
+                bucket.erase(it);
                 --mSize;
                 return;
             }
@@ -128,6 +141,157 @@ private:
         return key % BUCKETS;
     }
 
-    StaticArray<List<std::pair<uint8_t, T>>, BUCKETS> mBuckets;  ///< Array of buckets containing key-value lists.
-    size_t mSize = 0;                                            ///< Number of key-value pairs in the map.
-};
\ No newline at end of file
+    StaticArray<List<std::pair<uint8_t, T>, Allocator>, BUCKETS> mBuckets;  ///< Buckets containing key-value lists.
+    size_t mSize = 0;                                                       ///< Number of key-value pairs in the map.
+};
+
+/**
+ * @brief A hash map with the separate chaining of UnorderedMap, whose chains link the stored objects themselves.
+ *
+ * The objects derive from IntrusiveListHook<Tag> and carry their own key, each bucket is an IntrusiveList of the
+ * objects hashed to it. Inserting an object that already lives somewhere else (a pool, an array, ...) neither
+ * allocates nor copies it, and erasing it only unlinks it. The objects must stay alive while they are in the map and
+ * their key must not change meanwhile; destroying the map unlinks the objects still in it.
+ *
+ * @tparam T Type of the stored objects, derived from IntrusiveListHook<Tag>.
+ * @tparam Key Pointer to the member of T holding the key.
+ * @tparam BUCKETS Number of buckets used for hashing.
+ * @tparam Tag The hook of T linking the chains (defaults to void).
+ */
+template <typename T, uint8_t T::*Key, size_t BUCKETS = 16, typename Tag = void>
+class IntrusiveUnorderedMap
+{
+public:
+    IntrusiveUnorderedMap() = default;
+
+    /**
+     * @brief Inserts an object, replacing the object with the same key if there is one.
+     *
+     * @param object The object to link, it must not be in a list or map through the same hook.
+     * @return The object that was replaced and unlinked, nullptr if the key was not in the map.
+     *
+     * @throws std::invalid_argument if the object is already linked through the hook.
+     *
+     * @complexity
+     * Time: O(N/B) average, O(N) worst-case (N = objects in map, B = buckets). No allocation.
+     * Space: O(1)
+     */
+    T* insert(T& object)
+    {
+        auto& bucket = mBuckets[hashFunction(object.*Key)];
+        for (auto it = bucket.begin(); it != bucket.end(); ++it)
+        {
+            if ((*it).*Key == object.*Key)
+            {
+                T& replaced = *it;
+                bucket.insert(it, object);
+                bucket.erase(it);
+                return &replaced;
+            }
+        }
+        bucket.append(object);
+        ++mSize;
+        return nullptr;
+    }
+
+    /**
+     * @brief Unlinks the object associated with the given key.
+     *
+     * @param key The key to erase.
+     * @return The unlinked object, nullptr if the key was not found.
+     *
+     * @complexity
+     * Time: O(N/B) average, O(N) worst-case.
+     * Space: O(1)
+     */
+    T* erase(uint8_t key)
+    {
+        auto& bucket = mBuckets[hashFunction(key)];
+        for (auto it = bucket.begin(); it != bucket.end(); ++it)
+        {
+            if ((*it).*Key == key)
+            {
+                T& erased = *it;
+                bucket.erase(it);
+                --mSize;
+                return &erased;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Unlinks an object of the map, without searching its bucket.
+     *
+     * @param object An object in this map.
+     *
+     * @throws std::invalid_argument if the object is in no map.
+     *
+     * @complexity
+     * Time: O(1)
+     * Space: O(1)
+     */
+    void erase(T& object)
+    {
+        mBuckets[hashFunction(object.*Key)].erase(object);
+        --mSize;
+    }
+
+    /**
+     * @brief Finds the object associated with a given key.
+     *
+     * @param key The key to look up.
+     * @return Pointer to the object if found, otherwise nullptr.
+     *
+     * @complexity
+     * Time: O(N/B) average, O(N) worst-case.
+     * Space: O(1)
+     */
+    [[nodiscard]] T* find(uint8_t key)
+    {
+        for (T& object : mBuckets[hashFunction(key)])
+        {
+            if (object.*Key == key)
+            {
+                return &object;
+            }
+        }
+        return nullptr;
+    }
+    [[nodiscard]] const T* find(uint8_t key) const
+    {
+        for (const T& object : mBuckets[hashFunction(key)])
+        {
+            if (object.*Key == key)
+            {
+                return &object;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Returns the number of objects in the map.
+     */
+    [[nodiscard]] size_t getSize() const
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Returns the current load factor of the hash table, size / number of buckets.
+     */
+    [[nodiscard]] float loadFactor() const
+    {
+        return static_cast<float>(mSize) / BUCKETS;
+    }
+
+private:
+    [[nodiscard]] size_t hashFunction(uint8_t key) const
+    {
+        return key % BUCKETS;
+    }
+
+    StaticArray<IntrusiveList<T, Tag>, BUCKETS> mBuckets;  ///< Buckets linking the objects.
+    size_t mSize = 0;                                      ///< Number of objects in the map.
+};
@@ -0,0 +1,843 @@
+#pragma once
+
+#include <access-policy.hpp>
+#include <algorithm>         // for std::move, std::move_backward
+#include <cstddef>           // for std::byte, std::ptrdiff_t
+#include <initializer_list>  // for std::initializer_list
+#include <iterator>          // for std::bidirectional_iterator_tag
+#include <memory>            // for std::allocator, std::destroy_at
+#include <new>               // for placement new, std::launder
+#include <node-pool.hpp>
+#include <stdexcept>    // for std::out_of_range
+#include <type_traits>  // for std::is_trivially_destructible_v
+#include <utility>      // for std::move, std::forward
+
+/**
+ * @brief The default number of elements per node of an UnrolledList: about 512 bytes of elements, at least 8.
+ */
+template <typename T>
+inline constexpr int DEFAULT_UNROLLED_BLOCK_SIZE = sizeof(T) >= 64 ? 8 : static_cast<int>(512 / sizeof(T));
+
+/**
+ * @brief A node of an UnrolledList, holding up to B elements stored contiguously.
+ *
+ * @tparam T The type of the elements.
+ * @tparam B The capacity of the node.
+ */
+template <typename T, int B>
+struct UnrolledNode
+{
+    UnrolledNode* next{nullptr};  ///< Pointer to the next node in the list.
+    UnrolledNode* prev{nullptr};  ///< Pointer to the previous node in the list.
+    int count{0};                 ///< Number of constructed elements, they occupy the slots [0, count).
+    alignas(T) std::byte storage[B * sizeof(T)];
+
+    T* data() noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(storage));
+    }
+    const T* data() const noexcept
+    {
+        return std::launder(reinterpret_cast<const T*>(storage));
+    }
+};
+
+/**
+ * @brief Iterator for traversing an UnrolledList, a pointer to the current element and to the end of its node.
+ *
+ * Incrementing only compares two pointers until the end of a node is reached, so a scan runs at nearly the speed of
+ * a pointer loop over each node. The past the end iterator points one past the last element of the tail node,
+ * iterators of an empty list are null. Like ListIterator, stepping back from the first element gives a null
+ * iterator that compares before every other one. operator+ and operator- skip whole nodes, so they cost O(n / B).
+ *
+ * @tparam T The type of elements stored in the list.
+ * @tparam B The capacity of the nodes.
+ * @tparam Value T or const T.
+ */
+template <typename T, int B, typename Value>
+class UnrolledListIterator
+{
+    using Node = UnrolledNode<T, B>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;  ///< Required iterator category.
+    using value_type = T;                                       ///< Type of value pointed to.
+    using difference_type = std::ptrdiff_t;  ///< Type to represent the difference between two iterators.
+    using pointer = Value*;                  ///< Pointer type to the value type.
+    using reference = Value&;                ///< Reference type to the value type.
+
+    UnrolledListIterator() = default;
+
+    /**
+     * @brief Construct a new UnrolledListIterator.
+     *
+     * @param node The node holding the element, null for the iterators of an empty list.
+     * @param index The position of the element in the node.
+     */
+    UnrolledListIterator(Node* node, int index)
+    {
+        if (node != nullptr)
+        {
+            setPosition(node, index);
+        }
+    }
+
+    /**
+     * @brief Converts a mutable iterator to a const one.
+     */
+    template <typename Other>
+    requires(std::is_const_v<Value> && std::is_same_v<Other, T>)
+    UnrolledListIterator(const UnrolledListIterator<T, B, Other>& other)
+        : mNode(other.mNode), mCurrent(other.mCurrent), mNodeEnd(other.mNodeEnd)
+    {
+    }
+
+    reference operator*() const
+    {
+        return *mCurrent;
+    }
+    pointer operator->() const
+    {
+        return mCurrent;
+    }
+
+    /**
+     * @brief Prefix increment operator, moves to the next node after the last element of a node.
+     */
+    UnrolledListIterator& operator++()
+    {
+        if (++mCurrent == mNodeEnd && mNode->next != nullptr)
+        {
+            setPosition(mNode->next, 0);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Prefix decrement operator, moves to the last element of the previous node from the first of a node.
+     */
+    UnrolledListIterator& operator--()
+    {
+        if (mCurrent != mNode->data())
+        {
+            --mCurrent;
+        }
+        else if (mNode->prev != nullptr)
+        {
+            setPosition(mNode->prev, mNode->prev->count - 1);
+        }
+        else
+        {
+            *this = UnrolledListIterator();  // Before the first element
+        }
+        return *this;
+    }
+
+    UnrolledListIterator operator++(int)
+    {
+        UnrolledListIterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+    UnrolledListIterator operator--(int)
+    {
+        UnrolledListIterator previous = *this;
+        --(*this);
+        return previous;
+    }
+
+    // The element slots of different nodes never overlap, the current element identifies the position
+    bool operator==(const UnrolledListIterator& other) const
+    {
+        return mCurrent == other.mCurrent;
+    }
+
+    /**
+     * @brief Move the iterator forward by n steps, skipping whole nodes.
+     *
+     * @param n Number of steps to move forward.
+     * @return A new iterator that is n steps ahead.
+     */
+    UnrolledListIterator operator+(int n) const
+    {
+        if (n < 0)
+        {
+            return *this - (-n);
+        }
+
+        UnrolledListIterator it = *this;
+        while (n > 0)
+        {
+            const auto remaining = static_cast<int>(it.mNodeEnd - it.mCurrent);
+            if (n < remaining || it.mNode->next == nullptr)
+            {
+                it.mCurrent += n;
+                break;
+            }
+            n -= remaining;
+            it.setPosition(it.mNode->next, 0);
+        }
+        return it;
+    }
+
+    /**
+     * @brief Move the iterator backward by n steps, skipping whole nodes.
+     *
+     * @param n Number of steps to move backward.
+     * @return A new iterator that is n steps behind.
+     */
+    UnrolledListIterator operator-(int n) const
+    {
+        if (n < 0)
+        {
+            return *this + (-n);
+        }
+
+        UnrolledListIterator it = *this;
+        while (n > it.getIndex())
+        {
+            if (it.mNode->prev == nullptr)
+            {
+                return UnrolledListIterator();  // Before the first element
+            }
+            n -= it.getIndex() + 1;
+            it.setPosition(it.mNode->prev, it.mNode->prev->count - 1);
+        }
+        it.mCurrent -= n;
+        return it;
+    }
+
+    /**
+     * @brief Calculate the distance between two iterators of the same list.
+     *
+     * @param other The iterator to calculate the distance to.
+     * @return The number of steps from other to this iterator.
+     *
+     * @complexity O(n / B), the nodes between the iterators are skipped by their sizes.
+     */
+    int operator-(const UnrolledListIterator& other) const
+    {
+        if (mNode == other.mNode)
+        {
+            return static_cast<int>(mCurrent - other.mCurrent);
+        }
+        if (other < *this)
+        {
+            return countFrom(other, *this);
+        }
+        return -countFrom(*this, other);
+    }
+
+    /**
+     * @brief Less than comparison, true if this iterator comes before the other one in the list.
+     */
+    bool operator<(const UnrolledListIterator& other) const
+    {
+        if (mNode == other.mNode)
+        {
+            return mCurrent < other.mCurrent;
+        }
+        if (mNode == nullptr)
+        {
+            return true;  // Before the first element
+        }
+        for (const Node* node = mNode; node != nullptr; node = node->next)
+        {
+            if (node == other.mNode)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    bool operator>(const UnrolledListIterator& other) const
+    {
+        return other < *this;
+    }
+    bool operator<=(const UnrolledListIterator& other) const
+    {
+        return !(other < *this);
+    }
+    bool operator>=(const UnrolledListIterator& other) const
+    {
+        return !(*this < other);
+    }
+
+private:
+    template <typename, int, typename>
+    friend class UnrolledListIterator;
+
+    void setPosition(Node* node, int index) noexcept
+    {
+        mNode = node;
+        mCurrent = node->data() + index;
+        mNodeEnd = node->data() + node->count;
+    }
+
+    [[nodiscard]] int getIndex() const noexcept
+    {
+        return static_cast<int>(mCurrent - mNode->data());
+    }
+
+    // Number of steps from first to last, first being in an earlier node
+    static int countFrom(const UnrolledListIterator& first, const UnrolledListIterator& last)
+    {
+        auto distance = static_cast<int>(first.mNodeEnd - first.mCurrent);
+        for (const Node* node = first.mNode->next; node != last.mNode; node = node->next)
+        {
+            distance += node->count;
+        }
+        return distance + last.getIndex();
+    }
+
+    Node* mNode{nullptr};      ///< The node holding the current element.
+    Value* mCurrent{nullptr};  ///< The current element.
+    Value* mNodeEnd{nullptr};  ///< One past the last element of the node.
+};
+
+/**
+ * @brief A doubly linked list of nodes holding up to B elements each.
+ *
+ * Storing the elements contiguously in a node makes a scan touch one node per B elements instead of one per
+ * element, and keeps the per element overhead to a fraction of the two pointers of a List node. Inserting or
+ * erasing shifts the elements of a single node: a full node is split in two halves, and a node that falls under a
+ * quarter full is merged with its successor when they fit together, so the nodes stay reasonably dense.
+ *
+ * The interface mirrors List, so it can back Queue and be used with the algorithm templates. The nodes come from a
+ * NodePool like the ones of List.
+ *
+ * @tparam T The type of elements stored in the list.
+ * @tparam B The number of elements per node, at least 2 (defaults to about 512 bytes of elements).
+ * @tparam Allocator The allocator of the node slabs (defaults to std::allocator<T>), it is rebound to the node type.
+ * @tparam Access The bounds checking policy of operator[]: CheckedAccess or UncheckedAccess (defaults to
+ * DefaultAccess, unchecked when NDEBUG is defined).
+ */
+template <typename T, int B = DEFAULT_UNROLLED_BLOCK_SIZE<T>, typename Allocator = std::allocator<T>,
+          typename Access = DefaultAccess>
+class UnrolledList
+{
+    static_assert(B >= 2, "An UnrolledList node needs room for two elements, so that a full node can be split.");
+
+    using Node = UnrolledNode<T, B>;
+    using Pool = NodePool<Node, Allocator>;
+    using NodeAllocatorTraits = std::allocator_traits<typename Pool::allocator_type>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using iterator = UnrolledListIterator<T, B, T>;
+    using const_iterator = UnrolledListIterator<T, B, const T>;
+
+    UnrolledList() = default;
+
+    /**
+     * @brief Constructs an empty list, the size is only a hint like for List (nodes are allocated on demand).
+     */
+    explicit UnrolledList(int /*size*/)
+    {
+    }
+
+    /**
+     * @brief Constructs an empty list whose nodes are obtained from the given allocator.
+     *
+     * @param allocator The allocator for the node slabs.
+     */
+    explicit UnrolledList(const Allocator& allocator) : mNodes(allocator)
+    {
+    }
+
+    /**
+     * @brief Constructor to initialize with an initializer list.
+     *
+     * @param list An initializer list to populate the list.
+     *
+     * @complexity O(n), where n is the number of elements in the initializer list.
+     */
+    UnrolledList(std::initializer_list<T> list, const Allocator& allocator = Allocator()) : mNodes(allocator)
+    {
+        for (const auto& item : list)
+        {
+            append(item);
+        }
+    }
+
+    ~UnrolledList()
+    {
+        destroyElements();
+    }
+
+    // Copy constructor
+    UnrolledList(const UnrolledList& other)
+        : mNodes(NodeAllocatorTraits::select_on_container_copy_construction(other.mNodes.getAllocator()))
+    {
+        for (const auto& item : other)
+        {
+            append(item);
+        }
+    }
+
+    // Copy assignment operator
+    UnrolledList& operator=(const UnrolledList& other)
+    {
+        if (this == &other)
+        {
+            return *this;  // Avoid self-assignment.
+        }
+
+        clear();
+
+        if constexpr (NodeAllocatorTraits::propagate_on_container_copy_assignment::value)
+        {
+            if (mNodes.getAllocator() != other.mNodes.getAllocator())
+            {
+                mNodes.release();  // The free nodes belong to the previous allocator.
+            }
+            mNodes.getAllocator() = other.mNodes.getAllocator();
+        }
+
+        for (const auto& item : other)
+        {
+            append(item);
+        }
+
+        return *this;
+    }
+
+    // Move constructor
+    UnrolledList(UnrolledList&& other) noexcept
+        : mHead(other.mHead), mTail(other.mTail), mSize(other.mSize), mNodeCount(other.mNodeCount),
+          mNodes(std::move(other.mNodes))
+    {
+        other.mHead = nullptr;
+        other.mTail = nullptr;
+        other.mSize = 0;
+        other.mNodeCount = 0;
+    }
+
+    // Move assignment operator
+    UnrolledList& operator=(UnrolledList&& other) noexcept(
+        NodeAllocatorTraits::propagate_on_container_move_assignment::value ||
+        NodeAllocatorTraits::is_always_equal::value)
+    {
+        if (this == &other)
+        {
+            return *this;  // Avoid self-assignment.
+        }
+
+        clear();
+
+        if constexpr (
+            !NodeAllocatorTraits::propagate_on_container_move_assignment::value &&
+            !NodeAllocatorTraits::is_always_equal::value)
+        {
+            if (mNodes.getAllocator() != other.mNodes.getAllocator())
+            {
+                // The nodes of other can not be released by our allocator, move the values instead.
+                for (auto& item : other)
+                {
+                    append(std::move(item));
+                }
+                return *this;
+            }
+        }
+
+        // Take the pool holding the nodes of other, other gets ours and its free nodes.
+        mNodes.swapNodes(other.mNodes);
+        if constexpr (NodeAllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            mNodes.swapAllocators(other.mNodes);
+        }
+
+        mHead = other.mHead;
+        mTail = other.mTail;
+        mSize = other.mSize;
+        mNodeCount = other.mNodeCount;
+
+        other.mHead = nullptr;
+        other.mTail = nullptr;
+        other.mSize = 0;
+        other.mNodeCount = 0;
+
+        return *this;
+    }
+
+    /**
+     * @brief Access the element at the specified index.
+     *
+     * @param index The index of the element to access.
+     * @return Reference to the element at the specified index.
+     * @throws std::out_of_range if the index is out of bounds and the access policy is CheckedAccess.
+     *
+     * @complexity O(n / B), the nodes are skipped by their sizes from the closest end of the list.
+     */
+    T& operator[](int index)
+    {
+        Access::checkIndex(index, mSize, "Index out of range in UnrolledList::operator[]");
+        const auto [node, offset] = locate(index);
+        return node->data()[offset];
+    }
+    const T& operator[](int index) const
+    {
+        Access::checkIndex(index, mSize, "Index out of range in UnrolledList::operator[]");
+        const auto [node, offset] = locate(index);
+        return node->data()[offset];
+    }
+
+    /**
+     * @brief Compares two lists element by element.
+     *
+     * @return True if the lists have the same size and the same elements, false otherwise.
+     *
+     * @complexity O(n)
+     */
+    bool operator==(const UnrolledList& other) const
+    {
+        if (mSize != other.mSize)
+        {
+            return false;
+        }
+        return std::equal(begin(), end(), other.begin());
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(mHead, 0);
+    }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(mHead, 0);
+    }
+
+    /**
+     * @brief Returns an iterator pointing past the last element in the list.
+     *
+     * @return An iterator one past the last element of the tail node.
+     */
+    iterator end() noexcept
+    {
+        return iterator(mTail, mTail != nullptr ? mTail->count : 0);
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(mTail, mTail != nullptr ? mTail->count : 0);
+    }
+
+    /**
+     * @brief Append an item to the list.
+     *
+     * @param item The item to append.
+     *
+     * @complexity O(1), a new node is taken from the pool every B appends.
+     */
+    void append(const T& item)
+    {
+        emplaceBack(item);
+    }
+    void append(T&& item)
+    {
+        emplaceBack(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the end of the list.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A reference to the new element.
+     *
+     * @complexity O(1)
+     */
+    template <typename... Args>
+    T& emplaceBack(Args&&... args)
+    {
+        if (mTail == nullptr || mTail->count == B)
+        {
+            linkAfter(mTail, createNode());
+        }
+        T* slot = new (mTail->data() + mTail->count) T(std::forward<Args>(args)...);
+        mTail->count++;
+        mSize++;
+        return *slot;
+    }
+
+    /**
+     * @brief Insert an item at the specified position.
+     *
+     * The elements after it in the same node shift by one; a full node is first split in two halves.
+     *
+     * @param item The item to insert into the list.
+     * @param pos The index the item will have, from 0 to getSize().
+     * @return Iterator to the inserted element.
+     * @throws std::out_of_range if the position is out of bounds.
+     *
+     * @complexity O(n / B + B): finding the node, then shifting inside of it.
+     */
+    iterator insert(const T& item, int pos)
+    {
+        if (pos < 0 || pos > mSize)
+        {
+            throw std::out_of_range("Index out of bounds in UnrolledList::insert");
+        }
+        if (pos == mSize)
+        {
+            append(item);
+            return end() - 1;
+        }
+
+        auto [node, offset] = locate(pos);
+        if (node->count == B)
+        {
+            splitNode(node);
+            if (offset > node->count)
+            {
+                offset -= node->count;
+                node = node->next;
+            }
+        }
+
+        T* data = node->data();
+        if (offset == node->count)
+        {
+            new (data + offset) T(item);
+        }
+        else
+        {
+            T value(item);  // The item may be an element of the list that is about to move.
+            new (data + node->count) T(std::move(data[node->count - 1]));
+            std::move_backward(data + offset, data + node->count - 1, data + node->count);
+            data[offset] = std::move(value);
+        }
+        node->count++;
+        mSize++;
+
+        return iterator(node, offset);
+    }
+
+    /**
+     * @brief Erase the element at the specified position.
+     *
+     * The elements after it in the same node shift by one. An empty node is released, a node that falls under a
+     * quarter full absorbs its successor when both fit in one node.
+     *
+     * @param pos The index of the element to erase.
+     * @return Iterator to the element next to the erased element.
+     * @throws std::out_of_range if the list is empty or the position is out of bounds.
+     *
+     * @complexity O(n / B + B): finding the node, then shifting inside of it.
+     */
+    iterator erase(int pos)
+    {
+        if (isEmpty())
+        {
+            throw std::out_of_range("The list is empty in UnrolledList::erase");
+        }
+        if (pos < 0 || pos >= mSize)
+        {
+            throw std::out_of_range("Index out of bounds in UnrolledList::erase");
+        }
+
+        auto [node, offset] = locate(pos);
+        T* data = node->data();
+        std::move(data + offset + 1, data + node->count, data + offset);
+        std::destroy_at(data + node->count - 1);
+        node->count--;
+        mSize--;
+
+        if (node->count == 0)
+        {
+            Node* next = node->next;
+            unlink(node);
+            return next != nullptr ? iterator(next, 0) : end();
+        }
+
+        if (node->count < B / 4 && node->next != nullptr && node->count + node->next->count <= B)
+        {
+            mergeNext(node);
+        }
+
+        if (offset == node->count && node->next != nullptr)
+        {
+            return iterator(node->next, 0);
+        }
+        return iterator(node, offset);
+    }
+
+    /**
+     * @brief Get the size of the list.
+     *
+     * @return The total number of elements inside the list.
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Get the number of nodes, for monitoring how dense the list is.
+     *
+     * @return The number of nodes holding the elements.
+     */
+    [[nodiscard]] int getNodeCount() const noexcept
+    {
+        return mNodeCount;
+    }
+
+    /**
+     * @brief Checks if the list has no elements.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @brief Destroys all elements, leaving the list empty. The nodes stay in the pool for the next insertions.
+     *
+     * @complexity O(n) for elements with a destructor, O(n / B) otherwise.
+     */
+    void clear()
+    {
+        destroyElements();
+        for (Node* node = mHead; node != nullptr;)
+        {
+            Node* next = node->next;
+            mNodes.deallocate(node);
+            node = next;
+        }
+        mHead = nullptr;
+        mTail = nullptr;
+        mSize = 0;
+        mNodeCount = 0;
+    }
+
+    /**
+     * @return A copy of the allocator used for the nodes, rebound to T.
+     */
+    [[nodiscard]] Allocator getAllocator() const noexcept
+    {
+        return Allocator(mNodes.getAllocator());
+    }
+
+private:
+    struct Position
+    {
+        Node* node;
+        int offset;
+    };
+
+    // Find the node holding the element at the index, walking from the closest end of the list
+    Position locate(int index) const noexcept
+    {
+        if (index < mSize / 2)
+        {
+            Node* node = mHead;
+            while (index >= node->count)
+            {
+                index -= node->count;
+                node = node->next;
+            }
+            return {node, index};
+        }
+
+        Node* node = mTail;
+        int fromEnd = mSize - 1 - index;
+        while (fromEnd >= node->count)
+        {
+            fromEnd -= node->count;
+            node = node->prev;
+        }
+        return {node, node->count - 1 - fromEnd};
+    }
+
+    Node* createNode()
+    {
+        Node* node = mNodes.allocate();
+        new (node) Node;  // Default-initialized, the element slots stay raw memory
+        mNodeCount++;
+        return node;
+    }
+
+    // Insert node in the chain after position, at the head if position is null
+    void linkAfter(Node* position, Node* node) noexcept
+    {
+        node->prev = position;
+        node->next = position != nullptr ? position->next : mHead;
+        if (node->next != nullptr)
+        {
+            node->next->prev = node;
+        }
+        else
+        {
+            mTail = node;
+        }
+        if (position != nullptr)
+        {
+            position->next = node;
+        }
+        else
+        {
+            mHead = node;
+        }
+    }
+
+    // Remove an empty node from the chain and give it back to the pool
+    void unlink(Node* node) noexcept
+    {
+        (node->prev != nullptr ? node->prev->next : mHead) = node->next;
+        (node->next != nullptr ? node->next->prev : mTail) = node->prev;
+        mNodes.deallocate(node);
+        mNodeCount--;
+    }
+
+    // Move the upper half of a full node to a new node linked after it
+    void splitNode(Node* node)
+    {
+        Node* upper = createNode();
+        const int keep = node->count - node->count / 2;
+        T* source = node->data();
+        T* destination = upper->data();
+        for (int i = keep; i < node->count; ++i)
+        {
+            new (destination + upper->count) T(std::move(source[i]));
+            upper->count++;
+            std::destroy_at(source + i);
+        }
+        node->count = keep;
+        linkAfter(node, upper);
+    }
+
+    // Move every element of the successor of node into node and release the successor
+    void mergeNext(Node* node)
+    {
+        Node* next = node->next;
+        T* source = next->data();
+        T* destination = node->data();
+        for (int i = 0; i < next->count; ++i)
+        {
+            new (destination + node->count) T(std::move(source[i]));
+            node->count++;
+            std::destroy_at(source + i);
+        }
+        next->count = 0;
+        unlink(next);
+    }
+
+    void destroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (Node* node = mHead; node != nullptr; node = node->next)
+            {
+                std::destroy(node->data(), node->data() + node->count);
+            }
+        }
+    }
+
+    Node* mHead{nullptr};  ///< The first node of the list.
+    Node* mTail{nullptr};  ///< The last node of the list.
+    int mSize{0};          ///< The number of elements.
+    int mNodeCount{0};     ///< The number of nodes.
+
+    Pool mNodes;  ///< The pool providing the nodes, it owns the allocator.
+};
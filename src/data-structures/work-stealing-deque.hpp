@@ -0,0 +1,214 @@
+#pragma once
+
+#include <atomic>       // for std::atomic
+#include <cache-line.hpp>
+#include <cstddef>      // for std::size_t
+#include <cstdint>      // for std::int64_t
+#include <memory>       // for std::unique_ptr, std::make_unique
+#include <stdexcept>    // for std::invalid_argument
+#include <type_traits>  // for std::is_trivially_copyable_v
+#include <vector>
+
+/**
+ * @brief A lock-free double-ended queue owned by one thread that other threads steal from (a Chase–Lev deque).
+ *
+ * The owner pushes and pops at the bottom, like a stack, while any number of thieves take the oldest elements from
+ * the top. The elements live in a power-of-two circular array indexed by two ever-growing counters:
+ * - push() only writes the bottom counter, so it costs no atomic read-modify-write.
+ * - pop() lowers the bottom counter and only races the thieves, with a compare-and-swap on the top counter, when a
+ *   single element is left.
+ * - steal() claims the top element with a compare-and-swap on the top counter.
+ *
+ * The owner and the thieves order their accesses to the two counters with sequentially consistent operations (the
+ * Lê et al. formulation of the algorithm with the fences folded into the operations).
+ *
+ * When the array is full, push() copies the elements into one twice the size. A thief may still be reading the old
+ * array, so the old arrays are kept until the deque is destroyed; the memory is at most twice the largest array.
+ *
+ * @tparam T The type of elements, trivially copyable (usually a pointer): a thief reads an element before knowing if
+ * it may take it.
+ */
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque elements must be trivially copyable");
+
+    /**
+     * @brief A circular array of atomic slots, indexed by the unwrapped position.
+     */
+    struct Array
+    {
+        explicit Array(std::size_t capacity) : mask(capacity - 1), slots(std::make_unique<std::atomic<T>[]>(capacity))
+        {
+        }
+
+        T load(std::int64_t position) const noexcept
+        {
+            return slots[static_cast<std::size_t>(position) & mask].load(std::memory_order_relaxed);
+        }
+        void store(std::int64_t position, T value) noexcept
+        {
+            slots[static_cast<std::size_t>(position) & mask].store(value, std::memory_order_relaxed);
+        }
+
+        std::size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Construct an empty deque.
+     *
+     * @param capacity The initial number of slots, rounded up to a power of two. The deque grows past it.
+     *
+     * @throws std::invalid_argument if the capacity is not positive.
+     */
+    explicit WorkStealingDeque(int capacity = 64)
+    {
+        if (capacity <= 0)
+        {
+            throw std::invalid_argument("WorkStealingDeque capacity must be positive");
+        }
+        std::size_t size = 1;
+        while (size < static_cast<std::size_t>(capacity))
+        {
+            size *= 2;
+        }
+        mArrays.push_back(std::make_unique<Array>(size));
+        mArray.store(mArrays.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Push an element at the bottom. Only the owner thread may call it.
+     *
+     * @complexity O(1) amortized, wait-free unless the array grows.
+     */
+    void push(T value)
+    {
+        const std::int64_t bottom = mBottom.load(std::memory_order_relaxed);
+        const std::int64_t top = mTop.load(std::memory_order_acquire);
+        Array* array = mArray.load(std::memory_order_relaxed);
+        if (static_cast<std::size_t>(bottom - top) > array->mask)
+        {
+            array = grow(array, top, bottom);
+        }
+        array->store(bottom, value);
+        mBottom.store(bottom + 1, std::memory_order_release);  // Publishes the element to the thieves
+    }
+
+    /**
+     * @brief Take the most recently pushed element. Only the owner thread may call it.
+     *
+     * @param value Where the element is copied to.
+     * @return True if an element was taken, false if the deque is empty or a thief took the last element.
+     *
+     * @complexity O(1), wait-free.
+     */
+    bool pop(T& value)
+    {
+        const std::int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+        Array* array = mArray.load(std::memory_order_relaxed);
+        mBottom.store(bottom, std::memory_order_seq_cst);  // Reserves the bottom element before reading the top
+        std::int64_t top = mTop.load(std::memory_order_seq_cst);
+        if (top > bottom)
+        {
+            mBottom.store(bottom + 1, std::memory_order_relaxed);  // Empty
+            return false;
+        }
+
+        const T element = array->load(bottom);
+        if (top < bottom)
+        {
+            value = element;  // More than one element: no thief can reach this one
+            return true;
+        }
+
+        // The last element: whoever moves the top past it takes it
+        const bool taken =
+            mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        mBottom.store(bottom + 1, std::memory_order_relaxed);
+        if (taken)
+        {
+            value = element;
+        }
+        return taken;
+    }
+
+    /**
+     * @brief Take the oldest element. Safe to call from any thread.
+     *
+     * @param value Where the element is copied to.
+     * @return True if an element was taken, false if the deque looked empty or another thread took the element first.
+     *
+     * @complexity O(1), lock-free.
+     */
+    bool steal(T& value)
+    {
+        std::int64_t top = mTop.load(std::memory_order_seq_cst);
+        const std::int64_t bottom = mBottom.load(std::memory_order_seq_cst);
+        if (top >= bottom)
+        {
+            return false;
+        }
+
+        const T element = mArray.load(std::memory_order_acquire)->load(top);
+        if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;  // The owner or another thief took it
+        }
+        value = element;
+        return true;
+    }
+
+    /**
+     * @return The number of elements, exact only when no thread is running an operation.
+     */
+    [[nodiscard]] int getSize() const noexcept
+    {
+        const std::int64_t bottom = mBottom.load(std::memory_order_acquire);
+        const std::int64_t top = mTop.load(std::memory_order_acquire);
+        return bottom > top ? static_cast<int>(bottom - top) : 0;
+    }
+
+    /**
+     * @return True if the deque looked empty, exact only when no thread is running an operation.
+     */
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return getSize() == 0;
+    }
+
+    /**
+     * @return The number of slots of the current array, a power of two.
+     */
+    [[nodiscard]] int getCapacity() const noexcept
+    {
+        return static_cast<int>(mArray.load(std::memory_order_acquire)->mask + 1);
+    }
+
+private:
+    /**
+     * @brief Copy the elements in [top, bottom) into an array twice the size and make it the current one.
+     */
+    Array* grow(const Array* array, std::int64_t top, std::int64_t bottom)
+    {
+        mArrays.push_back(std::make_unique<Array>(2 * (array->mask + 1)));
+        Array* grown = mArrays.back().get();
+        for (std::int64_t position = top; position < bottom; ++position)
+        {
+            grown->store(position, array->load(position));
+        }
+        mArray.store(grown, std::memory_order_release);
+        return grown;
+    }
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> mTop{0};     ///< The position of the oldest element.
+    alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> mBottom{0};  ///< The position after the newest element.
+    std::atomic<Array*> mArray{nullptr};                             ///< The current array.
+    std::vector<std::unique_ptr<Array>> mArrays;  ///< Every array used, owner only: thieves may read retired ones.
+};
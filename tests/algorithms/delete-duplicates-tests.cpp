@@ -3,6 +3,7 @@
 #include <dynamic-array.hpp>
 #include <list.hpp>
 #include <string>
+#include <unrolled-list.hpp>
 
 template <typename ContainerType>
 class DeleteDuplicatesTestWithInt : public testing::Test
@@ -10,7 +11,7 @@ class DeleteDuplicatesTestWithInt : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(DeleteDuplicatesTestWithInt, ContainerTypesInt);
 
@@ -103,6 +104,26 @@ TYPED_TEST(DeleteDuplicatesTestWithInt, LargeContainer)
     EXPECT_EQ(container, expected);
 }
 
+TYPED_TEST(DeleteDuplicatesTestWithInt, VeryLargeContainer)
+{
+    constexpr int size = 50000;
+    constexpr int unique = 1000;
+    TypeParam container;
+    for (int i = 0; i < size; ++i)
+    {
+        container.append(i % unique);  // Every value past the first 1000 is a duplicate
+    }
+
+    deleteDuplicates(container);
+
+    ASSERT_EQ(container.getSize(), unique);
+    int expected = 0;
+    for (const int value : container)
+    {
+        EXPECT_EQ(value, expected++);
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 
 template <typename ContainerType>
@@ -111,7 +132,7 @@ class DeleteDuplicatesTestWithString : public testing::Test
 };
 
 // Define the container types to be tested for strings
-using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>>;
+using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>, UnrolledList<std::string>>;
 
 TYPED_TEST_SUITE(DeleteDuplicatesTestWithString, ContainerTypesString);
 
@@ -2,6 +2,7 @@
 #include <difference-elements.hpp>
 #include <dynamic-array.hpp>
 #include <list.hpp>
+#include <unrolled-list.hpp>
 
 // Templated test fixture for both DynamicArray and List with `int`
 template <typename ContainerType>
@@ -10,7 +11,7 @@ class DifferenceAlgorithmsTestWithInt : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(DifferenceAlgorithmsTestWithInt, ContainerTypesInt);
 
@@ -132,7 +133,7 @@ class DifferenceAlgorithmsTestWithString : public testing::Test
 };
 
 // Define the container types to be tested for strings
-using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>>;
+using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>, UnrolledList<std::string>>;
 
 TYPED_TEST_SUITE(DifferenceAlgorithmsTestWithString, ContainerTypesString);
 
@@ -2,6 +2,7 @@
 #include <dynamic-array.hpp>
 #include <intersection-elements.hpp>
 #include <list.hpp>
+#include <unrolled-list.hpp>
 
 template <typename ContainerType>
 class IntersectionAlgorithmsTestWithInt : public testing::Test
@@ -9,7 +10,7 @@ class IntersectionAlgorithmsTestWithInt : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(IntersectionAlgorithmsTestWithInt, ContainerTypesInt);
 
@@ -132,7 +133,7 @@ class IntersectionAlgorithmsTestWithString : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>>;
+using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>, UnrolledList<std::string>>;
 
 TYPED_TEST_SUITE(IntersectionAlgorithmsTestWithString, ContainerTypesString);
 
@@ -3,6 +3,7 @@
 #include <is-sorted.hpp>
 #include <list.hpp>
 #include <static-array.hpp>
+#include <unrolled-list.hpp>
 
 template <typename ContainerType>
 class IsSortedAlgorithmsTestWithInt : public testing::Test
@@ -10,7 +11,7 @@ class IsSortedAlgorithmsTestWithInt : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(IsSortedAlgorithmsTestWithInt, ContainerTypesInt);
 
@@ -152,7 +153,7 @@ class IsSortedAlgorithmsTestWithString : public testing::Test
 };
 
 // Define the container types to be tested for strings
-using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>>;
+using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>, UnrolledList<std::string>>;
 
 TYPED_TEST_SUITE(IsSortedAlgorithmsTestWithString, ContainerTypesString);
 
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <unrolled-list.hpp>
 
 #include <dynamic-array.hpp>
 #include <list.hpp>
@@ -12,7 +13,7 @@ class MaxElementAlgorithmsTestWithInt : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(MaxElementAlgorithmsTestWithInt, ContainerTypesInt);
 
@@ -103,7 +104,7 @@ class MaxElementAlgorithmsTestWithString : public testing::Test
 };
 
 // Define the container types to be tested for strings
-using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>>;
+using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>, UnrolledList<std::string>>;
 
 TYPED_TEST_SUITE(MaxElementAlgorithmsTestWithString, ContainerTypesString);
 
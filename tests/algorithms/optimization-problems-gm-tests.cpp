@@ -3,6 +3,7 @@
 #include <utility>
 #include <cstdint>
 #include <numeric>
+#include <random>
 
 #include <optimization-problems-gm.hpp>
 
@@ -294,6 +295,111 @@ TEST(PrimTest, ComplexGraph)
     EXPECT_EQ(sumWeights(mst), expectedTotalWeight);
 }
 
+WeightAdjacencyList makeAdjacencyList(const WeightedEdgeList& graph, int numVertices)
+{
+    WeightAdjacencyList adj(numVertices);
+    for (const auto& [u, v, w] : graph)
+    {
+        adj[u].emplace_back(v, w);
+        adj[v].emplace_back(u, w);
+    }
+    return adj;
+}
+
+// A connected graph: a path through every vertex plus random edges, with random weights
+WeightedEdgeList makeRandomGraph(int numVertices, int extraEdges, unsigned seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> vertex(0, numVertices - 1);
+    std::uniform_int_distribution<int> weight(1, 100);
+    WeightedEdgeList graph;
+    for (int u = 1; u < numVertices; ++u)
+    {
+        graph.emplace_back(u - 1, u, weight(generator));
+    }
+    for (int i = 0; i < extraEdges; ++i)
+    {
+        const int u = vertex(generator);
+        const int v = vertex(generator);
+        if (u != v)
+        {
+            graph.emplace_back(u, v, weight(generator));
+        }
+    }
+    return graph;
+}
+
+TEST(PrimHeapTest, EmptyGraph)
+{
+    WeightAdjacencyList adj;
+    EXPECT_TRUE(primsMethod(adj).empty());
+}
+
+TEST(PrimHeapTest, SingleNode)
+{
+    WeightAdjacencyList adj(1);
+    EXPECT_TRUE(primsMethod(adj).empty());
+}
+
+TEST(PrimHeapTest, ComplexGraph)
+{
+    WeightedEdgeList graph = {{0, 1, 2}, {0, 3, 6}, {0, 2, 4}, {1, 2, 1}, {1, 4, 3},
+                              {2, 3, 3}, {2, 5, 7}, {3, 5, 5}, {4, 5, 7}};
+    auto mst = primsMethod(makeAdjacencyList(graph, 6));
+
+    ASSERT_EQ(mst.size(), 5);
+    int totalWeight = 0;
+    std::vector<bool> reached(6, false);
+    reached[0] = true;
+    for (const auto& [parent, v, w] : mst)
+    {
+        EXPECT_TRUE(reached[parent]);  // Edges come in the order vertices join the tree
+        EXPECT_FALSE(reached[v]);
+        reached[v] = true;
+        totalWeight += w;
+    }
+    EXPECT_EQ(totalWeight, 2 + 1 + 3 + 5 + 3);
+}
+
+TEST(PrimHeapTest, DisconnectedGraphSpansFirstComponent)
+{
+    WeightedEdgeList graph = {{0, 1, 4}, {1, 2, 1}, {0, 2, 2}, {3, 4, 1}};
+    auto mst = primsMethod(makeAdjacencyList(graph, 5));
+
+    ASSERT_EQ(mst.size(), 2);
+    EXPECT_EQ(std::get<2>(mst[0]) + std::get<2>(mst[1]), 3);
+}
+
+TEST(PrimHeapTest, MatchesAdjacencyMatrixVersion)
+{
+    for (unsigned seed = 0; seed < 10; ++seed)
+    {
+        const int numVertices = 60;
+        WeightedEdgeList graph = makeRandomGraph(numVertices, 200, seed);
+        WeightedEdgeList simple;  // The matrix keeps one edge per pair: the last one
+        AdjacencyMatrix adj = makeAdjacencyMatrix(graph, numVertices);
+        for (int u = 0; u < numVertices; ++u)
+        {
+            for (int v = u + 1; v < numVertices; ++v)
+            {
+                if (adj[u][v] != 0)
+                {
+                    simple.emplace_back(u, v, adj[u][v]);
+                }
+            }
+        }
+
+        auto mst = primsMethod(makeAdjacencyList(simple, numVertices));
+        int totalWeight = 0;
+        for (const auto& edge : mst)
+        {
+            totalWeight += std::get<2>(edge);
+        }
+        EXPECT_EQ(static_cast<int>(mst.size()), numVertices - 1);
+        EXPECT_EQ(totalWeight, sumWeights(primsMethod(adj)));
+    }
+}
+
 ///////////////////////////////////////////////////////////
 
 TEST(DijkstraTest, HandlesEmptyGraph)
@@ -370,3 +476,62 @@ TEST(DijkstraTest, ComplexCase)
     EXPECT_EQ(result[4], 6);
     EXPECT_EQ(result[5], 11);
 }
+
+TEST(DijkstraHeapTest, HandlesEmptyGraphAndInvalidSource)
+{
+    WeightAdjacencyList emptyGraph;
+    EXPECT_TRUE(dijkstraMethod(emptyGraph, 0).empty());
+
+    WeightAdjacencyList graph = makeAdjacencyList({{0, 1, 1}}, 2);
+    EXPECT_TRUE(dijkstraMethod(graph, -1).empty());
+    EXPECT_TRUE(dijkstraMethod(graph, 2).empty());
+}
+
+TEST(DijkstraHeapTest, DirectedGraph)
+{
+    WeightAdjacencyList graph(4);
+    graph[0] = {{1, 1}, {2, 4}};
+    graph[1] = {{2, 2}};
+    graph[3] = {{0, 1}};  // Leads into the graph but cannot be reached
+
+    auto result = dijkstraMethod(graph, 0);
+    ASSERT_EQ(result.size(), 4);
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[1], 1);
+    EXPECT_EQ(result[2], 3);
+    EXPECT_EQ(result[3], std::numeric_limits<int>::max());
+}
+
+TEST(DijkstraHeapTest, ComplexCase)
+{
+    WeightedEdgeList edges = {{0, 1, 1}, {0, 2, 5}, {1, 2, 3}, {1, 3, 10}, {1, 4, 8},
+                              {2, 4, 2}, {3, 4, 3}, {3, 5, 2}, {4, 5, 7}};
+
+    auto result = dijkstraMethod(makeAdjacencyList(edges, 6), 0);
+    EXPECT_EQ(result, (std::vector<int>{0, 1, 4, 9, 6, 11}));
+}
+
+TEST(DijkstraHeapTest, MatchesAdjacencyMatrixVersion)
+{
+    for (unsigned seed = 0; seed < 10; ++seed)
+    {
+        const int numVertices = 60;
+        WeightedEdgeList graph = makeRandomGraph(numVertices, 150, seed);
+        graph.emplace_back(numVertices, numVertices + 1, 1);  // A second component
+        AdjacencyMatrix adj = makeAdjacencyMatrix(graph, numVertices + 2);
+        WeightedEdgeList simple;
+        for (int u = 0; u < numVertices + 2; ++u)
+        {
+            for (int v = u + 1; v < numVertices + 2; ++v)
+            {
+                if (adj[u][v] != 0)
+                {
+                    simple.emplace_back(u, v, adj[u][v]);
+                }
+            }
+        }
+
+        const int source = static_cast<int>(seed);
+        EXPECT_EQ(dijkstraMethod(makeAdjacencyList(simple, numVertices + 2), source), dijkstraMethod(adj, source));
+    }
+}
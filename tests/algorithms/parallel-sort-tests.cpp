@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <dynamic-array.hpp>
+#include <parallel-sort.hpp>
+#include <vector>
+
+// Large enough to spawn tasks, with runs of duplicates; the result is checked for 1 worker (no threads) and several
+TEST(ParallelQuickSortTests, SortsLikeStdSort)
+{
+    std::vector<int> data;
+    unsigned int seed = 12345;
+    for (int i = 0; i < 100'000; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        data.push_back(static_cast<int>((seed >> 16) % 5000));
+    }
+    std::vector<int> expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    for (int workers : {1, 4})
+    {
+        TaskScheduler scheduler(workers);
+        std::vector<int> sorted = data;
+        parallelQuickSort(scheduler, sorted.begin(), sorted.end());
+        EXPECT_EQ(sorted, expected) << workers << " workers";
+    }
+}
+
+TEST(ParallelQuickSortTests, SortsSmallAndEmptyRanges)
+{
+    TaskScheduler scheduler(2);
+    std::vector<int> empty;
+    parallelQuickSort(scheduler, empty.begin(), empty.end());
+    EXPECT_TRUE(empty.empty());
+
+    DynamicArray<int> small{5, 3, 8, 1, 2};
+    parallelQuickSort(scheduler, small.begin(), small.end());
+    EXPECT_EQ(small, (DynamicArray<int>{1, 2, 3, 5, 8}));
+}
+
+TEST(MergeKSortParallelTest, EmptyInput)
+{
+    TaskScheduler scheduler(2);
+    std::vector<std::vector<int>> input;
+    auto result = parallelMergeKSort(scheduler, input);
+    EXPECT_FALSE(result.has_value());
+}
+
+TEST(MergeKSortParallelTest, VectorsWithEmptyVectors)
+{
+    TaskScheduler scheduler(2);
+    std::vector<std::vector<int>> input = {{}, {1, 2}, {}, {0, 3}};
+    auto result = parallelMergeKSort(scheduler, input);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST(MergeKSortParallelTest, MatchesRecursiveMode)
+{
+    std::vector<std::vector<int>> input(100);
+    for (int i = 0; i < 100; ++i)
+    {
+        for (int j = 0; j < i; ++j)
+        {
+            input[i].push_back((i * 7 + j * 13) % 50 + j * 50);
+        }
+    }
+    const auto expected = mergeKSort<true>(input);
+
+    for (int workers : {1, 4})
+    {
+        TaskScheduler scheduler(workers);
+        EXPECT_EQ(parallelMergeKSort(scheduler, input), expected) << workers << " workers";
+    }
+}
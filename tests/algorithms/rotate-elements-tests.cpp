@@ -3,6 +3,7 @@
 #include <list.hpp>
 #include <rotate-elements.hpp>
 #include <static-array.hpp>
+#include <unrolled-list.hpp>
 
 // Templated test fixture for both DynamicArray and List with `int`
 template <typename ContainerType>
@@ -11,7 +12,7 @@ class RotateAlgorithmsTestWithInt : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(RotateAlgorithmsTestWithInt, ContainerTypesInt);
 
@@ -68,7 +69,7 @@ class RotateAlgorithmsTestWithString : public testing::Test
 };
 
 // Define the container types to be tested for strings
-using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>>;
+using ContainerTypesString = ::testing::Types<DynamicArray<std::string>, List<std::string>, UnrolledList<std::string>>;
 
 TYPED_TEST_SUITE(RotateAlgorithmsTestWithString, ContainerTypesString);
 
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <unrolled-list.hpp>
 
 #include <binary-search.hpp>
 #include <dynamic-array.hpp>
@@ -15,7 +16,7 @@ public:
 };
 
 // Define the mContainer types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, StaticArray<int, 10>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, StaticArray<int, 10>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(SearchAlgortithmsTestWithInt, ContainerTypesInt);
 
@@ -119,8 +120,10 @@ TYPED_TEST(SearchAlgortithmsTestWithInt, BinarySearchOneElementFound)
 {
     TypeParam container = {10};
 
-    // Search for the only element in the mContainer
-    auto it = binarySearch(container.begin(), container.end(), 10);
+    // Search for the only element in the mContainer, in a one element range since a StaticArray holds zeros after it
+    auto last = container.begin();
+    ++last;
+    auto it = binarySearch(container.begin(), last, 10);
 
     // Verify that the iterator points to the correct element
     EXPECT_EQ(*it, 10);
@@ -208,7 +211,8 @@ public:
 
 // Define the mContainer types to be tested for strings
 using ContainerTypesString =
-    ::testing::Types<DynamicArray<std::string>, StaticArray<std::string, 5>, List<std::string>>;
+    ::testing::Types<DynamicArray<std::string>, StaticArray<std::string, 5>, List<std::string>,
+                     UnrolledList<std::string>>;
 
 TYPED_TEST_SUITE(SearchAlgortithmsTestWithString, ContainerTypesString);
 
@@ -3,6 +3,7 @@
 #include <list.hpp>
 #include <shift-elements.hpp>
 #include <static-array.hpp>
+#include <unrolled-list.hpp>
 
 // Templated test fixture for both DynamicArray and List with `int`
 template <typename ContainerType>
@@ -11,7 +12,7 @@ class ShiftAlgorithmsTestWithInt : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(ShiftAlgorithmsTestWithInt, ContainerTypesInt);
 
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <sorting-network.hpp>
+#include <static-array.hpp>
+#include <string>
+#include <vector>
+
+// Run a network on 0-1 values, as ordinary compare-exchange steps
+static void runNetwork(const std::vector<Comparator>& comparators, std::vector<int>& values)
+{
+    for (const Comparator& comparator : comparators)
+    {
+        if (values[comparator.high] < values[comparator.low])
+        {
+            std::swap(values[comparator.low], values[comparator.high]);
+        }
+    }
+}
+
+template <int N>
+void expectSortsRandomBatches()
+{
+    std::mt19937 rng(N);
+    for (int round = 0; round < 200; ++round)
+    {
+        StaticArray<int, N> array;
+        for (int& value : array)
+        {
+            value = static_cast<int>(rng() % 50) - 25;
+        }
+        std::vector<int> expected(array.begin(), array.end());
+        std::sort(expected.begin(), expected.end());
+
+        sortStatic(array);
+        EXPECT_TRUE(std::equal(array.begin(), array.end(), expected.begin())) << "N = " << N;
+    }
+}
+
+// Test the number of comparators of the generated networks
+TEST(SortingNetworkTest, ComparatorCounts)
+{
+    EXPECT_EQ(SortingNetwork<0>::COUNT, 0);
+    EXPECT_EQ(SortingNetwork<1>::COUNT, 0);
+    EXPECT_EQ(SortingNetwork<2>::COUNT, 1);
+    EXPECT_EQ(SortingNetwork<4>::COUNT, 5);
+    EXPECT_EQ(SortingNetwork<8>::COUNT, 19);
+    EXPECT_EQ(SortingNetwork<16>::COUNT, 63);
+    EXPECT_EQ(SortingNetwork<32>::COUNT, 191);
+    EXPECT_EQ((MergingNetwork<16, 16>::COUNT), 65);
+}
+
+// A network sorts every input if it sorts every sequence of 0s and 1s (the 0-1 principle)
+TEST(SortingNetworkTest, SortsEveryZeroOneInput)
+{
+    for (int n = 0; n <= 18; ++n)
+    {
+        std::vector<Comparator> comparators(batcherSortComparators(n, nullptr));
+        batcherSortComparators(n, comparators.data());
+
+        for (long mask = 0; mask < (1L << n); ++mask)
+        {
+            std::vector<int> values(n);
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = static_cast<int>((mask >> i) & 1);
+            }
+            runNetwork(comparators, values);
+            ASSERT_TRUE(std::is_sorted(values.begin(), values.end())) << "n = " << n << ", mask = " << mask;
+        }
+    }
+}
+
+// A merging network only sees sorted runs, the 0-1 sorted runs are 0...01...1
+TEST(SortingNetworkTest, MergesEveryZeroOneInput)
+{
+    for (int n1 = 0; n1 <= SORTING_NETWORK_MAX_SIZE; ++n1)
+    {
+        for (int n2 = 0; n1 + n2 <= SORTING_NETWORK_MAX_SIZE; ++n2)
+        {
+            NetworkRun first;
+            NetworkRun second;
+            for (int i = 0; i < n1; ++i)
+            {
+                first.positions[first.size++] = i;
+            }
+            for (int i = 0; i < n2; ++i)
+            {
+                second.positions[second.size++] = n1 + i;
+            }
+            int count = 0;
+            batcherMergeComparators(first, second, nullptr, count);
+            std::vector<Comparator> comparators(count);
+            count = 0;
+            const NetworkRun merged = batcherMergeComparators(first, second, comparators.data(), count);
+            ASSERT_EQ(merged.size, n1 + n2);
+
+            for (int zeros1 = 0; zeros1 <= n1; ++zeros1)
+            {
+                for (int zeros2 = 0; zeros2 <= n2; ++zeros2)
+                {
+                    std::vector<int> values(n1 + n2, 1);
+                    std::fill(values.begin(), values.begin() + zeros1, 0);
+                    std::fill(values.begin() + n1, values.begin() + n1 + zeros2, 0);
+                    runNetwork(comparators, values);
+
+                    for (int k = 0; k < n1 + n2; ++k)
+                    {
+                        ASSERT_EQ(values[merged.positions[k]], k < zeros1 + zeros2 ? 0 : 1)
+                            << "n1 = " << n1 << ", n2 = " << n2 << ", k = " << k;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Test sortStatic on random batches of the sizes it is meant for
+TEST(SortingNetworkTest, SortStaticSortsRandomBatches)
+{
+    expectSortsRandomBatches<3>();
+    expectSortsRandomBatches<4>();
+    expectSortsRandomBatches<7>();
+    expectSortsRandomBatches<8>();
+    expectSortsRandomBatches<16>();
+    expectSortsRandomBatches<21>();
+    expectSortsRandomBatches<32>();
+}
+
+// Test sortStatic with a comparator, on floating point values and on strings
+TEST(SortingNetworkTest, SortStaticWithCompareAndNonArithmeticTypes)
+{
+    StaticArray<double, 5> doubles = {2.5, -1.0, 3.25, 0.0, -7.5};
+    sortStatic(doubles, std::greater<>());
+    EXPECT_TRUE((doubles == StaticArray<double, 5>{3.25, 2.5, 0.0, -1.0, -7.5}));
+
+    StaticArray<std::string, 6> strings = {"pear", "apple", "fig", "banana", "cherry", "apple"};
+    sortStatic(strings);
+    EXPECT_TRUE((strings == StaticArray<std::string, 6>{"apple", "apple", "banana", "cherry", "fig", "pear"}));
+
+    StaticArray<std::string, 4> byLength = {"ccc", "a", "dddd", "bb"};
+    sortStatic(byLength, [](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+    EXPECT_TRUE((byLength == StaticArray<std::string, 4>{"a", "bb", "ccc", "dddd"}));
+}
+
+// Test that the networks also run at compile time
+TEST(SortingNetworkTest, SortStaticAtCompileTime)
+{
+    constexpr auto sorted = []
+    {
+        StaticArray<int, 6> array = {5, 3, 6, 1, 4, 2};
+        sortStatic(array);
+        return array;
+    }();
+    static_assert(sorted == StaticArray<int, 6>{1, 2, 3, 4, 5, 6});
+    EXPECT_EQ(sorted[0], 1);
+}
+
+// Test the run time selection of the network of a range
+TEST(SortingNetworkTest, SortNetworkRangeSortsEverySize)
+{
+    std::mt19937 rng(7);
+    for (int size = 0; size <= 16; ++size)
+    {
+        std::vector<int> values(size);
+        for (int& value : values)
+        {
+            value = static_cast<int>(rng() % 100);
+        }
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        sortNetworkRange<16>(values.begin(), values.end());
+        EXPECT_EQ(values, expected) << "size = " << size;
+    }
+}
+
+// Test the merging network on runs of different sizes, with duplicates
+TEST(SortingNetworkTest, MergeNetwork)
+{
+    const int first[] = {1, 4, 4, 9};
+    const int second[] = {0, 2, 4, 5, 9, 10, 11};
+    int merged[11];
+    mergeNetwork<4, 7>(first, second, merged);
+
+    std::vector<int> expected(first, first + 4);
+    expected.insert(expected.end(), second, second + 7);
+    std::sort(expected.begin(), expected.end());
+    EXPECT_TRUE(std::equal(merged, merged + 11, expected.begin()));
+
+    const std::string words[] = {"b", "d"};
+    const std::string others[] = {"a", "c", "e"};
+    std::vector<std::string> output(5);
+    mergeNetwork<2, 3>(words, others, output.begin());
+    EXPECT_EQ(output, (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+}
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <unrolled-list.hpp>
 #include <vector>
 
 #include <bin-sort.hpp>
@@ -10,6 +12,8 @@
 #include <quick-sort.hpp>
 #include <radix-sort.hpp>
 #include <selection-sort.hpp>
+#include <sort-list.hpp>
+#include <string>
 
 /////////////////////////////////////////////////////////////////////////
 
@@ -19,7 +23,7 @@ class SortingElementsTests : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypesInt = ::testing::Types<DynamicArray<int>, List<int>, UnrolledList<int>>;
 
 TYPED_TEST_SUITE(SortingElementsTests, ContainerTypesInt);
 
@@ -189,6 +193,26 @@ TYPED_TEST(SortingElementsTests, QuickSortsUnorderedContainer)
     EXPECT_EQ(data, expected);
 }
 
+// Large enough to partition before the partitions go to the sorting networks
+TYPED_TEST(SortingElementsTests, QuickSortsLargeContainer)
+{
+    TypeParam data;
+    std::vector<int> expected;
+    unsigned int seed = 12345;
+    for (int i = 0; i < 300; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        const int value = static_cast<int>((seed >> 16) % 1000);
+        data.append(value);
+        expected.push_back(value);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    quickSort(data.begin(), data.end());
+
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+}
+
 TYPED_TEST(SortingElementsTests, QuickSortsEmptyContainer)
 {
     TypeParam data;
@@ -239,8 +263,6 @@ TYPED_TEST(SortingElementsTests, QuickSortsWithDuplicates)
     EXPECT_EQ(data, expected);
 }
 
-/////////////////////////////////////////////////////////////////////////
-
 TYPED_TEST(SortingElementsTests, CountSortsUnorderedContainer)
 {
     TypeParam data{4, 2, 4, 1, 3, 2};
@@ -383,3 +405,44 @@ TYPED_TEST(SortingElementsTests, RadixSortsThrowsOnNegative)
 }
 
 /////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////
+
+TEST(SortListTests, SortsListOfInts)
+{
+    List<int> data{5, 3, 8, 1, 2, 8, 0};
+    List<int> expected{0, 1, 2, 3, 5, 8, 8};
+
+    sortList(data);
+
+    EXPECT_EQ(data, expected);
+}
+
+TEST(SortListTests, SortsWithCustomOrdering)
+{
+    List<std::string> data{"pear", "fig", "banana", "kiwi"};
+    List<std::string> expected{"fig", "pear", "kiwi", "banana"};
+
+    sortList(data, [](const std::string& left, const std::string& right) { return left.size() < right.size(); });
+
+    EXPECT_EQ(data, expected);
+}
+
+TEST(SortListTests, SortsLargeList)
+{
+    List<int> data;
+    for (int i = 0; i < 10'000; ++i)
+    {
+        data.append((i * 7919) % 10'007);
+    }
+
+    sortList(data);
+
+    int previous = -1;
+    for (int value : data)
+    {
+        ASSERT_LE(previous, value);
+        previous = value;
+    }
+    EXPECT_EQ(data.getSize(), 10'000);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <task-scheduler.hpp>
+#include <thread>
+#include <vector>
+
+// Naive recursive Fibonacci, spawning one branch while computing the other
+static long long fibonacci(TaskScheduler& scheduler, int n)
+{
+    if (n < 2)
+    {
+        return n;
+    }
+    long long left = 0;
+    TaskGroup group(scheduler);
+    group.spawn([&] { left = fibonacci(scheduler, n - 1); });
+    const long long right = fibonacci(scheduler, n - 2);
+    group.sync();
+    return left + right;
+}
+
+// Test a scheduler without threads: everything runs on the calling thread
+TEST(TaskSchedulerTest, SingleWorkerRunsOnCallingThread)
+{
+    TaskScheduler scheduler(1);
+    EXPECT_EQ(scheduler.getWorkerCount(), 1);
+    const std::thread::id caller = std::this_thread::get_id();
+
+    std::atomic<int> elsewhere = 0;
+    const long long result = scheduler.run(
+        [&]
+        {
+            TaskGroup group(scheduler);
+            for (int i = 0; i < 10; ++i)
+            {
+                group.spawn(
+                    [&]
+                    {
+                        if (std::this_thread::get_id() != caller)
+                        {
+                            elsewhere.fetch_add(1);
+                        }
+                    });
+            }
+            group.sync();
+            return fibonacci(scheduler, 15);
+        });
+    EXPECT_EQ(result, 610);
+    EXPECT_EQ(elsewhere.load(), 0);
+    EXPECT_THROW(TaskScheduler(0), std::invalid_argument);
+}
+
+// Test nested fork-join on several workers
+TEST(TaskSchedulerTest, NestedSpawnSync)
+{
+    TaskScheduler scheduler(4);
+    EXPECT_EQ(scheduler.run([&] { return fibonacci(scheduler, 22); }), 17711);
+    EXPECT_EQ(scheduler.run([&] { return fibonacci(scheduler, 20); }), 6765);  // The scheduler is reusable
+}
+
+// Test that spawning outside run() or a task is refused
+TEST(TaskSchedulerTest, SpawnOutsideRunThrows)
+{
+    TaskScheduler scheduler(2);
+    TaskGroup group(scheduler);
+    EXPECT_THROW(group.spawn([] {}), std::logic_error);
+    EXPECT_NO_THROW(group.sync());
+}
+
+// Test that the first exception of a task is rethrown by sync() and the group is usable afterwards
+TEST(TaskSchedulerTest, SyncRethrowsTaskException)
+{
+    TaskScheduler scheduler(3);
+    std::atomic<int> finished = 0;
+    scheduler.run(
+        [&]
+        {
+            TaskGroup group(scheduler);
+            for (int i = 0; i < 100; ++i)
+            {
+                group.spawn(
+                    [&, i]
+                    {
+                        if (i == 50)
+                        {
+                            throw std::runtime_error("task");
+                        }
+                        finished.fetch_add(1);
+                    });
+            }
+            EXPECT_THROW(group.sync(), std::runtime_error);
+            EXPECT_LE(finished.load(), 99);
+
+            group.spawn([&] { finished.fetch_add(1); });
+            EXPECT_NO_THROW(group.sync());
+        });
+}
+
+// Test that parallelFor calls the body exactly once per index, whatever the grain
+TEST(TaskSchedulerTest, ParallelForVisitsEachIndexOnce)
+{
+    TaskScheduler scheduler(4);
+    constexpr int count = 100'000;
+    for (int grainSize : {0, 1, 7, count})
+    {
+        std::vector<std::atomic<int>> visits(count);
+        parallelFor(scheduler, 0, count, [&](int i) { visits[i].fetch_add(1); }, grainSize);
+        for (int i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(visits[i].load(), 1) << "index " << i << ", grain " << grainSize;
+        }
+    }
+
+    int calls = 0;
+    parallelFor(scheduler, 5, 5, [&](int) { ++calls; });
+    EXPECT_EQ(calls, 0);
+    EXPECT_THROW(
+        parallelFor(
+            scheduler, 0, 1000,
+            [](int i)
+            {
+                if (i == 999)
+                {
+                    throw std::out_of_range("index");
+                }
+            }),
+        std::out_of_range);
+}
+
+// Test that several threads may share a scheduler: their run() calls take turns
+TEST(TaskSchedulerTest, RunFromSeveralThreads)
+{
+    TaskScheduler scheduler(2);
+    std::vector<long long> results(4);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&, t] { results[t] = scheduler.run([&] { return fibonacci(scheduler, 16 + t); }); });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(results, (std::vector<long long>{987, 1597, 2584, 4181}));
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <concurrent-segmented-vector.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <useful-concepts.hpp>
+#include <vector>
+
+// Test appending from a single thread across several segments
+TEST(ConcurrentSegmentedVectorTest, AppendSingleThread)
+{
+    ConcurrentSegmentedVector<int, 4> vector;
+    EXPECT_TRUE(vector.isEmpty());
+
+    for (int i = 0; i < 100; ++i)  // Segments of 4, 8, 16, 32 and 64 elements
+    {
+        EXPECT_EQ(vector.append(i), i);
+    }
+
+    EXPECT_EQ(vector.getSize(), 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(vector.isPublished(i));
+        EXPECT_EQ(vector[i], i);
+    }
+    EXPECT_FALSE(vector.isPublished(100));
+    EXPECT_FALSE(vector.isPublished(-1));
+    EXPECT_THROW(vector[100], std::out_of_range);
+}
+
+// Test that growing never moves the elements
+TEST(ConcurrentSegmentedVectorTest, AddressesAreStable)
+{
+    ConcurrentSegmentedVector<std::string, 2> vector;
+    vector.append("first");
+    const std::string* first = &vector[0];
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        vector.emplaceBack(10, 'x');
+    }
+
+    EXPECT_EQ(&vector[0], first);
+    EXPECT_EQ(*first, "first");
+    EXPECT_EQ(vector[1000], std::string(10, 'x'));
+}
+
+// Test that a throwing constructor marks its index failed, so readers and iterators skip it
+TEST(ConcurrentSegmentedVectorTest, ThrowingConstructorLeavesFailedIndex)
+{
+    ConcurrentSegmentedVector<std::string, 2> vector;
+    vector.append("zero");
+    EXPECT_THROW(vector.emplaceBack(std::string("one"), 5), std::out_of_range);  // Position past the end
+    vector.append("two");
+
+    EXPECT_EQ(vector.getSize(), 3);
+    EXPECT_FALSE(vector.isPublished(1));
+    EXPECT_TRUE(vector.isFailed(1));
+    EXPECT_FALSE(vector.isFailed(0));
+    EXPECT_FALSE(vector.isFailed(3));
+
+    std::vector<std::string> values(vector.begin(), vector.end());
+    EXPECT_EQ(values, (std::vector<std::string>{"zero", "two"}));
+}
+
+// Test the iterators and that the vector fits the container concepts
+TEST(ConcurrentSegmentedVectorTest, Iteration)
+{
+    static_assert(HasCustomBeginEnd<ConcurrentSegmentedVector<int>>);
+    static_assert(HasGetSize<ConcurrentSegmentedVector<int>>);
+    static_assert(HasAppend<ConcurrentSegmentedVector<int>>);
+
+    ConcurrentSegmentedVector<int, 8> vector;
+    for (int i = 0; i < 50; ++i)
+    {
+        vector.append(i);
+    }
+
+    int expected = 0;
+    for (int value : vector)
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 50);
+}
+
+// Test that concurrent appends hand out every index exactly once and keep every value
+TEST(ConcurrentSegmentedVectorTest, ConcurrentAppend)
+{
+    constexpr int threadCount = 8;
+    constexpr int perThread = 20000;
+    ConcurrentSegmentedVector<int, 16> vector;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back(
+            [&vector, t]()
+            {
+                for (int i = 0; i < perThread; ++i)
+                {
+                    vector.append(t * perThread + i);
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(vector.getSize(), threadCount * perThread);
+    std::vector<int> seen(threadCount * perThread, 0);
+    std::vector<int> lastOfThread(threadCount, -1);
+    for (int value : vector)
+    {
+        seen[value]++;
+        const int thread = value / perThread;
+        EXPECT_LT(lastOfThread[thread], value);  // Every thread sees its own appends in order
+        lastOfThread[thread] = value;
+    }
+    for (int count : seen)
+    {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+// Stress test: readers poll and read published elements while writers append (meant to run under ThreadSanitizer)
+TEST(ConcurrentSegmentedVectorTest, ReadWhileAppending)
+{
+    constexpr int writerCount = 4;
+    constexpr int perWriter = 20000;
+    constexpr int total = writerCount * perWriter;
+    ConcurrentSegmentedVector<std::string, 8> vector;
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < writerCount; ++t)
+    {
+        threads.emplace_back(
+            [&vector]()
+            {
+                for (int i = 0; i < perWriter; ++i)
+                {
+                    vector.append(std::to_string(i));
+                }
+            });
+    }
+
+    std::atomic<long long> checked{0};
+    for (int r = 0; r < 2; ++r)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                int next = 0;
+                while (next < total)
+                {
+                    if (vector.isPublished(next))
+                    {
+                        const std::string& value = vector[next];  // Wait-free read of a published element
+                        checked += std::stoi(value) < perWriter ? 1 : 0;
+                        next++;
+                    }
+                    else if (done.load() && !vector.isPublished(next))
+                    {
+                        break;  // Every writer finished, so an unpublished element is lost
+                    }
+                }
+            });
+    }
+
+    for (int t = 0; t < writerCount; ++t)
+    {
+        threads[t].join();
+    }
+    done = true;
+    for (int r = writerCount; r < static_cast<int>(threads.size()); ++r)
+    {
+        threads[r].join();
+    }
+
+    EXPECT_EQ(vector.getSize(), total);
+    EXPECT_EQ(checked.load(), 2LL * total);
+}
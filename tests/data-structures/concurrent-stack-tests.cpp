@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <concurrent-stack.hpp>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test LIFO order from a single thread
+TEST(ConcurrentStackTest, PushPopSingleThread)
+{
+    ConcurrentStack<std::string> stack;
+    EXPECT_TRUE(stack.isEmpty());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        stack.push(std::to_string(i));
+    }
+    EXPECT_FALSE(stack.isEmpty());
+
+    std::string value;
+    for (int i = 99; i >= 0; --i)
+    {
+        ASSERT_TRUE(stack.pop(value));
+        EXPECT_EQ(value, std::to_string(i));
+    }
+    EXPECT_FALSE(stack.pop(value));
+    EXPECT_TRUE(stack.isEmpty());
+}
+
+// Test the batch operations: the last pushed element ends up on top
+TEST(ConcurrentStackTest, PushAllPopAll)
+{
+    ConcurrentStack<int> stack;
+    stack.push(0);
+    const std::vector<int> batch = {1, 2, 3, 4};
+    EXPECT_EQ(stack.pushAll(batch.begin(), batch.end()), 4);
+    EXPECT_EQ(stack.pushAll(batch.begin(), batch.begin()), 0);
+    stack.emplace(5);
+
+    std::vector<int> popped;
+    EXPECT_EQ(stack.popAll(std::back_inserter(popped)), 6);
+    EXPECT_EQ(popped, (std::vector<int>{5, 4, 3, 2, 1, 0}));
+    EXPECT_TRUE(stack.isEmpty());
+    EXPECT_EQ(stack.popAll(std::back_inserter(popped)), 0);
+}
+
+// Test that popped nodes are reused and the remaining elements destroyed with the stack
+TEST(ConcurrentStackTest, RecyclesNodesAndDestroysElements)
+{
+    const auto shared = std::make_shared<int>(1);
+    {
+        ConcurrentStack<std::shared_ptr<int>> stack;
+        std::shared_ptr<int> out;
+        for (int i = 0; i < 1000; ++i)
+        {
+            stack.push(shared);
+            stack.push(shared);
+            ASSERT_TRUE(stack.pop(out));
+        }
+        out.reset();
+        EXPECT_EQ(shared.use_count(), 1001);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+// Stress test: threads push, pop and drain in bulk at the same time; every element comes out exactly once
+TEST(ConcurrentStackTest, StressEveryElementOnce)
+{
+    constexpr int threadCount = 8;
+    constexpr int perThread = 20'000;
+    ConcurrentStack<int> stack;
+    std::vector<std::atomic<int>> seen(threadCount * perThread);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back(
+            [&, t]
+            {
+                std::vector<int> batch;
+                std::vector<int> drained;
+                int value = 0;
+                for (int i = 0; i < perThread; ++i)
+                {
+                    const int id = t * perThread + i;
+                    if (t % 2 == 0)
+                    {
+                        stack.push(id);
+                    }
+                    else
+                    {
+                        batch.push_back(id);
+                        if (batch.size() == 16)
+                        {
+                            stack.pushAll(batch.begin(), batch.end());
+                            batch.clear();
+                        }
+                    }
+
+                    if (i % 3 != 0 && stack.pop(value))
+                    {
+                        seen[value].fetch_add(1);
+                    }
+                    if (i % 500 == 0)
+                    {
+                        drained.clear();
+                        stack.popAll(std::back_inserter(drained));
+                        for (int id : drained)
+                        {
+                            seen[id].fetch_add(1);
+                        }
+                    }
+                }
+                stack.pushAll(batch.begin(), batch.end());
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    int value = 0;
+    while (stack.pop(value))
+    {
+        seen[value].fetch_add(1);
+    }
+    for (int i = 0; i < threadCount * perThread; ++i)
+    {
+        ASSERT_EQ(seen[i].load(), 1) << "element " << i;
+    }
+}
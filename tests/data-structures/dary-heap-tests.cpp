@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <dary-heap.hpp>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Every node comes after or with its parent in the order of the comparator
+template <int D, typename Heap, typename Compare = std::less<>>
+static bool isDaryHeap(const Heap& heap, Compare compare = Compare())
+{
+    const std::vector<typename Heap::value_type> data(heap.begin(), heap.end());
+    for (std::size_t i = 1; i < data.size(); ++i)
+    {
+        if (compare(data[i], data[(i - 1) / D]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Heap>
+class DaryHeapTests : public ::testing::Test
+{
+};
+
+using DaryHeapTypes = ::testing::Types<DaryHeap<int, 2>, DaryHeap<int, 4>, DaryHeap<int, 8>>;
+
+TYPED_TEST_SUITE(DaryHeapTests, DaryHeapTypes);
+
+template <typename Heap>
+struct Arity;
+template <typename T, int D, typename Compare, typename Allocator>
+struct Arity<DaryHeap<T, D, Compare, Allocator>>
+{
+    static constexpr int value = D;
+};
+
+// Test that pops come out sorted after random pushes
+TYPED_TEST(DaryHeapTests, PushPopSorts)
+{
+    constexpr int D = Arity<TypeParam>::value;
+    std::mt19937 rng(7);
+    std::vector<int> values(1000);
+    for (int& value : values)
+    {
+        value = static_cast<int>(rng() % 500);
+    }
+
+    TypeParam heap;
+    EXPECT_TRUE(heap.isEmpty());
+    for (int value : values)
+    {
+        heap.push(value);
+    }
+    EXPECT_EQ(heap.getSize(), 1000);
+    EXPECT_TRUE(isDaryHeap<D>(heap));
+
+    std::sort(values.begin(), values.end());
+    std::vector<int> popped;
+    while (!heap.isEmpty())
+    {
+        popped.push_back(heap.top());
+        heap.pop();
+        ASSERT_TRUE(isDaryHeap<D>(heap));
+    }
+    EXPECT_EQ(popped, values);
+}
+
+// Test the bottom-up construction from a range, including sizes around full levels
+TYPED_TEST(DaryHeapTests, HeapifyFromRange)
+{
+    constexpr int D = Arity<TypeParam>::value;
+    for (int size : {0, 1, 2, D, D + 1, D * D + D + 1, 1000})
+    {
+        std::vector<int> values(size);
+        for (int i = 0; i < size; ++i)
+        {
+            values[i] = (i * 7919) % 1009;
+        }
+        TypeParam heap(values.begin(), values.end());
+        EXPECT_EQ(heap.getSize(), size);
+        EXPECT_TRUE(isDaryHeap<D>(heap)) << "size " << size;
+        if (size > 0)
+        {
+            EXPECT_EQ(heap.top(), *std::min_element(values.begin(), values.end()));
+        }
+    }
+}
+
+// Test that pushPop returns the first of the element and the heap, and replaceTop always the top
+TYPED_TEST(DaryHeapTests, PushPopAndReplaceTop)
+{
+    constexpr int D = Arity<TypeParam>::value;
+    TypeParam heap;
+    EXPECT_EQ(heap.pushPop(5), 5);  // Empty: the element goes straight back
+    EXPECT_TRUE(heap.isEmpty());
+
+    const std::vector<int> values = {10, 20, 30, 40, 50};
+    for (int value : values)
+    {
+        heap.push(value);
+    }
+    EXPECT_EQ(heap.pushPop(5), 5);
+    EXPECT_EQ(heap.pushPop(10), 10);  // Equal to the top: still returned as is
+    EXPECT_EQ(heap.pushPop(35), 10);
+    EXPECT_EQ(heap.top(), 20);
+    EXPECT_TRUE(isDaryHeap<D>(heap));
+
+    EXPECT_EQ(heap.replaceTop(1), 20);
+    EXPECT_EQ(heap.top(), 1);
+    EXPECT_EQ(heap.replaceTop(60), 1);
+    EXPECT_EQ(heap.top(), 30);
+    EXPECT_EQ(heap.getSize(), 5);
+    EXPECT_TRUE(isDaryHeap<D>(heap));
+}
+
+// Test the errors on an empty heap
+TYPED_TEST(DaryHeapTests, EmptyHeapThrows)
+{
+    TypeParam heap;
+    EXPECT_THROW((void)heap.top(), std::out_of_range);
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+    EXPECT_THROW(heap.replaceTop(1), std::out_of_range);
+
+    heap.push(1);
+    heap.push(2);
+    heap.clear();
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+}
+
+// Test a custom comparator: with std::greater the largest element is on top
+TEST(DaryHeapTest, CustomComparatorMakesMaxHeap)
+{
+    const std::vector<std::string> words = {"pear", "apple", "fig", "banana", "cherry"};
+    DaryHeap<std::string, 4, std::greater<std::string>> heap(words.begin(), words.end());
+    EXPECT_TRUE(isDaryHeap<4>(heap, std::greater<std::string>()));
+
+    heap.emplace(3, 'z');
+    EXPECT_EQ(heap.top(), "zzz");
+    heap.pop();
+    EXPECT_EQ(heap.top(), "pear");
+}
+
+// Test that move-only elements are moved, never copied
+TEST(DaryHeapTest, MoveOnlyElements)
+{
+    auto byValue = [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; };
+    DaryHeap<std::unique_ptr<int>, 4, decltype(byValue)> heap(byValue);
+    for (int value : {4, 1, 3, 5, 2})
+    {
+        heap.emplace(std::make_unique<int>(value));
+    }
+    std::unique_ptr<int> out = heap.pushPop(std::make_unique<int>(0));
+    EXPECT_EQ(*out, 0);
+    out = heap.replaceTop(std::make_unique<int>(6));
+    EXPECT_EQ(*out, 1);
+
+    std::vector<int> popped;
+    while (!heap.isEmpty())
+    {
+        popped.push_back(*heap.top());
+        heap.pop();
+    }
+    EXPECT_EQ(popped, (std::vector<int>{2, 3, 4, 5, 6}));
+}
@@ -2,6 +2,11 @@
 #include <binary-search.hpp>
 #include <dynamic-array.hpp>
 #include <linear-search.hpp>
+#include <iterator>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
 // Test default constructor and initial size and capacity
 TEST(DynamicArrayTest, DefaultConstructor)
@@ -415,3 +420,389 @@ TEST(DynamicArrayTest, EraseLastElementInSingleElementArray)
     EXPECT_EQ(it, arr.end());
     EXPECT_EQ(arr.getSize(), 0);  // Array should be empty
 }
+
+// Helper type that counts how many instances are alive and how many copies were made
+struct TrackedItem
+{
+    static inline int alive = 0;
+    static inline int copies = 0;
+
+    int value{0};
+
+    TrackedItem(int _value) : value(_value)
+    {
+        alive++;
+    }
+    TrackedItem(const TrackedItem& other) : value(other.value)
+    {
+        alive++;
+        copies++;
+    }
+    TrackedItem(TrackedItem&& other) noexcept : value(other.value)
+    {
+        alive++;
+    }
+    TrackedItem& operator=(const TrackedItem& other)
+    {
+        value = other.value;
+        copies++;
+        return *this;
+    }
+    TrackedItem& operator=(TrackedItem&& other) noexcept
+    {
+        value = other.value;
+        return *this;
+    }
+    ~TrackedItem()
+    {
+        alive--;
+    }
+};
+
+// Test that capacity is raw storage: no element is constructed until it is appended
+TEST(DynamicArrayTest, CapacityDoesNotConstructElements)
+{
+    TrackedItem::alive = 0;
+    {
+        DynamicArray<TrackedItem> arr(100);
+        EXPECT_EQ(TrackedItem::alive, 0);  // Reserving capacity builds nothing
+
+        arr.append(TrackedItem(1));
+        arr.append(TrackedItem(2));
+        EXPECT_EQ(TrackedItem::alive, 2);
+
+        arr.erase(0);
+        EXPECT_EQ(TrackedItem::alive, 1);  // Erased element is destroyed
+    }
+    EXPECT_EQ(TrackedItem::alive, 0);  // Destructor only destroys constructed elements
+}
+
+// Test that growing the storage moves the elements instead of copying them
+TEST(DynamicArrayTest, ResizeMovesElements)
+{
+    TrackedItem::copies = 0;
+    DynamicArray<TrackedItem> arr(1);
+    for (int i = 0; i < 64; ++i)
+    {
+        arr.emplaceBack(i);
+    }
+
+    EXPECT_EQ(arr.getSize(), 64);
+    EXPECT_EQ(TrackedItem::copies, 0);  // Neither appending nor the 6 resizes copied anything
+    for (int i = 0; i < 64; ++i)
+    {
+        EXPECT_EQ(arr[i].value, i);
+    }
+}
+
+// Test appending by move and constructing in place
+TEST(DynamicArrayTest, AppendMoveAndEmplaceBack)
+{
+    DynamicArray<std::string> arr(1);
+
+    std::string text(100, 'a');
+    arr.append(std::move(text));
+    std::string& emplaced = arr.emplaceBack(3, 'b');
+
+    EXPECT_EQ(arr.getSize(), 2);
+    EXPECT_EQ(arr[0], std::string(100, 'a'));
+    EXPECT_EQ(emplaced, "bbb");
+    EXPECT_EQ(&emplaced, &arr[1]);
+}
+
+// Test appending an element of the array itself while the storage grows
+TEST(DynamicArrayTest, AppendOwnElementWhileResizing)
+{
+    DynamicArray<std::string> arr = {"first", "second"};
+    EXPECT_EQ(arr.getSize(), arr.getCapacity());
+
+    arr.append(arr[0]);  // Triggers resize, the reference must remain usable
+
+    EXPECT_EQ(arr.getSize(), 3);
+    EXPECT_EQ(arr[2], "first");
+}
+
+// Test insert and erase with a non trivially copyable type
+TEST(DynamicArrayTest, InsertEraseStrings)
+{
+    DynamicArray<std::string> arr = {"a", "c"};
+
+    arr.insert("b", 1);
+    arr.insert(arr[0], 0);  // Inserting an element of the array itself
+    arr.insert("d", 4);
+
+    DynamicArray<std::string> expected = {"a", "a", "b", "c", "d"};
+    EXPECT_EQ(arr, expected);
+
+    arr.erase(0);
+    arr.erase(3);
+    DynamicArray<std::string> expectedAfterErase = {"a", "b", "c"};
+    EXPECT_EQ(arr, expectedAfterErase);
+}
+
+// Test appending to arrays with no capacity
+TEST(DynamicArrayTest, AppendWithZeroCapacity)
+{
+    DynamicArray<int> empty(0);
+    EXPECT_EQ(empty.getCapacity(), 0);
+    empty.append(1);
+    EXPECT_EQ(empty.getSize(), 1);
+    EXPECT_EQ(empty[0], 1);
+
+    DynamicArray<int> source = {1, 2};
+    DynamicArray<int> movedTo = std::move(source);
+    source.append(3);  // Moved-from array is still usable
+    EXPECT_EQ(source.getSize(), 1);
+    EXPECT_EQ(source[0], 3);
+}
+
+// Test that the storage is drawn from the given memory resource
+TEST(DynamicArrayTest, PmrStorageComesFromArena)
+{
+    std::byte buffer[4096];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    PmrDynamicArray<int> arr(&arena);
+    for (int i = 0; i < 100; ++i)
+    {
+        arr.append(i);  // Several resizes, all served by the arena
+    }
+
+    EXPECT_EQ(arr.getSize(), 100);
+    EXPECT_EQ(arr[99], 99);
+    EXPECT_GE(reinterpret_cast<std::byte*>(arr.begin()), buffer);
+    EXPECT_LT(reinterpret_cast<std::byte*>(arr.begin()), buffer + sizeof(buffer));
+    EXPECT_EQ(arr.getAllocator().resource(), &arena);
+}
+
+// Test that moving between arrays with different memory resources keeps each array on its own resource
+TEST(DynamicArrayTest, PmrMoveAssignmentBetweenResources)
+{
+    std::pmr::monotonic_buffer_resource arena1;
+    std::pmr::monotonic_buffer_resource arena2;
+
+    PmrDynamicArray<std::pmr::string> arr1({"first", "second"}, &arena1);
+    PmrDynamicArray<std::pmr::string> arr2(&arena2);
+    arr2 = std::move(arr1);
+
+    EXPECT_EQ(arr2.getSize(), 2);
+    EXPECT_EQ(arr2[0], "first");
+    EXPECT_EQ(arr2[1], "second");
+    EXPECT_EQ(arr2.getAllocator().resource(), &arena2);
+    EXPECT_EQ(arr2[0].get_allocator().resource(), &arena2);  // Elements use the allocator of the array
+}
+
+// Test appending ranges from forward and single-pass iterators
+TEST(DynamicArrayTest, AppendRange)
+{
+    DynamicArray<int> arr(2);
+    const int values[] = {1, 2, 3, 4, 5, 6, 7};
+    arr.appendRange(std::begin(values), std::end(values));
+    EXPECT_EQ(arr.getSize(), 7);
+    EXPECT_EQ(arr.getCapacity(), 7);  // Grown once, straight to the required capacity
+
+    std::istringstream input("8 9");
+    arr.appendRange(std::istream_iterator<int>(input), std::istream_iterator<int>());
+
+    DynamicArray<int> expected = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(arr, expected);
+}
+
+// Test inserting ranges with and without reallocation
+TEST(DynamicArrayTest, InsertRange)
+{
+    DynamicArray<int> arr(10);
+    arr.append(1);
+    arr.append(5);
+    const int middle[] = {2, 3, 4};
+
+    int* inserted = arr.insertRange(std::begin(middle), std::end(middle), 1);
+    EXPECT_EQ(inserted, &arr[1]);
+    EXPECT_EQ(arr.getCapacity(), 10);
+
+    const int many[] = {6, 7, 8, 9, 10, 11};
+    arr.insertRange(std::begin(many), std::end(many), 5);  // Needs to grow
+
+    DynamicArray<int> expected = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    EXPECT_EQ(arr, expected);
+    EXPECT_THROW(arr.insertRange(std::begin(many), std::end(many), 12), std::out_of_range);
+}
+
+// Test inserting ranges of a non trivially copyable type, both shorter and longer than the shifted tail
+TEST(DynamicArrayTest, InsertRangeStrings)
+{
+    DynamicArray<std::string> arr(20);
+    for (const char* text : {"a", "e", "f", "g"})
+    {
+        arr.append(text);
+    }
+    const std::string shortRange[] = {"b"};
+    const std::string longRange[] = {"h", "i", "j", "k", "l"};
+    const std::string middle[] = {"c", "d"};
+
+    arr.insertRange(std::begin(shortRange), std::end(shortRange), 1);  // Tail longer than the range
+    arr.insertRange(std::begin(longRange), std::end(longRange), 3);    // Tail shorter than the range
+    arr.insertRange(std::begin(middle), std::end(middle), 2);
+
+    DynamicArray<std::string> expected = {"a", "b", "c", "d", "e", "h", "i", "j", "k", "l", "f", "g"};
+    EXPECT_EQ(arr, expected);
+}
+
+// Helper type whose copy throws once a number of copies were made, with a move that may throw so it is not used
+struct ThrowingItem
+{
+    static inline int alive = 0;
+    static inline int copiesLeft = -1;  // Negative for no limit
+
+    int value{0};
+
+    ThrowingItem(int _value) : value(_value)
+    {
+        alive++;
+    }
+    ThrowingItem(const ThrowingItem& other) : value(other.value)
+    {
+        if (copiesLeft == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+        copiesLeft--;
+        alive++;
+    }
+    ThrowingItem(ThrowingItem&& other) noexcept(false) : ThrowingItem(static_cast<const ThrowingItem&>(other))
+    {
+    }
+    ThrowingItem& operator=(const ThrowingItem&) = default;
+    ~ThrowingItem()
+    {
+        alive--;
+    }
+};
+
+// Test that a copy throwing while the storage grows leaves the array unchanged and leaks no element
+TEST(DynamicArrayTest, ThrowingCopyLeavesArrayUnchanged)
+{
+    {
+        DynamicArray<ThrowingItem> arr(4);
+        for (int i = 0; i < 4; ++i)
+        {
+            arr.emplaceBack(i);
+        }
+
+        ThrowingItem::copiesLeft = 2;
+        EXPECT_THROW(arr.emplaceBack(4), std::runtime_error);  // Throws while relocating the third element
+        ThrowingItem::copiesLeft = 5;
+        const ThrowingItem range[] = {10, 11};
+        EXPECT_THROW(arr.insertRange(std::begin(range), std::end(range), 1), std::runtime_error);  // In the tail
+        ThrowingItem::copiesLeft = 2;
+        EXPECT_THROW(DynamicArray<ThrowingItem>{arr}, std::runtime_error);
+        ThrowingItem::copiesLeft = -1;
+
+        EXPECT_EQ(arr.getSize(), 4);
+        EXPECT_EQ(arr.getCapacity(), 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(arr[i].value, i);
+        }
+        EXPECT_EQ(ThrowingItem::alive, 6);  // The array and the range
+    }
+    EXPECT_EQ(ThrowingItem::alive, 0);
+}
+
+// Test that a copy assignment whose element copy or allocation throws leaves the target unchanged
+TEST(DynamicArrayTest, ThrowingCopyAssignmentLeavesTargetUnchanged)
+{
+    {
+        DynamicArray<ThrowingItem> source(4);
+        for (int i = 0; i < 4; ++i)
+        {
+            source.emplaceBack(i);
+        }
+        DynamicArray<ThrowingItem> target(2);
+        target.emplaceBack(7);
+        target.emplaceBack(8);
+
+        ThrowingItem::copiesLeft = 2;
+        EXPECT_THROW(target = source, std::runtime_error);
+        ThrowingItem::copiesLeft = -1;
+
+        EXPECT_EQ(target.getSize(), 2);
+        EXPECT_EQ(target[0].value, 7);
+        EXPECT_EQ(target[1].value, 8);
+        EXPECT_EQ(ThrowingItem::alive, 6);
+    }
+    EXPECT_EQ(ThrowingItem::alive, 0);
+
+    std::byte buffer[256];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    PmrDynamicArray<int> target({7, 8}, &arena);
+    const PmrDynamicArray<int> source(100);
+    EXPECT_THROW(target = source, std::bad_alloc);
+    EXPECT_EQ(target.getSize(), 2);
+    EXPECT_EQ(target[1], 8);
+}
+
+// Test erasing ranges and that erased elements are destroyed
+TEST(DynamicArrayTest, EraseRange)
+{
+    DynamicArray<int> arr = {0, 1, 2, 3, 4, 5, 6};
+    arr.eraseRange(1, 4);
+    DynamicArray<int> expected = {0, 4, 5, 6};
+    EXPECT_EQ(arr, expected);
+    EXPECT_THROW(arr.eraseRange(2, 1), std::out_of_range);
+    EXPECT_THROW(arr.eraseRange(0, 5), std::out_of_range);
+
+    TrackedItem::alive = 0;
+    {
+        DynamicArray<TrackedItem> items(10);
+        for (int i = 0; i < 10; ++i)
+        {
+            items.emplaceBack(i);
+        }
+        items.eraseRange(2, 7);
+        EXPECT_EQ(TrackedItem::alive, 5);
+        EXPECT_EQ(items[2].value, 7);
+    }
+    EXPECT_EQ(TrackedItem::alive, 0);
+}
+
+// Test single-pass removal keeps the order of the remaining elements and calls the predicate once per element
+TEST(DynamicArrayTest, RemoveIf)
+{
+    DynamicArray<int> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    int calls = 0;
+    int removed = arr.removeIf(
+        [&calls](int value)
+        {
+            calls++;
+            return value % 3 == 0;
+        });
+
+    EXPECT_EQ(removed, 3);
+    EXPECT_EQ(calls, 10);
+    DynamicArray<int> expected = {1, 2, 4, 5, 7, 8, 10};
+    EXPECT_EQ(arr, expected);
+
+    DynamicArray<std::string> strings = {"keep", "drop", "drop", "keep too", "drop"};
+    strings.removeIf([](const std::string& value) { return value == "drop"; });
+    DynamicArray<std::string> expectedStrings = {"keep", "keep too"};
+    EXPECT_EQ(strings, expectedStrings);
+    EXPECT_EQ(strings.removeIf([](const std::string&) { return true; }), 2);
+    EXPECT_TRUE(strings.isEmpty());
+}
+
+// Test that the access policy can be chosen explicitly, whatever the default of the build is
+TEST(DynamicArrayTest, AccessPolicies)
+{
+    DynamicArray<int, std::allocator<int>, CheckedAccess> checked = {1, 2, 3};
+    EXPECT_THROW(checked[3], std::out_of_range);
+    EXPECT_THROW(checked[-1], std::out_of_range);
+
+    DynamicArray<int, std::allocator<int>, UncheckedAccess> unchecked = {1, 2, 3};
+    unchecked[1] = 20;
+    EXPECT_EQ(unchecked[1], 20);
+    EXPECT_EQ(unchecked.data(), unchecked.begin());
+    EXPECT_EQ(unchecked.data()[2], 3);
+}
@@ -219,6 +219,26 @@ TEST(BFSTests, DisconnectedGraph)
     ASSERT_EQ(visitOrder, expected);
 }
 
+TEST(BFSTests, VisitsEachVertexOnceInLevelOrder)
+{
+    // Vertex 3 is reached from 1 and from 2, and the cycle leads back to 0
+    AdjacencyList graph = createAdjacencyList(5);
+    addEdge(graph, 0, 1);
+    addEdge(graph, 0, 2);
+    addEdge(graph, 1, 3);
+    addEdge(graph, 2, 3);
+    addEdge(graph, 3, 4);
+    addEdge(graph, 4, 0);
+
+    std::vector<int> visitOrder;
+    BFS(graph, [&](int v) {
+        visitOrder.push_back(v);
+        return false;
+    });
+
+    ASSERT_EQ(visitOrder, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
 TEST(BFSTests, EmptyGraph)
 {
     AdjacencyList graph;
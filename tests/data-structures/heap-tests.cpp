@@ -2,7 +2,9 @@
 #include <algorithm>
 #include <chrono>
 #include <heap.hpp>
+#include <memory_resource>
 #include <random>
+#include <stdexcept>
 #include <vector>
 
 class HeapTests : public ::testing::Test
@@ -98,6 +100,22 @@ TEST_F(HeapTests, PopFromEmptyHeapDoesNotCrash)
     EXPECT_NO_THROW(heap.pop());
 }
 
+TEST_F(HeapTests, TopIsSmallestElement)
+{
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW((void)heap.top(), std::out_of_range);
+
+    for (int v : {10, 4, 5, 30, 3, 8})
+        heap.insert(v);
+
+    EXPECT_EQ(heap.getSize(), 6);
+    EXPECT_EQ(heap.top(), 3);
+    heap.pop();
+    EXPECT_EQ(heap.top(), 4);
+    EXPECT_EQ(heap.getSize(), 5);
+    EXPECT_FALSE(heap.isEmpty());
+}
+
 TEST_F(HeapTests, HeapPropertyMaintainedAfterRandomPops)
 {
     // Seed with current time
@@ -119,4 +137,20 @@ TEST_F(HeapTests, HeapPropertyMaintainedAfterRandomPops)
         heap.pop();
         EXPECT_TRUE(isMinHeap(heapData));
     }
-}
\ No newline at end of file
+}
+
+TEST(HeapPmrTests, StorageComesFromArena)
+{
+    std::byte buffer[4096];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    MinHeap<int, std::pmr::polymorphic_allocator<int>> heap(&arena);
+    for (int value : {20, 5, 15, 30, 1, 10})
+    {
+        heap.insert(value);
+    }
+    heap.pop();
+
+    EXPECT_EQ(heap.toVector().front(), 5);
+}
@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <indexed-heap.hpp>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Pop every id, returning the (key, id) pairs in the order they came out
+template <typename Heap>
+static std::vector<std::pair<int, int>> drain(Heap& heap)
+{
+    std::vector<std::pair<int, int>> result;
+    while (!heap.isEmpty())
+    {
+        result.emplace_back(heap.topKey(), heap.topId());
+        heap.pop();
+    }
+    return result;
+}
+
+TEST(IndexedHeapTest, StartsEmpty)
+{
+    IndexedHeap<int> heap(5);
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_EQ(heap.getSize(), 0);
+    EXPECT_EQ(heap.getIdCount(), 5);
+    for (int id = 0; id < 5; ++id)
+    {
+        EXPECT_FALSE(heap.contains(id));
+    }
+
+    IndexedHeap<int> none(0);
+    EXPECT_TRUE(none.isEmpty());
+    EXPECT_EQ(none.getIdCount(), 0);
+    EXPECT_FALSE(none.contains(0));
+}
+
+TEST(IndexedHeapTest, PopsInKeyOrder)
+{
+    IndexedHeap<int> heap(6);
+    heap.push(3, 30);
+    heap.push(0, 50);
+    heap.push(5, 10);
+    heap.push(1, 40);
+    heap.push(4, 20);
+
+    EXPECT_EQ(heap.getSize(), 5);
+    EXPECT_EQ(heap.topId(), 5);
+    EXPECT_EQ(heap.topKey(), 10);
+    EXPECT_TRUE(heap.contains(1));
+    EXPECT_FALSE(heap.contains(2));
+    EXPECT_EQ(heap.getKey(1), 40);
+
+    const std::vector<std::pair<int, int>> expected = {{10, 5}, {20, 4}, {30, 3}, {40, 1}, {50, 0}};
+    EXPECT_EQ(drain(heap), expected);
+    EXPECT_FALSE(heap.contains(5));
+}
+
+TEST(IndexedHeapTest, DecreaseKeyMovesIdUp)
+{
+    IndexedHeap<int> heap(4);
+    heap.push(0, 10);
+    heap.push(1, 20);
+    heap.push(2, 30);
+    heap.push(3, 40);
+
+    heap.decreaseKey(3, 5);
+    EXPECT_EQ(heap.topId(), 3);
+    EXPECT_EQ(heap.getKey(3), 5);
+
+    heap.decreaseKey(2, 30);  // An equal key is allowed
+    EXPECT_EQ(heap.getKey(2), 30);
+
+    const std::vector<std::pair<int, int>> expected = {{5, 3}, {10, 0}, {20, 1}, {30, 2}};
+    EXPECT_EQ(drain(heap), expected);
+}
+
+TEST(IndexedHeapTest, PushOrDecreaseKey)
+{
+    IndexedHeap<int> heap(3);
+    EXPECT_TRUE(heap.pushOrDecreaseKey(1, 20));
+    EXPECT_TRUE(heap.pushOrDecreaseKey(2, 10));
+    EXPECT_FALSE(heap.pushOrDecreaseKey(1, 25));
+    EXPECT_FALSE(heap.pushOrDecreaseKey(1, 20));
+    EXPECT_EQ(heap.getKey(1), 20);
+    EXPECT_TRUE(heap.pushOrDecreaseKey(1, 5));
+    EXPECT_EQ(heap.topId(), 1);
+    EXPECT_EQ(heap.getSize(), 2);
+}
+
+TEST(IndexedHeapTest, EraseFromAnywhere)
+{
+    IndexedHeap<int, 2> heap(10);
+    for (int id = 0; id < 10; ++id)
+    {
+        heap.push(id, id * 10);
+    }
+
+    heap.erase(0);  // The top
+    heap.erase(9);  // The last entry
+    heap.erase(4);  // The middle
+    EXPECT_EQ(heap.getSize(), 7);
+    EXPECT_FALSE(heap.contains(4));
+
+    heap.push(4, 1);  // An erased id can come back
+    const std::vector<std::pair<int, int>> expected = {{1, 4},  {10, 1}, {20, 2}, {30, 3},
+                                                       {50, 5}, {60, 6}, {70, 7}, {80, 8}};
+    EXPECT_EQ(drain(heap), expected);
+}
+
+TEST(IndexedHeapTest, CustomComparator)
+{
+    IndexedHeap<int, 4, std::greater<int>> heap(4);
+    heap.push(0, 1);
+    heap.push(1, 3);
+    heap.push(2, 2);
+    EXPECT_EQ(heap.topId(), 1);
+
+    heap.decreaseKey(0, 7);  // "Decrease" in the order of the comparator
+    EXPECT_EQ(heap.topId(), 0);
+    EXPECT_THROW(heap.decreaseKey(2, 1), std::invalid_argument);
+}
+
+TEST(IndexedHeapTest, ThrowsOnInvalidUse)
+{
+    EXPECT_THROW(IndexedHeap<int>(-1), std::invalid_argument);
+
+    IndexedHeap<int> heap(3);
+    EXPECT_THROW((void)heap.topId(), std::out_of_range);
+    EXPECT_THROW((void)heap.topKey(), std::out_of_range);
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+    EXPECT_THROW(heap.push(3, 1), std::out_of_range);
+    EXPECT_THROW(heap.push(-1, 1), std::out_of_range);
+    EXPECT_THROW(heap.pushOrDecreaseKey(3, 1), std::out_of_range);
+    EXPECT_THROW((void)heap.getKey(0), std::out_of_range);
+    EXPECT_THROW(heap.decreaseKey(0, 1), std::out_of_range);
+    EXPECT_THROW(heap.erase(0), std::out_of_range);
+
+    heap.push(0, 10);
+    EXPECT_THROW(heap.push(0, 5), std::invalid_argument);
+    EXPECT_THROW(heap.decreaseKey(0, 11), std::invalid_argument);
+    EXPECT_EQ(heap.getKey(0), 10);
+}
+
+// Random pushes, decreases, erases and pops against a brute-force model
+template <int D>
+static void checkAgainstModel(unsigned seed)
+{
+    const int idCount = 200;
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> anyId(0, idCount - 1);
+    std::uniform_int_distribution<int> anyKey(0, 1000);
+    std::uniform_int_distribution<int> anyOperation(0, 3);
+
+    IndexedHeap<int, D> heap(idCount);
+    std::vector<int> model(idCount, -1);  // The key of every id, -1 if absent
+    for (int step = 0; step < 5000; ++step)
+    {
+        const int id = anyId(generator);
+        switch (anyOperation(generator))
+        {
+        case 0:
+            if (model[id] < 0)
+            {
+                model[id] = anyKey(generator);
+                heap.push(id, model[id]);
+            }
+            break;
+        case 1:
+            if (model[id] > 0)
+            {
+                model[id] = std::uniform_int_distribution<int>(0, model[id])(generator);
+                heap.decreaseKey(id, model[id]);
+            }
+            break;
+        case 2:
+            if (model[id] >= 0)
+            {
+                model[id] = -1;
+                heap.erase(id);
+            }
+            break;
+        default:
+            if (!heap.isEmpty())
+            {
+                ASSERT_EQ(heap.topKey(), model[heap.topId()]);
+                int smallest = -1;
+                for (int key : model)
+                {
+                    smallest = key >= 0 && (smallest < 0 || key < smallest) ? key : smallest;
+                }
+                ASSERT_EQ(heap.topKey(), smallest);
+                model[heap.topId()] = -1;
+                heap.pop();
+            }
+            break;
+        }
+        ASSERT_EQ(heap.getSize(), static_cast<int>(std::count_if(model.begin(), model.end(), [](int key) {
+                                      return key >= 0;
+                                  })));
+    }
+}
+
+TEST(IndexedHeapTest, MatchesModelUnderRandomOperations)
+{
+    for (unsigned seed = 0; seed < 5; ++seed)
+    {
+        checkAgainstModel<2>(seed);
+        checkAgainstModel<4>(seed);
+        checkAgainstModel<8>(seed);
+    }
+}
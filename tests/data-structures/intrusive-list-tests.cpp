@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+#include <intrusive-list.hpp>
+#include <string>
+#include <vector>
+
+struct ByPriority;
+
+struct Task : IntrusiveListHook<>, IntrusiveListHook<ByPriority>
+{
+    explicit Task(int _id) : id(_id)
+    {
+    }
+
+    int id;
+    std::string name{"task"};
+};
+
+using TaskList = IntrusiveList<Task>;
+using PriorityList = IntrusiveList<Task, ByPriority>;
+
+template <typename ListType>
+void expectIds(const ListType& list, std::initializer_list<int> expected)
+{
+    ASSERT_EQ(list.getSize(), static_cast<int>(expected.size()));
+    auto it = list.begin();
+    for (int id : expected)
+    {
+        ASSERT_NE(it, list.end());
+        EXPECT_EQ(it->id, id);
+        ++it;
+    }
+    EXPECT_EQ(it, list.end());
+}
+
+TEST(IntrusiveListTest, DefaultConstructor)
+{
+    TaskList list;
+    EXPECT_EQ(list.getSize(), 0);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(IntrusiveListTest, AppendLinksTheObjectsThemselves)
+{
+    std::vector<Task> tasks = {Task(1), Task(2), Task(3)};
+    TaskList list;
+    for (Task& task : tasks)
+    {
+        list.append(task);
+    }
+
+    expectIds(list, {1, 2, 3});
+    EXPECT_EQ(&list[1], &tasks[1]);
+    EXPECT_TRUE(static_cast<IntrusiveListHook<>&>(tasks[0]).isLinked());
+
+    list[2].name = "renamed";
+    EXPECT_EQ(tasks[2].name, "renamed");
+}
+
+TEST(IntrusiveListTest, IteratorsGoBothWays)
+{
+    Task a(1), b(2), c(3);
+    TaskList list;
+    list.append(a);
+    list.append(b);
+    list.append(c);
+
+    auto it = list.end();
+    --it;
+    EXPECT_EQ(it->id, 3);
+    it--;
+    EXPECT_EQ((*it).id, 2);
+    --it;
+    EXPECT_EQ(it, list.begin());
+
+    TaskList::const_iterator constIt = list.begin();
+    EXPECT_EQ(constIt->id, 1);
+}
+
+TEST(IntrusiveListTest, InsertAtIterator)
+{
+    Task a(1), b(2), c(3);
+    TaskList list;
+    list.append(a);
+    list.append(c);
+
+    auto inserted = list.insert(TaskList::iteratorTo(c), b);
+
+    EXPECT_EQ(&*inserted, &b);
+    expectIds(list, {1, 2, 3});
+}
+
+TEST(IntrusiveListTest, InsertLinkedObjectThrows)
+{
+    Task a(1);
+    TaskList list, other;
+    list.append(a);
+
+    EXPECT_THROW(list.append(a), std::invalid_argument);
+    EXPECT_THROW(other.append(a), std::invalid_argument);
+    expectIds(list, {1});
+    EXPECT_TRUE(other.isEmpty());
+}
+
+TEST(IntrusiveListTest, EraseUnlinksWithoutDestroying)
+{
+    Task a(1), b(2), c(3);
+    TaskList list;
+    list.append(a);
+    list.append(b);
+    list.append(c);
+
+    auto next = list.erase(TaskList::iteratorTo(b));
+    EXPECT_EQ(&*next, &c);
+    list.erase(c);
+
+    expectIds(list, {1});
+    EXPECT_FALSE(static_cast<IntrusiveListHook<>&>(b).isLinked());
+    EXPECT_EQ(b.name, "task");
+    EXPECT_THROW(list.erase(b), std::invalid_argument);
+    EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+
+    list.append(b);  // An erased object can be linked again
+    expectIds(list, {1, 2});
+}
+
+TEST(IntrusiveListTest, ObjectInTwoListsThroughTwoHooks)
+{
+    Task a(1), b(2), c(3);
+    TaskList byArrival;
+    PriorityList byPriority;
+    byArrival.append(a);
+    byArrival.append(b);
+    byArrival.append(c);
+    byPriority.append(c);
+    byPriority.append(a);
+
+    byArrival.erase(a);
+
+    expectIds(byArrival, {2, 3});
+    expectIds(byPriority, {3, 1});
+}
+
+TEST(IntrusiveListTest, SpliceOtherList)
+{
+    Task a(1), b(2), c(3), d(4);
+    TaskList list, other;
+    list.append(a);
+    list.append(d);
+    other.append(b);
+    other.append(c);
+
+    list.splice(TaskList::iteratorTo(d), other);
+
+    expectIds(list, {1, 2, 3, 4});
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(other.begin(), other.end());
+}
+
+TEST(IntrusiveListTest, SpliceRangeWithinList)
+{
+    Task a(1), b(2), c(3), d(4);
+    TaskList list;
+    list.append(a);
+    list.append(b);
+    list.append(c);
+    list.append(d);
+
+    list.splice(list.begin(), TaskList::iteratorTo(c), list.end());
+
+    expectIds(list, {3, 4, 1, 2});
+}
+
+TEST(IntrusiveListTest, MoveKeepsTheLinks)
+{
+    Task a(1), b(2);
+    TaskList list;
+    list.append(a);
+    list.append(b);
+
+    TaskList moved(std::move(list));
+    expectIds(moved, {1, 2});
+    EXPECT_TRUE(list.isEmpty());
+
+    TaskList assigned;
+    Task c(3);
+    assigned.append(c);
+    assigned = std::move(moved);
+    expectIds(assigned, {1, 2});
+    EXPECT_FALSE(static_cast<IntrusiveListHook<>&>(c).isLinked());
+}
+
+TEST(IntrusiveListTest, DestructorUnlinksObjects)
+{
+    Task a(1);
+    {
+        TaskList list;
+        list.append(a);
+    }
+    EXPECT_FALSE(static_cast<IntrusiveListHook<>&>(a).isLinked());
+
+    Task copy = a;
+    TaskList list;
+    list.append(a);
+    EXPECT_FALSE(static_cast<IntrusiveListHook<>&>(copy).isLinked());  // Copies are in no list
+}
+
+TEST(IntrusiveListTest, CheckedIndexAccess)
+{
+    Task a(1);
+    IntrusiveList<Task, void, CheckedAccess> list;
+    list.append(a);
+
+    EXPECT_EQ(list[0].id, 1);
+    EXPECT_THROW(list[1], std::out_of_range);
+    list.clear();
+}
+
+TEST(IntrusiveListTest, CheckedEraseOfAnotherListsObject)
+{
+    Task a(1), b(2), c(3);
+    IntrusiveList<Task, void, CheckedAccess> first;
+    IntrusiveList<Task, void, CheckedAccess> second;
+    first.append(a);
+    first.append(b);
+    second.append(c);
+
+    EXPECT_THROW(first.erase(c), std::invalid_argument);
+    expectIds(first, {1, 2});
+    expectIds(second, {3});
+
+    first.erase(b);
+    expectIds(first, {1});
+    first.clear();
+    second.clear();
+}
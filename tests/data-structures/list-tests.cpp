@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <list.hpp>
+#include <memory_resource>
 
 // Test default constructor and initial size
 TEST(ListTest, DefaultConstructor)
@@ -443,3 +444,286 @@ TEST(ListTest, InsertAtBeginning)
     EXPECT_EQ(list[0], 0);
     EXPECT_EQ(*it, 0);
 }
+
+TEST(ListTest, PmrNodesComeFromArena)
+{
+    std::byte buffer[8192];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    PmrList<int> list(&arena);
+    for (int i = 0; i < 100; ++i)
+    {
+        list.append(i);
+    }
+    list.insert(-1, 0);
+
+    EXPECT_EQ(list.getSize(), 101);
+    EXPECT_EQ(list[0], -1);
+    EXPECT_EQ(list[100], 99);
+    EXPECT_EQ(list.getAllocator().resource(), &arena);
+}
+
+TEST(ListTest, ClearReleasesNodes)
+{
+    List<std::string> list = {"apple", "banana", "cherry"};
+    list.clear();
+
+    EXPECT_TRUE(list.isEmpty());
+    list.append("date");
+    EXPECT_EQ(list.getSize(), 1);
+    EXPECT_EQ(list[0], "date");
+}
+
+// Test that the access policy can be chosen explicitly, whatever the default of the build is
+TEST(ListTest, AccessPolicies)
+{
+    List<int, std::allocator<int>, CheckedAccess> checked = {1, 2, 3};
+    EXPECT_THROW(checked[3], std::out_of_range);
+
+    List<int, std::allocator<int>, UncheckedAccess> unchecked = {1, 2, 3};
+    EXPECT_EQ(unchecked[2], 3);
+}
+
+// Test that erased nodes are reused: with a fixed buffer any allocation beyond the warm up would throw
+TEST(ListTest, EraseReusesNodes)
+{
+    std::byte buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    PmrList<int> list(&arena);
+    for (int i = 0; i < 50; ++i)
+    {
+        list.append(i);
+    }
+    for (int i = 50; i < 100'000; ++i)
+    {
+        list.erase(0);
+        list.append(i);
+    }
+    list.insert(-1, 25);
+    list.erase(25);
+    list.clear();
+    for (int i = 0; i < 50; ++i)
+    {
+        list.append(i);
+    }
+
+    EXPECT_EQ(list.getSize(), 50);
+    EXPECT_EQ(list[49], 49);
+}
+
+// Test that inserting in the middle links the following node back to the new node
+TEST(ListTest, InsertInMiddleKeepsBackwardLinks)
+{
+    List<int> list = {1, 2, 4};
+    list.insert(3, 2);
+    list.erase(3);  // Erasing the tail moves it to its previous node
+
+    List<int> expected = {1, 2, 3};
+    EXPECT_EQ(list, expected);
+    EXPECT_EQ(*(list.end() - 1), 3);
+}
+
+// Test that a moved-to list keeps working with the nodes of the moved-from list and vice versa
+TEST(ListTest, MoveAssignmentExchangesPools)
+{
+    List<std::string> source = {"a", "b", "c"};
+    List<std::string> target = {"x", "y"};
+    target.erase(0);
+
+    target = std::move(source);
+    target.append("d");
+    source.append("e");
+
+    List<std::string> expected = {"a", "b", "c", "d"};
+    EXPECT_EQ(target, expected);
+    EXPECT_EQ(source.getSize(), 1);
+    EXPECT_EQ(source[0], "e");
+}
+
+TEST(ListTest, InsertAtIterator)
+{
+    List<int> list = {1, 3};
+    auto it = list.insert(list.begin() + 1, 2);
+    EXPECT_EQ(*it, 2);
+    list.insert(list.begin(), 0);
+    list.insert(list.end(), 4);
+
+    List<int> expected = {0, 1, 2, 3, 4};
+    EXPECT_EQ(list, expected);
+    EXPECT_EQ(*(list.end() - 1), 4);
+
+    List<int> empty;
+    empty.insert(empty.end(), 7);
+    EXPECT_EQ(empty.getSize(), 1);
+    EXPECT_EQ(empty[0], 7);
+}
+
+TEST(ListTest, EraseAtIterator)
+{
+    List<int> list = {0, 1, 2, 3, 4};
+
+    auto it = list.erase(list.begin() + 2);
+    EXPECT_EQ(*it, 3);
+    it = list.erase(list.begin());
+    EXPECT_EQ(*it, 1);
+    it = list.erase(list.end() - 1);
+    EXPECT_EQ(it, list.end());
+
+    List<int> expected = {1, 3};
+    EXPECT_EQ(list, expected);
+    EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+
+    list.erase(list.begin());
+    list.erase(list.begin());
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(ListTest, SpliceOtherList)
+{
+    List<std::string> list = {"a", "d"};
+    {
+        List<std::string> other = {"b", "c"};
+        list.splice(list.begin() + 1, other);
+        EXPECT_TRUE(other.isEmpty());
+
+        other.append("reused");  // The moved-from list keeps working with a fresh pool
+        EXPECT_EQ(other[0], "reused");
+    }
+    // The spliced nodes outlive the list they came from
+    List<std::string> back = {"e"};
+    list.splice(list.end(), back);
+
+    List<std::string> expected = {"a", "b", "c", "d", "e"};
+    EXPECT_EQ(list, expected);
+    EXPECT_EQ(*(list.end() - 1), "e");
+    EXPECT_EQ(*(list.end() - 5), "a");
+}
+
+TEST(ListTest, SpliceRangeWithinList)
+{
+    List<int> list = {0, 1, 2, 3, 4, 5};
+
+    list.splice(list.begin(), list.begin() + 3, list.begin() + 5);  // Move 3, 4 to the front
+    List<int> expected = {3, 4, 0, 1, 2, 5};
+    EXPECT_EQ(list, expected);
+
+    list.splice(list.end(), list.begin(), list.begin() + 2);  // And back to the end
+    expected = {0, 1, 2, 5, 3, 4};
+    EXPECT_EQ(list, expected);
+    EXPECT_EQ(*(list.end() - 1), 4);
+    EXPECT_EQ(list.getSize(), 6);
+}
+
+TEST(ListTest, MergeSortedLists)
+{
+    List<std::pair<int, char>> list = {{1, 'a'}, {3, 'a'}, {5, 'a'}};
+    List<std::pair<int, char>> other = {{0, 'b'}, {3, 'b'}, {4, 'b'}, {6, 'b'}, {7, 'b'}};
+    auto byKey = [](const auto& left, const auto& right) { return left.first < right.first; };
+
+    list.merge(other, byKey);
+
+    List<std::pair<int, char>> expected = {{0, 'b'}, {1, 'a'}, {3, 'a'}, {3, 'b'}, {4, 'b'},
+                                           {5, 'a'}, {6, 'b'}, {7, 'b'}};
+    EXPECT_EQ(list, expected);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ((*(list.end() - 1)).first, 7);
+}
+
+// Test that lists on different memory resources copy the elements instead of relinking them
+TEST(ListTest, SpliceAndMergeAcrossResources)
+{
+    std::pmr::monotonic_buffer_resource first;
+    std::pmr::monotonic_buffer_resource second;
+
+    PmrList<int> list({1, 4}, &first);
+    PmrList<int> other({2, 3}, &second);
+    list.merge(other);
+    EXPECT_TRUE(other.isEmpty());
+
+    PmrList<int> tail({5}, &second);
+    list.splice(list.end(), tail);
+
+    PmrList<int> expected = {1, 2, 3, 4, 5};
+    EXPECT_EQ(list, expected);
+}
+
+TEST(ListTest, MergeGreaterElementsAcrossResources)
+{
+    // Every element of other goes after the last one of this list
+    std::pmr::monotonic_buffer_resource first;
+    std::pmr::monotonic_buffer_resource second;
+
+    PmrList<int> list({1}, &first);
+    PmrList<int> other({2, 3}, &second);
+    list.merge(other);
+    EXPECT_TRUE(other.isEmpty());
+
+    PmrList<int> expected = {1, 2, 3};
+    EXPECT_EQ(list, expected);
+}
+
+TEST(ListTest, SortRelinksNodes)
+{
+    List<int> list = {5, 1, 4, 1, 3, 9, 2, 6, 5, 3};
+    auto nine = list.begin() + 5;
+
+    list.sort();
+
+    List<int> expected = {1, 1, 2, 3, 3, 4, 5, 5, 6, 9};
+    EXPECT_EQ(list, expected);
+    EXPECT_EQ(*nine, 9);  // The iterator followed its node to the back
+    EXPECT_EQ(nine, list.end() - 1);
+    EXPECT_EQ(*(list.end() - 10), 1);
+
+    list.sort(std::greater<>());
+    expected = {9, 6, 5, 5, 4, 3, 3, 2, 1, 1};
+    EXPECT_EQ(list, expected);
+}
+
+TEST(ListTest, SortIsStable)
+{
+    List<std::pair<int, int>> list;
+    for (int i = 0; i < 100; ++i)
+    {
+        list.append({(i * 37) % 7, i});
+    }
+    auto byKey = [](const auto& left, const auto& right) { return left.first < right.first; };
+
+    list.sort(byKey);
+
+    auto previous = list.begin();
+    for (auto it = std::next(list.begin()); it != list.end(); ++it, ++previous)
+    {
+        ASSERT_LE(previous->first, it->first);
+        if (previous->first == it->first)
+        {
+            EXPECT_LT(previous->second, it->second);
+        }
+    }
+    EXPECT_EQ(list.getSize(), 100);
+}
+
+TEST(ListTest, SortEdgeCases)
+{
+    List<int> empty;
+    empty.sort();
+    EXPECT_TRUE(empty.isEmpty());
+
+    List<int> single = {7};
+    single.sort();
+    EXPECT_EQ(single[0], 7);
+
+    List<int> sorted = {1, 2, 3, 4};
+    sorted.sort();
+    EXPECT_EQ(sorted, List<int>({1, 2, 3, 4}));
+
+    List<int> reversed = {4, 3, 2, 1, 0};
+    reversed.sort();
+    EXPECT_EQ(reversed, List<int>({0, 1, 2, 3, 4}));
+    reversed.append(5);  // The tail is still right
+    EXPECT_EQ(*(reversed.end() - 1), 5);
+    EXPECT_EQ(*(reversed.end() - 6), 0);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <delete-duplicates.hpp>
+#include <insert-sort.hpp>
+#include <mapped-dynamic-array.hpp>
+#include <stack.hpp>
+#include <string>
+
+// Test default constructor: empty and nothing mapped until the first append
+TEST(MappedDynamicArrayTest, DefaultConstructor)
+{
+    MappedDynamicArray<int> arr;
+    EXPECT_EQ(arr.getSize(), 0);
+    EXPECT_EQ(arr.getCapacity(), 0);
+    EXPECT_EQ(arr.getMaxCapacity(), MappedDynamicArray<int>::getDefaultMaxCapacity());
+    EXPECT_EQ(arr.data(), nullptr);
+    EXPECT_TRUE(arr.isEmpty());
+}
+
+// Test that growing commits whole pages and never moves the elements
+TEST(MappedDynamicArrayTest, GrowthNeverMovesElements)
+{
+    MappedDynamicArray<int> arr;
+    arr.append(0);
+    const int* first = &arr[0];
+    EXPECT_EQ(arr.getCapacity(), static_cast<int>(MappedDynamicArray<int>::getPageSize() / sizeof(int)));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % MappedDynamicArray<int>::getPageSize(), 0);
+
+    const int count = 3 * arr.getCapacity() + 1;  // Several commits
+    for (int i = 1; i < count; ++i)
+    {
+        arr.append(i);
+    }
+
+    EXPECT_EQ(arr.getSize(), count);
+    EXPECT_GE(arr.getCapacity(), count);
+    EXPECT_EQ(&arr[0], first);
+    for (int i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(arr[i], i);
+    }
+}
+
+// Test that the array cannot grow past its maximum capacity
+TEST(MappedDynamicArrayTest, MaxCapacity)
+{
+    const int maxCapacity = 1000;
+    MappedDynamicArray<int> arr(maxCapacity);
+    for (int i = 0; i < maxCapacity; ++i)
+    {
+        arr.append(i);
+    }
+
+    EXPECT_EQ(arr.getCapacity(), maxCapacity);
+    EXPECT_THROW(arr.append(maxCapacity), std::bad_alloc);
+    EXPECT_EQ(arr.getSize(), maxCapacity);
+
+    MappedDynamicArray<int> none(0);
+    EXPECT_THROW(none.append(1), std::bad_alloc);
+}
+
+// Test insert, erase and appending an element of the array itself with a non trivially copyable type
+TEST(MappedDynamicArrayTest, InsertEraseStrings)
+{
+    MappedDynamicArray<std::string> arr = {"a", "c"};
+
+    arr.insert("b", 1);
+    arr.insert(arr[0], 0);
+    arr.append(arr[3]);
+
+    MappedDynamicArray<std::string> expected = {"a", "a", "b", "c", "c"};
+    EXPECT_EQ(arr, expected);
+
+    arr.erase(0);
+    arr.erase(3);
+    MappedDynamicArray<std::string> expectedAfterErase = {"a", "b", "c"};
+    EXPECT_EQ(arr, expectedAfterErase);
+
+    EXPECT_THROW(arr.insert("x", 4), std::out_of_range);
+    EXPECT_THROW(arr.erase(3), std::out_of_range);
+    EXPECT_THROW(arr[3], std::out_of_range);
+}
+
+// Test copy and move: copies own their mapping, moves hand it over
+TEST(MappedDynamicArrayTest, CopyAndMove)
+{
+    MappedDynamicArray<std::string> arr = {"x", "y", "z"};
+
+    MappedDynamicArray<std::string> copy = arr;
+    EXPECT_EQ(copy, arr);
+    EXPECT_NE(copy.data(), arr.data());
+
+    const std::string* storage = arr.data();
+    MappedDynamicArray<std::string> moved = std::move(arr);
+    EXPECT_EQ(moved.data(), storage);
+    EXPECT_EQ(moved, copy);
+    EXPECT_TRUE(arr.isEmpty());
+
+    arr.append("again");  // Moved-from array is still usable
+    EXPECT_EQ(arr[0], "again");
+
+    copy = moved;
+    moved = std::move(arr);
+    EXPECT_EQ(moved.getSize(), 1);
+    EXPECT_EQ(copy.getSize(), 3);
+}
+
+// Test that the array satisfies the container concepts and drops into the existing templates
+TEST(MappedDynamicArrayTest, WorksWithStackAndAlgorithms)
+{
+    static_assert(HasAppend<MappedDynamicArray<int>>);
+    static_assert(HasGetSize<MappedDynamicArray<int>>);
+    static_assert(HasCustomBeginEnd<MappedDynamicArray<int>>);
+
+    Stack<int, MappedDynamicArray<int>> stack;
+    for (int i = 0; i < 10; ++i)
+    {
+        stack.push(i);
+    }
+    EXPECT_EQ(stack.top(), 9);
+
+    MappedDynamicArray<int> arr = {5, 3, 5, 1, 3};
+    deleteDuplicates(arr);
+    insertSort(arr.begin(), arr.end());
+
+    MappedDynamicArray<int> expected = {1, 3, 5};
+    EXPECT_EQ(arr, expected);
+}
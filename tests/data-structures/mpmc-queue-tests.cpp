@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <mpmc-queue.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// An element whose copy throws on demand
+struct ThrowingCopy
+{
+    static inline bool shouldThrow = false;
+
+    int value{0};
+
+    ThrowingCopy() = default;
+    explicit ThrowingCopy(int value) : value(value)
+    {
+    }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (shouldThrow)
+        {
+            throw std::runtime_error("copy");
+        }
+    }
+    ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+
+// Test the state of a new queue and the rounding of its capacity
+TEST(MpmcQueueTest, InitialState)
+{
+    MpmcQueue<int> queue(3);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.getSize(), 0);
+    EXPECT_EQ(queue.getCapacity(), 4);
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(value));
+    EXPECT_THROW(MpmcQueue<int>(-1), std::invalid_argument);
+}
+
+// Test that a capacity of 1 gets two slots, so a published element is never taken for a free slot
+TEST(MpmcQueueTest, CapacityOneIsRoundedUpToTwo)
+{
+    MpmcQueue<std::string> queue(1);
+    EXPECT_EQ(queue.getCapacity(), 2);
+    EXPECT_TRUE(queue.tryPush("one"));
+    EXPECT_TRUE(queue.tryPush("two"));
+    EXPECT_FALSE(queue.tryPush("three"));
+    EXPECT_EQ(queue.getSize(), 2);
+
+    std::string value;
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, "one");
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, "two");
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+// Test FIFO order, the full queue and many laps of the ring
+TEST(MpmcQueueTest, PushPopSingleThread)
+{
+    MpmcQueue<int> queue(4);
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.tryPush(round * 4 + i));
+        }
+        EXPECT_FALSE(queue.tryPush(-1));
+        EXPECT_EQ(queue.getSize(), 4);
+
+        int value = -1;
+        queue.pop(value);
+        EXPECT_EQ(value, round * 4);
+        for (int i = 1; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.tryPop(value));
+            EXPECT_EQ(value, round * 4 + i);
+        }
+        EXPECT_FALSE(queue.tryPop(value));
+    }
+}
+
+// Test that a push whose copy throws leaves a hole the consumers skip
+TEST(MpmcQueueTest, ThrowingPushIsSkipped)
+{
+    MpmcQueue<ThrowingCopy> queue(4);
+    const ThrowingCopy first(1);
+    const ThrowingCopy second(2);
+    queue.push(first);
+    ThrowingCopy::shouldThrow = true;
+    EXPECT_THROW(queue.push(second), std::runtime_error);
+    ThrowingCopy::shouldThrow = false;
+    queue.push(second);
+
+    ThrowingCopy value;
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value.value, 1);
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value.value, 2);
+    EXPECT_FALSE(queue.tryPop(value));
+
+    for (int i = 0; i < 4; ++i)  // The slot of the hole is usable again on the next lap
+    {
+        EXPECT_TRUE(queue.tryPush(ThrowingCopy(i)));
+    }
+}
+
+// Test that the elements left in the queue are destroyed with it
+TEST(MpmcQueueTest, DestroysRemainingElements)
+{
+    const auto shared = std::make_shared<int>(1);
+    {
+        MpmcQueue<std::shared_ptr<int>> queue(4);
+        queue.push(shared);
+        queue.tryEmplace(shared);
+        queue.tryEmplace(shared);
+        std::shared_ptr<int> out;
+        EXPECT_TRUE(queue.tryPop(out));
+        EXPECT_EQ(shared.use_count(), 4);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+// Test that every element pushed by several producers is popped exactly once by several consumers, and that the
+// elements of one producer come out of the queue in order
+TEST(MpmcQueueTest, ProducersConsumersExactlyOnce)
+{
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int perProducer = 50'000;
+    MpmcQueue<std::string> queue(128);
+
+    std::vector<std::atomic<int>> seen(producers * perProducer);
+    std::atomic<int> remaining = producers * perProducer;
+    std::atomic<bool> ordered = true;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back(
+            [&, p]
+            {
+                for (int i = 0; i < perProducer; ++i)
+                {
+                    queue.push(std::to_string(p * perProducer + i));
+                }
+            });
+    }
+    for (int c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                std::vector<int> last(producers, -1);
+                std::string value;
+                while (remaining.load() > 0)
+                {
+                    if (!queue.tryPop(value))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    const int id = std::stoi(value);
+                    seen[id].fetch_add(1);
+                    if (id % perProducer <= last[id / perProducer])
+                    {
+                        ordered = false;  // One consumer sees the elements of one producer in order
+                    }
+                    last[id / perProducer] = id % perProducer;
+                    remaining.fetch_sub(1);
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < producers * perProducer; ++i)
+    {
+        ASSERT_EQ(seen[i].load(), 1) << "element " << i;
+    }
+    EXPECT_TRUE(ordered.load());
+    EXPECT_TRUE(queue.isEmpty());
+}
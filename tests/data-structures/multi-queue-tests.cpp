@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <multi-queue.hpp>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test the state of a new queue and the number of heaps
+TEST(MultiQueueTest, InitialState)
+{
+    MultiQueue<int> queue(4);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.getSize(), 0);
+    EXPECT_EQ(queue.getQueueCount(), 8);
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(value));
+
+    EXPECT_EQ(MultiQueue<int>(1, 1).getQueueCount(), 2);  // Two heaps at least, to choose from
+    EXPECT_EQ(MultiQueue<int>(3, 4).getQueueCount(), 12);
+    EXPECT_THROW(MultiQueue<int>(0), std::invalid_argument);
+    EXPECT_THROW(MultiQueue<int>(2, 0), std::invalid_argument);
+}
+
+// Test that every element comes out once, and that a queue of two heaps is close to exact
+TEST(MultiQueueTest, SingleThreadPopsEveryElement)
+{
+    MultiQueue<int> queue(1);
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(3));
+    for (int value : values)
+    {
+        queue.push(value);
+    }
+    EXPECT_EQ(queue.getSize(), 1000);
+
+    std::vector<int> popped;
+    int value = 0;
+    while (queue.tryPop(value))
+    {
+        popped.push_back(value);
+    }
+    EXPECT_TRUE(queue.isEmpty());
+    std::vector<int> sorted = popped;
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(sorted, values);
+
+    // The smallest value left is the one an exact queue pops: with 2 heaps, it is on top of one of the two heaps
+    EXPECT_EQ(popped.front(), 0);
+    std::set<int> left(values.begin(), values.end());
+    long long rankSum = 0;
+    for (int v : popped)
+    {
+        rankSum += std::distance(left.begin(), left.find(v));
+        left.erase(v);
+    }
+    EXPECT_EQ(rankSum, 0);  // Both heaps are always the two looked at
+}
+
+// Test the rank error with more heaps than threads: bounded by a small multiple of the number of heaps
+TEST(MultiQueueTest, RankErrorStaysSmall)
+{
+    MultiQueue<int> queue(8);  // 16 heaps
+    std::set<int> contents;
+    std::mt19937 generator(5);
+    for (int i = 0; i < 10'000; ++i)
+    {
+        const int value = static_cast<int>(generator() % 1'000'000);
+        if (contents.insert(value).second)
+        {
+            queue.push(value);
+        }
+    }
+
+    long long rankSum = 0;
+    int pops = 0;
+    int value = 0;
+    while (queue.tryPop(value))
+    {
+        const auto found = contents.find(value);
+        ASSERT_NE(found, contents.end());
+        rankSum += std::distance(contents.begin(), found);
+        contents.erase(found);
+        ++pops;
+    }
+    EXPECT_TRUE(contents.empty());
+    EXPECT_LT(static_cast<double>(rankSum) / pops, 4.0 * queue.getQueueCount());
+}
+
+// Test elements that own memory
+TEST(MultiQueueTest, StringElements)
+{
+    MultiQueue<std::string> queue(2);
+    queue.push("pear");
+    queue.push("apple");
+    queue.push("fig");
+    std::multiset<std::string> popped;
+    std::string value;
+    while (queue.tryPop(value))
+    {
+        popped.insert(value);
+    }
+    EXPECT_EQ(popped, (std::multiset<std::string>{"apple", "fig", "pear"}));
+}
+
+// Test that every element pushed by several producers is popped exactly once by several consumers
+TEST(MultiQueueTest, ProducersConsumersExactlyOnce)
+{
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int perProducer = 50'000;
+    MultiQueue<int> queue(producers + consumers);
+
+    std::vector<std::atomic<int>> seen(producers * perProducer);
+    std::atomic<int> remaining = producers * perProducer;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back(
+            [&, p]
+            {
+                for (int i = 0; i < perProducer; ++i)
+                {
+                    queue.push(p * perProducer + i);
+                }
+            });
+    }
+    for (int c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                int value = 0;
+                while (remaining.load() > 0)
+                {
+                    if (!queue.tryPop(value))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    seen[value].fetch_add(1);
+                    remaining.fetch_sub(1);
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < producers * perProducer; ++i)
+    {
+        ASSERT_EQ(seen[i].load(), 1) << "element " << i;
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+// Test that threads popping and pushing back a later value, as workers of a scheduler do, lose nothing
+TEST(MultiQueueTest, ConcurrentPopPush)
+{
+    constexpr int threadCount = 4;
+    constexpr int initial = 1000;
+    constexpr int rounds = 20'000;
+    MultiQueue<long long> queue(threadCount);
+    for (int i = 0; i < initial; ++i)
+    {
+        queue.push(i);
+    }
+
+    std::atomic<long long> popped = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                long long value = 0;
+                for (int i = 0; i < rounds; ++i)
+                {
+                    if (queue.tryPop(value))
+                    {
+                        popped.fetch_add(1);
+                        queue.push(value + initial);
+                    }
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(popped.load(), static_cast<long long>(threadCount) * rounds);  // Never empty, every pop succeeds
+    EXPECT_EQ(queue.getSize(), initial);
+}
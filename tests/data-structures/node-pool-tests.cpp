@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <list.hpp>
+#include <memory_resource>
+#include <node-pool.hpp>
+
+// Memory resource counting the bytes it hands out and gets back
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t allocations{0};
+    std::size_t bytesInUse{0};
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocations++;
+        bytesInUse += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+    {
+        bytesInUse -= bytes;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+using IntNode = Node<int>;
+using PmrPool = NodePool<IntNode, std::pmr::polymorphic_allocator<IntNode>>;
+
+TEST(NodePoolTest, ReleasedNodeIsReused)
+{
+    NodePool<IntNode> pool;
+    IntNode* first = pool.allocate();
+    IntNode* second = pool.allocate();
+    EXPECT_NE(first, second);
+
+    pool.deallocate(first);
+    EXPECT_EQ(pool.allocate(), first);
+}
+
+TEST(NodePoolTest, SlabsGrowGeometrically)
+{
+    NodePool<IntNode> pool;
+    EXPECT_EQ(pool.getCapacity(), 0);
+
+    for (std::size_t i = 0; i < NodePool<IntNode>::FIRST_SLAB_SIZE; ++i)
+    {
+        pool.allocate();
+    }
+    EXPECT_EQ(pool.getCapacity(), NodePool<IntNode>::FIRST_SLAB_SIZE);
+
+    pool.allocate();
+    EXPECT_EQ(pool.getCapacity(), 3 * NodePool<IntNode>::FIRST_SLAB_SIZE);
+}
+
+TEST(NodePoolTest, SteadyStateDoesNotAllocate)
+{
+    CountingResource resource;
+    PmrPool pool(&resource);
+
+    IntNode* nodes[100];
+    for (auto& node : nodes)
+    {
+        node = pool.allocate();
+    }
+    const std::size_t allocations = resource.allocations;
+
+    for (int round = 0; round < 1000; ++round)
+    {
+        for (auto& node : nodes)
+        {
+            pool.deallocate(node);
+        }
+        for (auto& node : nodes)
+        {
+            node = pool.allocate();
+        }
+    }
+
+    EXPECT_EQ(resource.allocations, allocations);
+}
+
+TEST(NodePoolTest, ReleaseReturnsEverySlab)
+{
+    CountingResource resource;
+    {
+        PmrPool pool(&resource);
+        for (int i = 0; i < 5000; ++i)
+        {
+            pool.allocate();
+        }
+        EXPECT_GT(resource.bytesInUse, 5000 * sizeof(IntNode));
+
+        pool.release();
+        EXPECT_EQ(resource.bytesInUse, 0);
+        EXPECT_EQ(pool.getCapacity(), 0);
+
+        pool.allocate();  // Still usable after a release
+    }
+    EXPECT_EQ(resource.bytesInUse, 0);
+}
+
+TEST(NodePoolTest, MoveTakesSlabs)
+{
+    CountingResource resource;
+    PmrPool pool(&resource);
+    IntNode* node = pool.allocate();
+    pool.deallocate(node);
+
+    PmrPool moved(std::move(pool));
+    EXPECT_EQ(pool.getCapacity(), 0);
+    EXPECT_EQ(moved.getCapacity(), NodePool<IntNode>::FIRST_SLAB_SIZE);
+    EXPECT_EQ(moved.allocate(), node);
+    EXPECT_EQ(moved.getAllocator().resource(), &resource);
+}
+
+TEST(NodePoolTest, AdoptTakesNodesInUse)
+{
+    constexpr std::size_t slabSize = NodePool<IntNode>::FIRST_SLAB_SIZE;
+    CountingResource resource;
+    PmrPool pool(&resource);
+    IntNode* mine = pool.allocate();
+    IntNode* theirs = nullptr;
+    IntNode* released = nullptr;
+    {
+        PmrPool other(&resource);
+        theirs = other.allocate();
+        released = other.allocate();
+        other.deallocate(released);
+
+        pool.adopt(other);
+        EXPECT_EQ(other.getCapacity(), 0);
+        EXPECT_EQ(pool.getCapacity(), 2 * slabSize);
+    }
+
+    // The slabs of the destroyed pool are still alive, every free slot of both slabs is handed out before a new slab
+    bool releasedReused = false;
+    for (std::size_t i = 0; i < 2 * slabSize - 2; ++i)
+    {
+        IntNode* node = pool.allocate();
+        EXPECT_NE(node, mine);
+        EXPECT_NE(node, theirs);
+        releasedReused = releasedReused || node == released;
+    }
+    EXPECT_TRUE(releasedReused);
+    EXPECT_EQ(pool.getCapacity(), 2 * slabSize);
+
+    pool.release();
+    EXPECT_EQ(resource.bytesInUse, 0);
+}
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <pairing-heap.hpp>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <typename Heap>
+static std::vector<typename Heap::value_type> drain(Heap& heap)
+{
+    std::vector<typename Heap::value_type> result;
+    while (!heap.isEmpty())
+    {
+        result.push_back(heap.top());
+        heap.pop();
+    }
+    return result;
+}
+
+TEST(PairingHeapTest, StartsEmpty)
+{
+    PairingHeap<int> heap;
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_EQ(heap.getSize(), 0);
+    EXPECT_TRUE(heap.toVector().empty());
+    EXPECT_THROW((void)heap.top(), std::out_of_range);
+    EXPECT_NO_THROW(heap.pop());
+}
+
+TEST(PairingHeapTest, PopsInOrder)
+{
+    PairingHeap<int> heap;
+    for (int value : {10, 4, 5, 30, 3, 8, 4})
+    {
+        heap.insert(value);
+    }
+    EXPECT_EQ(heap.getSize(), 7);
+    EXPECT_EQ(heap.top(), 3);
+    EXPECT_EQ(heap.toVector().front(), 3);
+    EXPECT_EQ(drain(heap), (std::vector<int>{3, 4, 4, 5, 8, 10, 30}));
+}
+
+TEST(PairingHeapTest, ToVectorHoldsEveryElement)
+{
+    PairingHeap<int> heap;
+    std::vector<int> values = {7, 1, 9, 3, 3, 12, 0, 5};
+    for (int value : values)
+    {
+        heap.insert(value);
+    }
+    heap.pop();
+    values.erase(std::min_element(values.begin(), values.end()));
+
+    std::vector<int> contents = heap.toVector();
+    EXPECT_EQ(contents.front(), 1);
+    std::sort(contents.begin(), contents.end());
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(contents, values);
+}
+
+TEST(PairingHeapTest, DecreaseKey)
+{
+    PairingHeap<int> heap;
+    heap.insert(10);
+    auto twenty = heap.insert(20);
+    auto thirty = heap.insert(30);
+    heap.insert(40);
+    heap.pop();  // Builds a deeper tree than the list of roots of the inserts
+
+    heap.decreaseKey(thirty, 5);
+    EXPECT_EQ(*thirty, 5);
+    EXPECT_EQ(heap.top(), 5);
+    heap.decreaseKey(twenty, 20);  // An equal value is allowed
+    EXPECT_THROW(heap.decreaseKey(twenty, 21), std::invalid_argument);
+    EXPECT_EQ(drain(heap), (std::vector<int>{5, 20, 40}));
+}
+
+TEST(PairingHeapTest, Erase)
+{
+    PairingHeap<int> heap;
+    std::vector<PairingHeap<int>::Handle> handles;
+    for (int value = 0; value < 10; ++value)
+    {
+        handles.push_back(heap.insert(value));
+    }
+    heap.pop();
+    heap.erase(handles[5]);
+    heap.erase(handles[1]);  // The top
+    heap.erase(handles[9]);
+    EXPECT_EQ(heap.getSize(), 6);
+    EXPECT_EQ(drain(heap), (std::vector<int>{2, 3, 4, 6, 7, 8}));
+}
+
+TEST(PairingHeapTest, MeldKeepsHandles)
+{
+    PairingHeap<int> first;
+    PairingHeap<int> second;
+    first.insert(5);
+    first.insert(15);
+    second.insert(10);
+    auto twenty = second.insert(20);
+
+    first.meld(second);
+    EXPECT_TRUE(second.isEmpty());
+    EXPECT_EQ(first.getSize(), 4);
+
+    first.decreaseKey(twenty, 1);  // A handle of the other heap now refers to this one
+    EXPECT_EQ(drain(first), (std::vector<int>{1, 5, 10, 15}));
+
+    second.insert(3);  // The emptied heap is still usable
+    first.meld(first);
+    first.meld(second);
+    EXPECT_EQ(drain(first), (std::vector<int>{3}));
+}
+
+TEST(PairingHeapTest, MeldBetweenMemoryResources)
+{
+    // The nodes of the other heap can not be taken over, its elements are moved into new nodes
+    std::pmr::monotonic_buffer_resource firstResource;
+    std::pmr::monotonic_buffer_resource secondResource;
+    using Heap = PairingHeap<std::string, std::less<std::string>, std::pmr::polymorphic_allocator<std::string>>;
+    Heap first(std::less<std::string>(), &firstResource);
+    Heap second(std::less<std::string>(), &secondResource);
+    first.insert("kiwi");
+    second.insert("banana");
+    second.insert("plum");
+    second.insert("cherry");
+
+    first.meld(second);
+    EXPECT_TRUE(second.isEmpty());
+    EXPECT_EQ(first.getSize(), 4);
+    EXPECT_EQ(drain(first), (std::vector<std::string>{"banana", "cherry", "kiwi", "plum"}));
+
+    second.insert("fig");
+    EXPECT_EQ(second.top(), "fig");
+}
+
+TEST(PairingHeapTest, CustomComparatorAndNonTrivialType)
+{
+    PairingHeap<std::string, std::greater<std::string>> heap;
+    heap.insert("pear");
+    auto apple = heap.insert("apple");
+    heap.insert("fig");
+    EXPECT_EQ(heap.top(), "pear");
+    heap.decreaseKey(apple, "zucchini");  // "Decrease" in the order of the comparator
+    EXPECT_EQ(heap.top(), "zucchini");
+    heap.pop();
+    EXPECT_EQ(heap.top(), "pear");
+    heap.clear();
+    EXPECT_TRUE(heap.isEmpty());
+    heap.insert("kiwi");
+    EXPECT_EQ(heap.top(), "kiwi");
+}
+
+TEST(PairingHeapTest, MoveOnlyElements)
+{
+    auto byValue = [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; };
+    PairingHeap<std::unique_ptr<int>, decltype(byValue)> heap(byValue);
+    heap.insert(std::make_unique<int>(3));
+    heap.emplace(new int(1));
+    heap.insert(std::make_unique<int>(2));
+    EXPECT_EQ(*heap.top(), 1);
+
+    PairingHeap<std::unique_ptr<int>, decltype(byValue)> moved(std::move(heap));
+    EXPECT_TRUE(heap.isEmpty());
+    moved.pop();
+    EXPECT_EQ(*moved.top(), 2);
+}
+
+TEST(PairingHeapTest, LongChainsDoNotRecurse)
+{
+    // Decreasing inserts make the root have n children, a pop then joins them all
+    PairingHeap<int> heap;
+    const int count = 200000;
+    for (int value = count; value > 0; --value)
+    {
+        heap.insert(value);
+    }
+    for (int value = 1; value <= count; ++value)
+    {
+        ASSERT_EQ(heap.top(), value);
+        heap.pop();
+    }
+}
+
+TEST(PairingHeapTest, MatchesSortedOrderUnderRandomOperations)
+{
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> anyValue(0, 100000);
+    PairingHeap<int> heap;
+    std::vector<PairingHeap<int>::Handle> handles;
+    std::multiset<int> model;
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        const int operation = static_cast<int>(generator() % 4);
+        if (operation < 2 || handles.empty())
+        {
+            const int value = anyValue(generator);
+            handles.push_back(heap.insert(value));
+            model.insert(value);
+        }
+        else if (operation == 2)
+        {
+            const std::size_t index = generator() % handles.size();
+            const int old = *handles[index];
+            const int value = old - static_cast<int>(generator() % 1000);
+            heap.decreaseKey(handles[index], value);
+            model.erase(model.find(old));
+            model.insert(value);
+        }
+        else
+        {
+            const std::size_t index = generator() % handles.size();
+            model.erase(model.find(*handles[index]));
+            heap.erase(handles[index]);
+            handles[index] = handles.back();
+            handles.pop_back();
+        }
+        ASSERT_EQ(heap.getSize(), static_cast<int>(model.size()));
+        if (!model.empty())
+        {
+            ASSERT_EQ(heap.top(), *model.begin());
+        }
+    }
+}
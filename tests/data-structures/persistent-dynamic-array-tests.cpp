@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <insert-sort.hpp>
+#include <persistent-dynamic-array.hpp>
+#include <string>
+#include <useful-concepts.hpp>
+
+// Gives every test its own file and removes it afterwards
+class PersistentDynamicArrayTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+        mPath = (std::filesystem::temp_directory_path() / (std::string("persistent-array-") + test->name())).string();
+        std::filesystem::remove(mPath);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(mPath);
+    }
+
+    std::string mPath;
+};
+
+struct Point
+{
+    int x;
+    double y;
+
+    bool operator==(const Point& other) const = default;
+};
+
+// Test that a new file starts empty and has the header followed by the initial capacity
+TEST_F(PersistentDynamicArrayTest, CreatesEmptyFile)
+{
+    PersistentDynamicArray<int> arr(mPath);
+    EXPECT_EQ(arr.getSize(), 0);
+    EXPECT_TRUE(arr.isEmpty());
+    EXPECT_GT(arr.getCapacity(), 0);
+    EXPECT_EQ(arr.getPath(), mPath);
+    EXPECT_TRUE(std::filesystem::exists(mPath));
+}
+
+// Test that the elements are there after reopening the file
+TEST_F(PersistentDynamicArrayTest, ReopenKeepsElements)
+{
+    {
+        PersistentDynamicArray<Point> arr(mPath);
+        for (int i = 0; i < 10000; ++i)  // Grows the file several times
+        {
+            arr.append(Point{i, i * 0.5});
+        }
+        arr.flush();
+    }
+
+    PersistentDynamicArray<Point> reopened(mPath);
+    ASSERT_EQ(reopened.getSize(), 10000);
+    for (int i = 0; i < 10000; ++i)
+    {
+        EXPECT_EQ(reopened[i], (Point{i, i * 0.5}));
+    }
+
+    reopened.append(Point{-1, -1.0});  // And it keeps growing
+    EXPECT_EQ(reopened.getSize(), 10001);
+}
+
+// Test that growing the file does not move the elements
+TEST_F(PersistentDynamicArrayTest, GrowthNeverMovesElements)
+{
+    PersistentDynamicArray<int> arr(mPath);
+    arr.append(0);
+    const int* first = &arr[0];
+    const int initialCapacity = arr.getCapacity();
+    for (int i = 1; i < 8 * initialCapacity; ++i)
+    {
+        arr.append(i);
+    }
+
+    EXPECT_GT(arr.getCapacity(), initialCapacity);
+    EXPECT_EQ(&arr[0], first);
+    EXPECT_EQ(arr[8 * initialCapacity - 1], 8 * initialCapacity - 1);
+}
+
+// Test that files of another element type or format are rejected
+TEST_F(PersistentDynamicArrayTest, RejectsIncompatibleFiles)
+{
+    {
+        PersistentDynamicArray<int> arr(mPath);
+        arr.append(1);
+    }
+    EXPECT_THROW(PersistentDynamicArray<double> wrongType(mPath), std::runtime_error);
+
+    std::ofstream(mPath, std::ios::trunc) << "not an array";
+    EXPECT_THROW(PersistentDynamicArray<int> garbage(mPath), std::runtime_error);
+
+    EXPECT_THROW(PersistentDynamicArray<int> missingDirectory(mPath + ".d/array"), std::runtime_error);
+}
+
+// Test that the array cannot grow past its maximum capacity
+TEST_F(PersistentDynamicArrayTest, MaxCapacity)
+{
+    PersistentDynamicArray<int> arr(mPath, 10);
+    for (int i = 0; i < 10; ++i)
+    {
+        arr.append(i);
+    }
+    EXPECT_THROW(arr.append(10), std::runtime_error);
+    EXPECT_EQ(arr.getSize(), 10);
+}
+
+// Test insert and erase, including inserting an element of the array itself
+TEST_F(PersistentDynamicArrayTest, InsertAndErase)
+{
+    PersistentDynamicArray<int> arr(mPath);
+    arr.append(1);
+    arr.append(3);
+    arr.insert(2, 1);
+    arr.insert(arr[0], 0);
+    arr.erase(3);
+
+    ASSERT_EQ(arr.getSize(), 3);
+    EXPECT_EQ(arr[0], 1);
+    EXPECT_EQ(arr[1], 1);
+    EXPECT_EQ(arr[2], 2);
+    EXPECT_THROW(arr.insert(0, 4), std::out_of_range);
+    EXPECT_THROW(arr.erase(3), std::out_of_range);
+    EXPECT_THROW(arr[3], std::out_of_range);
+}
+
+// Test moving the array and using it with the existing templates
+TEST_F(PersistentDynamicArrayTest, MoveAndAlgorithms)
+{
+    PersistentDynamicArray<int> arr(mPath);
+    for (int value : {5, 3, 4, 1, 2})
+    {
+        arr.append(value);
+    }
+
+    PersistentDynamicArray<int> moved = std::move(arr);
+    insertSort(moved.begin(), moved.end());
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(moved[i], i + 1);
+    }
+
+    static_assert(HasAppend<PersistentDynamicArray<int>>);
+    static_assert(HasGetSize<PersistentDynamicArray<int>>);
+    static_assert(HasCustomBeginEnd<PersistentDynamicArray<int>>);
+}
@@ -1,14 +1,17 @@
 #include <gtest/gtest.h>
 #include <dynamic-array.hpp>
 #include <list.hpp>
+#include <small-dynamic-array.hpp>
+#include <memory_resource>
 #include <queue.hpp>
+#include <ring-buffer.hpp>
 
 template <typename ContainerType>
 class QueueTestsWithArrayAndList : public ::testing::Test
 {
 };
 
-using QueueContainerTypes = ::testing::Types<DynamicArray<int>, List<int>>;
+using QueueContainerTypes = ::testing::Types<RingBuffer<int>, DynamicArray<int>, List<int>, SmallDynamicArray<int, 4>>;
 
 TYPED_TEST_SUITE(QueueTestsWithArrayAndList, QueueContainerTypes);
 
@@ -135,3 +138,44 @@ TYPED_TEST(QueueTestsWithArrayAndList, LargeNumberOfElements)
 
     EXPECT_TRUE(queue.isEmpty());
 }
+
+TEST(QueuePmrTests, ContainerUsesArena)
+{
+    std::byte buffer[4096];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    Queue<int, PmrDynamicArray<int>> queue{std::pmr::polymorphic_allocator<int>(&arena)};
+    for (int i = 0; i < 50; ++i)
+    {
+        queue.push(i);
+    }
+    queue.pop();
+
+    EXPECT_EQ(queue.getSize(), 49);
+    EXPECT_EQ(queue.front(), 1);
+    EXPECT_EQ(queue.back(), 49);
+}
+
+// Test that a list backed queue stops allocating once it reached its largest size
+TEST(QueuePmrTests, ListPushPopDoesNotAllocateInSteadyState)
+{
+    std::byte buffer[4096];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    Queue<int, PmrList<int>> queue{std::pmr::polymorphic_allocator<int>(&arena)};
+    for (int i = 0; i < 64; ++i)
+    {
+        queue.push(i);
+    }
+    for (int i = 64; i < 1'000'000; ++i)
+    {
+        queue.pop();
+        queue.push(i);
+    }
+
+    EXPECT_EQ(queue.getSize(), 64);
+    EXPECT_EQ(queue.front(), 1'000'000 - 64);
+    EXPECT_EQ(queue.back(), 999'999);
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <radix-heap.hpp>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+TEST(RadixHeapTest, StartsEmpty)
+{
+    RadixHeap<unsigned> heap;
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_EQ(heap.getSize(), 0);
+    EXPECT_TRUE(heap.toVector().empty());
+    EXPECT_EQ(heap.getLastKey(), 0u);
+    EXPECT_THROW((void)heap.top(), std::out_of_range);
+    EXPECT_NO_THROW(heap.pop());
+}
+
+TEST(RadixHeapTest, PopsInOrder)
+{
+    RadixHeap<unsigned> heap;
+    for (unsigned key : {10u, 4u, 5u, 30u, 3u, 8u, 4u, 0u})
+    {
+        heap.insert(key);
+    }
+    EXPECT_EQ(heap.getSize(), 8);
+
+    std::vector<unsigned> popped;
+    while (!heap.isEmpty())
+    {
+        popped.push_back(heap.topKey());
+        heap.pop();
+    }
+    EXPECT_EQ(popped, (std::vector<unsigned>{0, 3, 4, 4, 5, 8, 10, 30}));
+    EXPECT_EQ(heap.getLastKey(), 30u);
+}
+
+TEST(RadixHeapTest, ToVectorHoldsEveryElementBucketByBucket)
+{
+    RadixHeap<unsigned> heap;
+    for (unsigned key : {1u, 100u, 7u, 64u, 7u})
+    {
+        heap.insert(key);
+    }
+    heap.pop();  // Last key 1
+
+    std::vector<unsigned> contents = heap.toVector();
+    ASSERT_EQ(contents.size(), 4);
+    EXPECT_EQ(contents.front(), 7u);
+    std::sort(contents.begin(), contents.end());
+    EXPECT_EQ(contents, (std::vector<unsigned>{7, 7, 64, 100}));
+}
+
+TEST(RadixHeapTest, MonotoneInsertsAfterPops)
+{
+    RadixHeap<std::uint64_t> heap;
+    heap.insert(50);
+    heap.insert(70);
+    heap.pop();
+    EXPECT_EQ(heap.getLastKey(), 50u);
+
+    heap.insert(50);  // Equal to the last key is allowed
+    heap.insert(60);
+    EXPECT_THROW(heap.insert(49), std::invalid_argument);
+    EXPECT_EQ(heap.getSize(), 3);
+    EXPECT_EQ(heap.topKey(), 50u);
+    heap.pop();
+    EXPECT_EQ(heap.topKey(), 60u);
+    EXPECT_EQ(heap.getLastKey(), 50u);  // Reading the top leaves the last key alone
+    heap.insert(55);                    // Smaller than the top, but not than the last key popped
+    EXPECT_EQ(heap.topKey(), 55u);
+    heap.pop();
+    EXPECT_EQ(heap.getLastKey(), 55u);
+    EXPECT_EQ(heap.topKey(), 60u);
+    EXPECT_THROW(heap.insert(54), std::invalid_argument);
+
+    heap.clear();
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_EQ(heap.getLastKey(), 55u);
+    heap.insert(std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(heap.topKey(), std::numeric_limits<std::uint64_t>::max());
+}
+
+TEST(RadixHeapTest, SignedKeys)
+{
+    RadixHeap<int> heap;
+    for (int key : {5, -3, 0, std::numeric_limits<int>::min(), -1, std::numeric_limits<int>::max()})
+    {
+        heap.insert(key);
+    }
+    std::vector<int> popped;
+    while (!heap.isEmpty())
+    {
+        popped.push_back(heap.topKey());
+        heap.pop();
+    }
+    const std::vector<int> expected = {std::numeric_limits<int>::min(), -3, -1, 0, 5, std::numeric_limits<int>::max()};
+    EXPECT_EQ(popped, expected);
+}
+
+TEST(RadixHeapTest, KeysWithValues)
+{
+    RadixHeap<unsigned, int> heap;
+    heap.insert(20, 2);
+    heap.insert(10, 1);
+    heap.insert(30, 3);
+    EXPECT_EQ(heap.top(), (std::pair<unsigned, int>{10, 1}));
+    heap.pop();
+    EXPECT_EQ(heap.top().second, 2);
+    EXPECT_EQ(heap.toVector().size(), 2);
+}
+
+TEST(RadixHeapTest, SmallKeyType)
+{
+    RadixHeap<std::uint8_t> heap;
+    for (int key = 255; key >= 0; key -= 5)
+    {
+        heap.insert(static_cast<std::uint8_t>(key));
+    }
+    int previous = -1;
+    while (!heap.isEmpty())
+    {
+        EXPECT_GT(heap.topKey(), previous);
+        previous = heap.topKey();
+        heap.pop();
+    }
+    EXPECT_EQ(previous, 255);
+}
+
+TEST(RadixHeapTest, MatchesSortedOrderOnMonotoneWorkload)
+{
+    // An event simulation: pop the next event, schedule a later one
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<unsigned> delay(0, 5000);
+    RadixHeap<unsigned, int> heap;
+    std::multiset<unsigned> model;
+    for (int event = 0; event < 1000; ++event)
+    {
+        const unsigned time = delay(generator);
+        heap.insert(time, event);
+        model.insert(time);
+    }
+    for (int step = 0; step < 50000; ++step)
+    {
+        ASSERT_EQ(heap.topKey(), *model.begin());
+        const unsigned now = heap.topKey();
+        heap.pop();
+        model.erase(model.begin());
+        if (step % 3 != 0)
+        {
+            const unsigned time = now + delay(generator);
+            heap.insert(time, step);
+            model.insert(time);
+        }
+        if (model.empty())
+        {
+            break;
+        }
+    }
+    EXPECT_EQ(heap.getSize(), static_cast<int>(model.size()));
+}
+
+TEST(RadixHeapTest, InsertsBelowTheTopAfterReadingIt)
+{
+    // Read the top, then insert keys between the last key and the top, some of them becoming the new top
+    std::mt19937 generator(5);
+    RadixHeap<unsigned> heap;
+    std::multiset<unsigned> model;
+    for (int step = 0; step < 20000; ++step)
+    {
+        if (!model.empty())
+        {
+            ASSERT_EQ(heap.topKey(), *model.begin());
+        }
+        const unsigned last = heap.getLastKey();
+        const unsigned span = model.empty() ? 1000 : *model.begin() - last + 100;
+        for (int i = 0; i < 2; ++i)
+        {
+            const unsigned key = last + generator() % span;
+            heap.insert(key);
+            model.insert(key);
+            ASSERT_EQ(heap.topKey(), *model.begin());
+        }
+        for (int i = 0; i < 2 + step % 2; ++i)
+        {
+            if (!model.empty())
+            {
+                heap.pop();
+                model.erase(model.begin());
+            }
+        }
+    }
+    EXPECT_EQ(heap.toVector().size(), model.size());
+}
@@ -0,0 +1,318 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <ring-buffer.hpp>
+#include <stdexcept>
+#include <string>
+
+// Fill a buffer so that its elements wrap around the end of the storage
+static RingBuffer<int> makeWrapped()
+{
+    RingBuffer<int> buffer;
+    for (int i = 0; i < 8; ++i)
+    {
+        buffer.append(i);
+    }
+    for (int i = 0; i < 5; ++i)
+    {
+        buffer.removeFirst();
+    }
+    for (int i = 8; i < 12; ++i)
+    {
+        buffer.append(i);
+    }
+    return buffer;  // 5 to 11, from slot 5 of 8
+}
+
+// Test the state of a new buffer
+TEST(RingBufferTest, InitialState)
+{
+    RingBuffer<int> buffer;
+    EXPECT_TRUE(buffer.isEmpty());
+    EXPECT_EQ(buffer.getSize(), 0);
+    EXPECT_EQ(buffer.getCapacity(), 0);
+    EXPECT_EQ(buffer.begin(), buffer.end());
+}
+
+// Test that the capacity is always a power of two
+TEST(RingBufferTest, CapacityIsAPowerOfTwo)
+{
+    RingBuffer<int> buffer(20);
+    EXPECT_EQ(buffer.getCapacity(), 32);
+
+    RingBuffer<int> grown;
+    for (int i = 0; i < 100; ++i)
+    {
+        grown.append(i);
+    }
+    EXPECT_EQ(grown.getCapacity(), 128);
+
+    grown.reserve(129);
+    EXPECT_EQ(grown.getCapacity(), 256);
+    EXPECT_EQ(grown[99], 99);
+}
+
+// Test FIFO order across the wrap-around of the storage
+TEST(RingBufferTest, AppendAndRemoveFirstWrapAround)
+{
+    RingBuffer<int> buffer = makeWrapped();
+    EXPECT_EQ(buffer.getCapacity(), 8);
+    EXPECT_EQ(buffer.getSize(), 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        EXPECT_EQ(buffer[i], i + 5);
+    }
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), std::vector<int>{5, 6, 7, 8, 9, 10, 11}.begin()));
+}
+
+// Test that growing a wrapped buffer keeps the order of its elements
+TEST(RingBufferTest, GrowWhileWrapped)
+{
+    RingBuffer<int> buffer = makeWrapped();
+    buffer.append(12);
+    buffer.append(13);  // Full at 8, grows to 16
+    EXPECT_EQ(buffer.getCapacity(), 16);
+    for (int i = 0; i < buffer.getSize(); ++i)
+    {
+        EXPECT_EQ(buffer[i], i + 5);
+    }
+}
+
+// Test the buffer against std::deque on a random sequence of operations
+TEST(RingBufferTest, MatchesDequeOnRandomOperations)
+{
+    std::mt19937 rng(17);
+    RingBuffer<std::string> buffer;
+    std::deque<std::string> expected;
+    for (int step = 0; step < 20'000; ++step)
+    {
+        if (expected.empty() || rng() % 3 != 0)
+        {
+            const std::string value = std::to_string(step) + " with a heap allocated tail";
+            buffer.append(value);
+            expected.push_back(value);
+        }
+        else
+        {
+            buffer.removeFirst();
+            expected.pop_front();
+        }
+        ASSERT_EQ(buffer.getSize(), static_cast<int>(expected.size()));
+    }
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), expected.begin(), expected.end()));
+}
+
+// Test that removing from an empty buffer throws
+TEST(RingBufferTest, RemoveFirstOnEmptyThrows)
+{
+    RingBuffer<int> buffer;
+    EXPECT_THROW(buffer.removeFirst(), std::out_of_range);
+    buffer.append(1);
+    buffer.removeFirst();
+    EXPECT_THROW(buffer.removeFirst(), std::out_of_range);
+}
+
+// Test the bounds checks of operator[]
+TEST(RingBufferTest, CheckedAccessOutOfRange)
+{
+    RingBuffer<int, std::allocator<int>, CheckedAccess> buffer = {1, 2, 3};
+    EXPECT_EQ(buffer[2], 3);
+    EXPECT_THROW(buffer[3], std::out_of_range);
+    EXPECT_THROW(buffer[-1], std::out_of_range);
+}
+
+// Test that emplaceBack may take an element of the buffer while it grows
+TEST(RingBufferTest, EmplaceBackOwnElementWhileGrowing)
+{
+    RingBuffer<std::string> buffer;
+    for (int i = 0; i < 8; ++i)
+    {
+        buffer.append(std::string(30, static_cast<char>('a' + i)));
+    }
+    buffer.emplaceBack(buffer[0]);
+    EXPECT_EQ(buffer[8], std::string(30, 'a'));
+}
+
+// An element whose copy throws on demand, with a move that may throw so that growing copies the elements
+struct ThrowingCopy
+{
+    static inline bool shouldThrow = false;
+    int value;
+
+    ThrowingCopy(int value) : value(value)
+    {
+    }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (shouldThrow)
+        {
+            throw std::runtime_error("copy");
+        }
+    }
+    ThrowingCopy(ThrowingCopy&& other) noexcept(false) : ThrowingCopy(static_cast<const ThrowingCopy&>(other))
+    {
+    }
+    ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+
+// Test that a wrapped buffer is left unchanged when copying its elements to larger storage throws
+TEST(RingBufferTest, ThrowingRelocationLeavesBufferUnchanged)
+{
+    RingBuffer<ThrowingCopy> buffer;
+    for (int i = 0; i < 8; ++i)
+    {
+        buffer.append(i);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        buffer.removeFirst();
+    }
+    for (int i = 8; i < 11; ++i)
+    {
+        buffer.append(i);
+    }
+
+    ThrowingCopy::shouldThrow = true;
+    EXPECT_THROW(buffer.emplaceBack(11), std::runtime_error);
+    EXPECT_THROW(buffer.reserve(32), std::runtime_error);
+    ThrowingCopy::shouldThrow = false;
+
+    EXPECT_EQ(buffer.getSize(), 8);
+    EXPECT_EQ(buffer.getCapacity(), 8);
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(buffer[i].value, i + 3);
+    }
+    buffer.emplaceBack(11);
+    EXPECT_EQ(buffer[8].value, 11);
+}
+
+// An element whose copy throws after a given number of copies, counting its live instances
+struct ThrowingItem
+{
+    static inline int alive = 0;
+    static inline int copiesLeft = -1;  // Negative for no limit
+
+    int value{0};
+
+    ThrowingItem(int _value) : value(_value)
+    {
+        alive++;
+    }
+    ThrowingItem(const ThrowingItem& other) : value(other.value)
+    {
+        if (copiesLeft == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+        copiesLeft--;
+        alive++;
+    }
+    ~ThrowingItem()
+    {
+        alive--;
+    }
+};
+
+// Test that a copy throwing while a buffer is copied or built from a list leaks no element
+TEST(RingBufferTest, ThrowingCopyInConstructorsLeaksNothing)
+{
+    {
+        RingBuffer<ThrowingItem> buffer;
+        for (int i = 0; i < 5; ++i)
+        {
+            buffer.emplaceBack(i);
+        }
+        const std::initializer_list<ThrowingItem> list = {0, 1, 2};
+
+        ThrowingItem::copiesLeft = 2;
+        EXPECT_THROW((RingBuffer<ThrowingItem>(buffer)), std::runtime_error);
+        ThrowingItem::copiesLeft = 2;
+        EXPECT_THROW((RingBuffer<ThrowingItem>(list)), std::runtime_error);
+        ThrowingItem::copiesLeft = -1;
+
+        EXPECT_EQ(ThrowingItem::alive, 8);  // The buffer and the list
+    }
+    EXPECT_EQ(ThrowingItem::alive, 0);
+}
+
+// Test that the iterators are random access, across the wrap-around
+TEST(RingBufferTest, RandomAccessIterators)
+{
+    static_assert(std::random_access_iterator<RingBuffer<int>::iterator>);
+    static_assert(std::random_access_iterator<RingBuffer<int>::const_iterator>);
+
+    RingBuffer<int> buffer = makeWrapped();
+    EXPECT_EQ(buffer.end() - buffer.begin(), 7);
+    EXPECT_EQ(*(buffer.end() - 1), 11);
+    EXPECT_EQ(buffer.begin()[4], 9);
+
+    std::reverse(buffer.begin(), buffer.end());
+    EXPECT_EQ(buffer[0], 11);
+    std::sort(buffer.begin(), buffer.end());
+    EXPECT_EQ(buffer[6], 11);
+
+    const RingBuffer<int>& constBuffer = buffer;
+    RingBuffer<int>::const_iterator it = buffer.begin();
+    EXPECT_EQ(it, constBuffer.begin());
+    EXPECT_EQ(std::lower_bound(constBuffer.begin(), constBuffer.end(), 8) - constBuffer.begin(), 3);
+}
+
+// Test copies and moves, including a copy of a wrapped buffer
+TEST(RingBufferTest, CopyAndMove)
+{
+    RingBuffer<int> buffer = makeWrapped();
+    RingBuffer<int> copy(buffer);
+    EXPECT_TRUE(copy == buffer);
+
+    RingBuffer<int> assigned = {1, 2};
+    assigned = buffer;
+    EXPECT_TRUE(assigned == buffer);
+
+    RingBuffer<int> moved(std::move(copy));
+    EXPECT_TRUE(moved == buffer);
+    EXPECT_TRUE(copy.isEmpty());
+
+    RingBuffer<int> moveAssigned;
+    moveAssigned = std::move(moved);
+    EXPECT_TRUE(moveAssigned == buffer);
+
+    moveAssigned.append(100);
+    EXPECT_FALSE(moveAssigned == buffer);
+}
+
+// Test that clear keeps the storage
+TEST(RingBufferTest, ClearKeepsCapacity)
+{
+    RingBuffer<std::string> buffer = {"one", "two", "three"};
+    buffer.clear();
+    EXPECT_TRUE(buffer.isEmpty());
+    EXPECT_EQ(buffer.getCapacity(), 8);
+    buffer.append("four");
+    EXPECT_EQ(buffer[0], "four");
+}
+
+// Test that a steady push/pop workload does not allocate once the buffer reached its largest size
+TEST(RingBufferTest, PmrSteadyStateDoesNotAllocate)
+{
+    std::byte storage[1024];
+    // The null upstream makes any allocation outside the storage throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage), std::pmr::null_memory_resource());
+
+    PmrRingBuffer<int> buffer{std::pmr::polymorphic_allocator<int>(&arena)};
+    for (int i = 0; i < 64; ++i)
+    {
+        buffer.append(i);
+    }
+    for (int i = 64; i < 1'000'000; ++i)
+    {
+        buffer.removeFirst();
+        buffer.append(i);
+    }
+    EXPECT_EQ(buffer[0], 1'000'000 - 64);
+}
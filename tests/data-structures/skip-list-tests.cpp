@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <skip-list.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <typename ListType>
+void expectElements(const ListType& list, std::initializer_list<typename ListType::value_type> expected)
+{
+    ASSERT_EQ(list.getSize(), static_cast<int>(expected.size()));
+    int index = 0;
+    for (const auto& item : expected)
+    {
+        EXPECT_EQ(list[index], item) << "at index " << index;
+        index++;
+    }
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+}
+
+TEST(SkipListTest, DefaultConstructor)
+{
+    SkipList<int> list;
+    EXPECT_EQ(list.getSize(), 0);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_EQ(list.lowerBound(5), list.end());
+}
+
+TEST(SkipListTest, InsertKeepsOrderAndRejectsDuplicates)
+{
+    SkipList<int> list;
+    for (int value : {5, 1, 9, 3, 7, 3, 5})
+    {
+        list.insert(value);
+    }
+
+    expectElements(list, {1, 3, 5, 7, 9});
+
+    auto [it, inserted] = list.insert(7);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(*it, 7);
+    EXPECT_TRUE(list.insert(8).second);
+    expectElements(list, {1, 3, 5, 7, 8, 9});
+}
+
+TEST(SkipListTest, IteratorsGoBothWays)
+{
+    SkipList<int> list = {4, 2, 6};
+
+    auto it = list.end();
+    EXPECT_EQ(*--it, 6);
+    EXPECT_EQ(*--it, 4);
+    EXPECT_EQ(*--it, 2);
+    EXPECT_EQ(it, list.begin());
+    EXPECT_EQ(*it++, 2);
+    EXPECT_EQ(*it, 4);
+
+    SkipList<int>::const_iterator constIt = list.begin();
+    EXPECT_EQ(*constIt, 2);
+}
+
+TEST(SkipListTest, FindAndBounds)
+{
+    SkipList<int> list = {10, 20, 30, 40};
+
+    EXPECT_EQ(*list.find(30), 30);
+    EXPECT_EQ(list.find(25), list.end());
+    EXPECT_TRUE(list.contains(10));
+    EXPECT_FALSE(list.contains(11));
+
+    EXPECT_EQ(*list.lowerBound(20), 20);
+    EXPECT_EQ(*list.lowerBound(21), 30);
+    EXPECT_EQ(*list.lowerBound(-5), 10);
+    EXPECT_EQ(list.lowerBound(41), list.end());
+    EXPECT_EQ(*list.upperBound(20), 30);
+    EXPECT_EQ(list.upperBound(40), list.end());
+}
+
+TEST(SkipListTest, EraseByKeyAndIterator)
+{
+    SkipList<int> list = {1, 2, 3, 4, 5, 6};
+
+    EXPECT_TRUE(list.erase(3));
+    EXPECT_FALSE(list.erase(3));
+    auto next = list.erase(list.find(1));
+    EXPECT_EQ(*next, 2);
+    EXPECT_EQ(list.erase(list.find(6)), list.end());
+
+    expectElements(list, {2, 4, 5});
+    EXPECT_EQ(*--list.end(), 5);
+
+    list.insert(3);  // Reuses an erased node
+    expectElements(list, {2, 3, 4, 5});
+}
+
+TEST(SkipListTest, RankAndRangeScan)
+{
+    SkipList<int> list;
+    for (int i = 0; i < 100; ++i)
+    {
+        list.insert(i * 2);  // Even numbers 0 to 198
+    }
+
+    EXPECT_EQ(list.getRank(0), 0);
+    EXPECT_EQ(list.getRank(51), 26);
+    EXPECT_EQ(list.getRank(1000), 100);
+    EXPECT_EQ(list.countRange(10, 20), 5);
+    EXPECT_EQ(list.countRange(20, 10), 0);
+
+    std::vector<int> scanned;
+    const int visited = list.scan(15, 25, [&scanned](int value) { scanned.push_back(value); });
+    EXPECT_EQ(visited, 5);
+    EXPECT_EQ(scanned, std::vector<int>({16, 18, 20, 22, 24}));
+}
+
+TEST(SkipListTest, MatchesStdSetUnderRandomOperations)
+{
+    SkipList<int, std::less<>, std::allocator<int>, CheckedAccess> list;
+    std::set<int> reference;
+    std::mt19937 rng(7);
+
+    for (int i = 0; i < 20'000; ++i)
+    {
+        const int value = static_cast<int>(rng() % 2'000);
+        if (rng() % 3 == 0)
+        {
+            EXPECT_EQ(list.erase(value), reference.erase(value) == 1);
+        }
+        else
+        {
+            EXPECT_EQ(list.insert(value).second, reference.insert(value).second);
+        }
+    }
+
+    ASSERT_EQ(list.getSize(), static_cast<int>(reference.size()));
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    int index = 0;
+    for (int value : reference)
+    {
+        ASSERT_EQ(list[index], value) << "at index " << index;
+        ASSERT_EQ(list.getRank(value), index);
+        index++;
+    }
+    EXPECT_THROW(list[list.getSize()], std::out_of_range);
+}
+
+TEST(SkipListTest, WorksAsAnOrderedMap)
+{
+    struct ByKey
+    {
+        bool operator()(const std::pair<int, std::string>& left, const std::pair<int, std::string>& right) const
+        {
+            return left.first < right.first;
+        }
+        bool operator()(const std::pair<int, std::string>& left, int right) const
+        {
+            return left.first < right;
+        }
+        bool operator()(int left, const std::pair<int, std::string>& right) const
+        {
+            return left < right.first;
+        }
+    };
+    SkipList<std::pair<int, std::string>, ByKey> map;
+    map.emplace(3, "three");
+    map.emplace(1, "one");
+    map.emplace(2, "two");
+    EXPECT_FALSE(map.emplace(2, "deux").second);
+
+    EXPECT_EQ(map.find(2)->second, "two");
+    map.find(2)->second = "deux";
+    EXPECT_EQ(map[1].second, "deux");
+    EXPECT_TRUE(map.erase(1));
+    EXPECT_EQ(map.begin()->first, 2);
+    EXPECT_EQ(map.getSize(), 2);
+}
+
+TEST(SkipListTest, CopyAndMove)
+{
+    SkipList<std::string> list = {"b", "a", "c"};
+
+    SkipList<std::string> copy(list);
+    expectElements(copy, {"a", "b", "c"});
+    copy.insert("d");
+    EXPECT_EQ(copy.getRank("d"), 3);
+    EXPECT_EQ(list.getSize(), 3);
+
+    SkipList<std::string> moved(std::move(copy));
+    expectElements(moved, {"a", "b", "c", "d"});
+    EXPECT_TRUE(copy.isEmpty());
+
+    list = moved;
+    EXPECT_EQ(list, moved);
+    list = std::move(moved);
+    expectElements(list, {"a", "b", "c", "d"});
+    list.erase("a");
+    expectElements(list, {"b", "c", "d"});
+}
+
+// An element whose copy throws once a number of copies were made
+struct ThrowingItem
+{
+    static inline int alive = 0;
+    static inline int copiesLeft = -1;  // Negative for no limit
+
+    int value{0};
+
+    ThrowingItem(int _value) : value(_value)
+    {
+        alive++;
+    }
+    ThrowingItem(const ThrowingItem& other) : value(other.value)
+    {
+        if (copiesLeft == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+        copiesLeft--;
+        alive++;
+    }
+    ThrowingItem& operator=(const ThrowingItem&) = default;
+    ~ThrowingItem()
+    {
+        alive--;
+    }
+
+    bool operator<(const ThrowingItem& other) const
+    {
+        return value < other.value;
+    }
+};
+
+TEST(SkipListTest, ThrowingCopyLeavesValidList)
+{
+    {
+        SkipList<ThrowingItem> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.emplace(i);
+        }
+
+        ThrowingItem::copiesLeft = 50;
+        EXPECT_THROW(SkipList<ThrowingItem>{list}, std::runtime_error);  // The copies made so far are released
+        EXPECT_EQ(ThrowingItem::alive, 100);
+
+        SkipList<ThrowingItem> assigned;
+        ThrowingItem::copiesLeft = 50;
+        EXPECT_THROW(assigned = list, std::runtime_error);
+        ThrowingItem::copiesLeft = -1;
+
+        // The first 50 elements were copied and form a valid list
+        ASSERT_EQ(assigned.getSize(), 50);
+        int expected = 0;
+        for (const ThrowingItem& item : assigned)
+        {
+            EXPECT_EQ(item.value, expected++);
+        }
+        EXPECT_EQ(expected, 50);
+        EXPECT_EQ(assigned.getRank(ThrowingItem(49)), 49);
+        assigned.emplace(75);
+        assigned.erase(ThrowingItem(10));
+        EXPECT_EQ(assigned.getSize(), 50);
+        EXPECT_EQ(assigned[49].value, 75);
+    }
+    EXPECT_EQ(ThrowingItem::alive, 0);
+}
+
+TEST(SkipListTest, NodesComeFromTheAllocator)
+{
+    std::pmr::monotonic_buffer_resource arena;
+    SkipList<int, std::less<>, std::pmr::polymorphic_allocator<int>> list{std::pmr::polymorphic_allocator<int>(&arena)};
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.insert(i);
+    }
+    for (int i = 0; i < 1000; i += 2)
+    {
+        list.erase(i);
+    }
+
+    EXPECT_EQ(list.getSize(), 500);
+    EXPECT_EQ(list[0], 1);
+    EXPECT_EQ(list.getAllocator().resource(), &arena);
+}
@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+#include <delete-duplicates.hpp>
+#include <insert-sort.hpp>
+#include <small-dynamic-array.hpp>
+#include <stack.hpp>
+#include <stdexcept>
+#include <string>
+
+// Test default constructor: empty, with the inline capacity and no heap storage
+TEST(SmallDynamicArrayTest, DefaultConstructor)
+{
+    SmallDynamicArray<int, 8> arr;
+    EXPECT_EQ(arr.getSize(), 0);
+    EXPECT_EQ(arr.getCapacity(), 8);
+    EXPECT_TRUE(arr.isEmpty());
+    EXPECT_TRUE(arr.isInline());
+}
+
+// Test that elements stay inline up to N and spill to the heap past N
+TEST(SmallDynamicArrayTest, SpillsToHeapPastInlineCapacity)
+{
+    SmallDynamicArray<int, 4> arr;
+    for (int i = 0; i < 4; ++i)
+    {
+        arr.append(i);
+    }
+    EXPECT_TRUE(arr.isInline());
+    EXPECT_EQ(arr.getCapacity(), 4);
+
+    arr.append(4);  // Spill
+    EXPECT_FALSE(arr.isInline());
+    EXPECT_EQ(arr.getCapacity(), 8);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(arr[i], i);
+    }
+}
+
+// Test initializer list constructor larger than the inline buffer
+TEST(SmallDynamicArrayTest, InitializerListConstructor)
+{
+    SmallDynamicArray<std::string, 2> small = {"a", "b"};
+    SmallDynamicArray<std::string, 2> large = {"a", "b", "c"};
+
+    EXPECT_TRUE(small.isInline());
+    EXPECT_FALSE(large.isInline());
+    EXPECT_EQ(large.getSize(), 3);
+    EXPECT_EQ(large[2], "c");
+}
+
+// Test copy constructor and copy assignment for inline and heap storage
+TEST(SmallDynamicArrayTest, CopyConstructorAndAssignment)
+{
+    SmallDynamicArray<std::string, 2> inlineArr = {"x", "y"};
+    SmallDynamicArray<std::string, 2> heapArr = {"a", "b", "c"};
+
+    SmallDynamicArray<std::string, 2> copy1 = inlineArr;
+    SmallDynamicArray<std::string, 2> copy2 = heapArr;
+    EXPECT_EQ(copy1, inlineArr);
+    EXPECT_EQ(copy2, heapArr);
+
+    copy1 = heapArr;
+    copy2 = inlineArr;
+    EXPECT_EQ(copy1, heapArr);
+    EXPECT_EQ(copy2, inlineArr);
+
+    copy1 = copy1;  // Self-assignment
+    EXPECT_EQ(copy1, heapArr);
+}
+
+// Test move constructor for inline storage (elements are moved) and heap storage (buffer is stolen)
+TEST(SmallDynamicArrayTest, MoveConstructor)
+{
+    SmallDynamicArray<std::string, 2> inlineArr = {"x", "y"};
+    SmallDynamicArray<std::string, 2> heapArr = {"a", "b", "c"};
+    const std::string* heapBuffer = heapArr.begin();
+
+    SmallDynamicArray<std::string, 2> moved1 = std::move(inlineArr);
+    SmallDynamicArray<std::string, 2> moved2 = std::move(heapArr);
+
+    EXPECT_EQ(moved1.getSize(), 2);
+    EXPECT_EQ(moved1[1], "y");
+    EXPECT_TRUE(moved1.isInline());
+    EXPECT_EQ(moved2.begin(), heapBuffer);
+    EXPECT_EQ(inlineArr.getSize(), 0);
+    EXPECT_EQ(heapArr.getSize(), 0);
+    EXPECT_TRUE(heapArr.isInline());  // Moved-from array falls back to its inline buffer
+
+    heapArr.append("again");  // Moved-from array is still usable
+    EXPECT_EQ(heapArr[0], "again");
+}
+
+// Test move assignment
+TEST(SmallDynamicArrayTest, MoveAssignment)
+{
+    SmallDynamicArray<std::string, 2> target = {"a", "b", "c"};
+    SmallDynamicArray<std::string, 2> source = {"x"};
+
+    target = std::move(source);
+    EXPECT_EQ(target.getSize(), 1);
+    EXPECT_EQ(target[0], "x");
+    EXPECT_TRUE(target.isInline());
+
+    target = std::move(target);  // Self-move-assignment
+    EXPECT_EQ(target.getSize(), 1);
+}
+
+// Test insert and erase, including out of bounds errors
+TEST(SmallDynamicArrayTest, InsertAndErase)
+{
+    SmallDynamicArray<int, 3> arr = {1, 3};
+
+    arr.insert(2, 1);
+    arr.insert(0, 0);  // Spills while inserting
+    auto it = arr.insert(4, 4);
+
+    SmallDynamicArray<int, 3> expected = {0, 1, 2, 3, 4};
+    EXPECT_EQ(arr, expected);
+    EXPECT_EQ(*it, 4);
+
+    it = arr.erase(0);
+    EXPECT_EQ(*it, 1);
+    it = arr.erase(3);
+    EXPECT_EQ(it, arr.end());
+
+    SmallDynamicArray<int, 3> expectedAfterErase = {1, 2, 3};
+    EXPECT_EQ(arr, expectedAfterErase);
+
+    EXPECT_THROW(arr.insert(5, -1), std::out_of_range);
+    EXPECT_THROW(arr.insert(5, 4), std::out_of_range);
+    EXPECT_THROW(arr.erase(3), std::out_of_range);
+    EXPECT_THROW(arr[3], std::out_of_range);
+
+    SmallDynamicArray<int, 3> empty;
+    EXPECT_THROW(empty.erase(0), std::out_of_range);
+}
+
+// An element whose copy throws after a given number of copies, with a move that may throw so that growing copies
+struct ThrowingItem
+{
+    static inline int alive = 0;
+    static inline int copiesLeft = -1;  // Negative for no limit
+
+    int value{0};
+
+    ThrowingItem(int _value) : value(_value)
+    {
+        alive++;
+    }
+    ThrowingItem(const ThrowingItem& other) : value(other.value)
+    {
+        if (copiesLeft == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+        copiesLeft--;
+        alive++;
+    }
+    ThrowingItem(ThrowingItem&& other) noexcept(false) : ThrowingItem(static_cast<const ThrowingItem&>(other))
+    {
+    }
+    ThrowingItem& operator=(const ThrowingItem&) = default;
+    ~ThrowingItem()
+    {
+        alive--;
+    }
+};
+
+// Test that a copy throwing while the storage grows or the array is copied leaves the array unchanged and leaks
+// no element
+TEST(SmallDynamicArrayTest, ThrowingCopyLeavesArrayUnchanged)
+{
+    {
+        SmallDynamicArray<ThrowingItem, 2> arr;
+        for (int i = 0; i < 4; ++i)
+        {
+            arr.emplaceBack(i);
+        }
+
+        ThrowingItem::copiesLeft = 2;
+        EXPECT_THROW(arr.emplaceBack(4), std::runtime_error);  // Throws while relocating the third element
+        ThrowingItem::copiesLeft = 2;
+        EXPECT_THROW((SmallDynamicArray<ThrowingItem, 2>{arr}), std::runtime_error);
+        ThrowingItem::copiesLeft = 1;
+        EXPECT_THROW((SmallDynamicArray<ThrowingItem, 2>{0, 1, 2}), std::runtime_error);
+        ThrowingItem::copiesLeft = -1;
+
+        EXPECT_EQ(arr.getSize(), 4);
+        EXPECT_EQ(arr.getCapacity(), 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(arr[i].value, i);
+        }
+        EXPECT_EQ(ThrowingItem::alive, 4);
+    }
+    EXPECT_EQ(ThrowingItem::alive, 0);
+}
+
+// Test that the array satisfies the container concepts and drops into the existing templates
+TEST(SmallDynamicArrayTest, WorksWithStackAndAlgorithms)
+{
+    static_assert(HasAppend<SmallDynamicArray<int, 4>>);
+    static_assert(HasGetSize<SmallDynamicArray<int, 4>>);
+    static_assert(HasCustomBeginEnd<SmallDynamicArray<int, 4>>);
+
+    Stack<int, SmallDynamicArray<int, 4>> stack;
+    for (int i = 0; i < 10; ++i)
+    {
+        stack.push(i);
+    }
+    EXPECT_EQ(stack.top(), 9);
+
+    SmallDynamicArray<int, 4> arr = {5, 3, 5, 1, 3};
+    deleteDuplicates(arr);
+    insertSort(arr.begin(), arr.end());
+
+    SmallDynamicArray<int, 4> expected = {1, 3, 5};
+    EXPECT_EQ(arr, expected);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <spsc-queue.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test the state of a new queue and the rounding of its capacity
+TEST(SpscQueueTest, InitialState)
+{
+    SpscQueue<int> queue(5);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.getSize(), 0);
+    EXPECT_EQ(queue.getCapacity(), 8);
+    EXPECT_THROW((void)queue.front(), std::out_of_range);
+    EXPECT_THROW(queue.pop(), std::out_of_range);
+    EXPECT_THROW(SpscQueue<int>(0), std::invalid_argument);
+}
+
+// Test FIFO order, the full queue and the wrap-around of the ring
+TEST(SpscQueueTest, PushPopSingleThread)
+{
+    SpscQueue<int> queue(4);
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.tryPush(round * 4 + i));
+        }
+        EXPECT_FALSE(queue.tryPush(-1));
+        EXPECT_EQ(queue.getSize(), 4);
+
+        EXPECT_EQ(queue.front(), round * 4);
+        queue.pop();
+        int value = -1;
+        for (int i = 1; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.tryPop(value));
+            EXPECT_EQ(value, round * 4 + i);
+        }
+        EXPECT_FALSE(queue.tryPop(value));
+        EXPECT_TRUE(queue.isEmpty());
+    }
+}
+
+// Test that the batch operations stop at the room and the elements available
+TEST(SpscQueueTest, BatchPushAndPop)
+{
+    SpscQueue<int> queue(8);
+    const std::vector<int> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(queue.tryPushN(values.begin(), 6), 6);
+    EXPECT_EQ(queue.tryPushN(values.begin() + 6, 4), 2);
+    EXPECT_EQ(queue.tryPushN(values.begin() + 8, 2), 0);
+
+    std::vector<int> popped(10, -1);
+    EXPECT_EQ(queue.tryPopN(popped.begin(), 3), 3);
+    EXPECT_EQ(queue.tryPushN(values.begin() + 8, 2), 2);
+    EXPECT_EQ(queue.tryPopN(popped.begin() + 3, 10), 7);
+    EXPECT_EQ(queue.tryPopN(popped.begin(), 1), 0);
+    EXPECT_EQ(popped, values);
+}
+
+// Test that the elements left in the queue are destroyed with it
+TEST(SpscQueueTest, DestroysRemainingElements)
+{
+    const auto shared = std::make_shared<int>(1);
+    {
+        SpscQueue<std::shared_ptr<int>> queue(4);
+        queue.push(shared);
+        queue.tryEmplace(shared);
+        std::shared_ptr<int> out;
+        EXPECT_TRUE(queue.tryPop(out));
+        EXPECT_EQ(shared.use_count(), 3);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+// Test that every element crosses from the producer to the consumer once and in order
+TEST(SpscQueueTest, ProducerConsumerKeepsOrder)
+{
+    constexpr int count = 200'000;
+    SpscQueue<std::string> queue(64);
+
+    std::thread producer(
+        [&]
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                queue.push(std::to_string(i));
+            }
+        });
+
+    int expected = 0;
+    std::string value;
+    while (expected < count)
+    {
+        if (queue.tryPop(value))
+        {
+            ASSERT_EQ(value, std::to_string(expected));
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+// Test the batch operations between two threads
+TEST(SpscQueueTest, ProducerConsumerBatches)
+{
+    constexpr int count = 500'000;
+    SpscQueue<int> queue(256);
+
+    std::thread producer(
+        [&]
+        {
+            std::vector<int> batch(32);
+            for (int next = 0; next < count;)
+            {
+                const int size = count - next < 32 ? count - next : 32;
+                for (int i = 0; i < size; ++i)
+                {
+                    batch[i] = next + i;
+                }
+                int pushed = 0;
+                while (pushed < size)
+                {
+                    const int done = queue.tryPushN(batch.begin() + pushed, size - pushed);
+                    if (done == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    pushed += done;
+                }
+                next += size;
+            }
+        });
+
+    std::vector<int> received;
+    received.reserve(count);
+    std::vector<int> batch(48);
+    while (static_cast<int>(received.size()) < count)
+    {
+        const int popped = queue.tryPopN(batch.begin(), 48);
+        if (popped == 0)
+        {
+            std::this_thread::yield();
+        }
+        received.insert(received.end(), batch.begin(), batch.begin() + popped);
+    }
+    producer.join();
+
+    for (int i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(received[i], i);
+    }
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <dynamic-array.hpp>
 #include <list.hpp>
+#include <small-dynamic-array.hpp>
+#include <memory_resource>
 #include <stack.hpp>
 
 template <typename ContainerType>
@@ -9,7 +11,7 @@ class StackTestsWithArrayAndList : public testing::Test
 };
 
 // Define the container types to be tested for integers
-using ContainerTypes = ::testing::Types<DynamicArray<int>, List<int>>;
+using ContainerTypes = ::testing::Types<DynamicArray<int>, List<int>, SmallDynamicArray<int, 4>>;
 
 TYPED_TEST_SUITE(StackTestsWithArrayAndList, ContainerTypes);
 
@@ -209,3 +211,19 @@ TYPED_TEST(StackTestsWithArrayAndList, TopNonConstAllowsModification)
 
     EXPECT_EQ(stack.top(), 2);
 }
+
+TEST(StackPmrTests, ContainerUsesArena)
+{
+    std::byte buffer[4096];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    Stack<int, PmrList<int>> stack{std::pmr::polymorphic_allocator<int>(&arena)};
+    for (int i = 0; i < 50; ++i)
+    {
+        stack.push(i);
+    }
+
+    EXPECT_EQ(stack.getSize(), 50);
+    EXPECT_EQ(stack.top(), 49);
+}
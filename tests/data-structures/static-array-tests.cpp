@@ -1,5 +1,8 @@
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <limits>
 #include <static-array.hpp>
+#include <string>
 
 // Test for getSize
 TEST(StaticArrayTest, GetSize)
@@ -125,3 +128,152 @@ TEST(StaticArrayTest, DefaultInitialization)
         EXPECT_EQ(arr[i], 0);
     }
 }
+
+// Test that the access policy can be chosen explicitly, whatever the default of the build is
+TEST(StaticArrayTest, AccessPolicies)
+{
+    StaticArray<int, 3, CheckedAccess> checked = {1, 2, 3};
+    EXPECT_THROW(checked[3], std::out_of_range);
+
+    StaticArray<int, 3, UncheckedAccess> unchecked = {1, 2, 3};
+    unchecked.data()[0] = 10;
+    EXPECT_EQ(unchecked[0], 10);
+    EXPECT_EQ(unchecked.data(), unchecked.begin());
+}
+
+// Test that the elements past an initializer list are value-initialized
+TEST(StaticArrayTest, InitializerListValueInitializesTheRest)
+{
+    StaticArray<int, 5> arr = {1, 2};
+    EXPECT_EQ(arr[1], 2);
+    EXPECT_EQ(arr[2], 0);
+    EXPECT_EQ(arr[4], 0);
+
+    StaticArray<std::string, 3> strings = {"a"};
+    EXPECT_TRUE(strings[2].empty());
+}
+
+// Test that an array can be built and queried at compile time
+TEST(StaticArrayTest, ConstexprConstruction)
+{
+    constexpr StaticArray<int, 4> values = {4, 1, 3, 2};
+    static_assert(values[2] == 3);
+    static_assert(values.sum() == 10);
+    static_assert(values.min() == 1 && values.max() == 4);
+    static_assert(StaticArray<int, 3>() == StaticArray<int, 3>{0, 0, 0});
+    static_assert(StaticArray<double, 2>(std::in_place, 1.5)[1] == 1.5);
+
+    constexpr auto squares = []
+    {
+        StaticArray<int, 5> array = {1, 2, 3, 4, 5};
+        array.transform([](int value) { return value * value; });
+        return array;
+    }();
+    static_assert(squares.sum() == 55);
+    EXPECT_EQ(squares[4], 25);
+}
+
+// Test the alignment control of the storage
+TEST(StaticArrayTest, Alignment)
+{
+    static_assert(alignof(StaticArray<float, 10, DefaultAccess, SIMD_ALIGNMENT>) == SIMD_ALIGNMENT);
+    static_assert(StaticArray<int, 3>::ALIGNMENT == alignof(int));
+
+    StaticArray<char, 1> padding;
+    StaticArray<float, 10, DefaultAccess, SIMD_ALIGNMENT> aligned;
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned.data()) % SIMD_ALIGNMENT, 0U);
+    EXPECT_EQ(padding[0], 0);
+}
+
+// Templated test fixture for the bulk kernels, with and without vector kernels for the element type
+template <typename T>
+class StaticArrayKernelsTest : public testing::Test
+{
+public:
+    // Long enough for the unrolled loops, with a remainder that does not fill a register
+    static constexpr int SIZE = 75;
+    StaticArray<T, SIZE, DefaultAccess, SIMD_ALIGNMENT> mArray;
+};
+
+using KernelTypes = ::testing::Types<int, unsigned int, long long, float, double, short>;
+TYPED_TEST_SUITE(StaticArrayKernelsTest, KernelTypes);
+
+// Test fill and operator==, with a difference in the vector part and in the remainder
+TYPED_TEST(StaticArrayKernelsTest, FillAndCompare)
+{
+    auto& array = this->mArray;
+    array.fill(TypeParam(7));
+    for (const TypeParam& value : array)
+    {
+        EXPECT_EQ(value, TypeParam(7));
+    }
+
+    auto copy = array;
+    EXPECT_TRUE(copy == array);
+    copy[3] = TypeParam(8);
+    EXPECT_FALSE(copy == array);
+    copy[3] = TypeParam(7);
+    copy[array.getSize() - 1] = TypeParam(8);
+    EXPECT_FALSE(copy == array);
+}
+
+// Test sum, min and max, with the extremes in the vector part and in the remainder
+TYPED_TEST(StaticArrayKernelsTest, SumMinMax)
+{
+    auto& array = this->mArray;
+    long long expected = 0;
+    for (int i = 0; i < array.getSize(); ++i)
+    {
+        array[i] = TypeParam(10 + i % 13);
+        expected += 10 + i % 13;
+    }
+    EXPECT_EQ(array.sum(), TypeParam(expected));
+    EXPECT_EQ(array.min(), TypeParam(10));
+    EXPECT_EQ(array.max(), TypeParam(22));
+
+    array[37] = TypeParam(3);
+    array[array.getSize() - 1] = TypeParam(99);
+    EXPECT_EQ(array.min(), TypeParam(3));
+    EXPECT_EQ(array.max(), TypeParam(99));
+
+    array[array.getSize() - 2] = TypeParam(1);
+    array[5] = TypeParam(100);
+    EXPECT_EQ(array.min(), TypeParam(1));
+    EXPECT_EQ(array.max(), TypeParam(100));
+}
+
+// Test the unary and binary element-wise transform
+TYPED_TEST(StaticArrayKernelsTest, Transform)
+{
+    auto& array = this->mArray;
+    for (int i = 0; i < array.getSize(); ++i)
+    {
+        array[i] = TypeParam(i);
+    }
+    auto offsets = array;
+
+    array.transform([](TypeParam value) { return TypeParam(value * 2); });
+    array.transform(offsets, [](TypeParam value, TypeParam offset) { return TypeParam(value + offset); });
+    for (int i = 0; i < array.getSize(); ++i)
+    {
+        EXPECT_EQ(array[i], TypeParam(3 * i));
+    }
+}
+
+// Test the floating point semantics of operator== and the kernels on a zero sized array
+TEST(StaticArrayTest, KernelEdgeCases)
+{
+    StaticArray<double, 8> zeros;
+    StaticArray<double, 8> negativeZeros;
+    negativeZeros.fill(-0.0);
+    EXPECT_TRUE(zeros == negativeZeros);
+
+    StaticArray<float, 8> nans;
+    nans.fill(std::numeric_limits<float>::quiet_NaN());
+    EXPECT_FALSE(nans == nans);
+
+    StaticArray<int, 0> empty;
+    empty.fill(1);
+    EXPECT_EQ(empty.sum(), 0);
+    EXPECT_TRUE(empty == (StaticArray<int, 0>()));
+}
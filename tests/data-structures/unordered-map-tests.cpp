@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <unordered-map.hpp>
+#include <memory_resource>
+#include <vector>
 
 TEST(UnorderedMapTest, InsertAndFind)
 {
@@ -41,3 +43,126 @@ TEST(UnorderedMapTest, LoadFactor)
     map.insert(2, 20);
     EXPECT_FLOAT_EQ(map.loadFactor(), 0.5f);
 }
+
+TEST(UnorderedMapTest, PmrBucketsShareArena)
+{
+    std::byte buffer[8192];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    using Allocator = std::pmr::polymorphic_allocator<std::pair<uint8_t, int>>;
+    UnorderedMap<int, 16, Allocator> map{Allocator(&arena)};
+    for (int key = 0; key < 100; ++key)
+    {
+        map.insert(key, key * 10);
+    }
+    map.erase(50);
+
+    EXPECT_EQ(map.find(99).value(), 990);
+    EXPECT_FALSE(map.find(50).has_value());
+}
+
+TEST(UnorderedMapTest, InsertEraseDoesNotAllocateInSteadyState)
+{
+    std::byte buffer[8192];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    using Allocator = std::pmr::polymorphic_allocator<std::pair<uint8_t, int>>;
+    UnorderedMap<int, 16, Allocator> map{Allocator(&arena)};
+    for (int round = 0; round < 10'000; ++round)
+    {
+        for (int key = 0; key < 64; ++key)
+        {
+            map.insert(key, round);
+        }
+        for (int key = 0; key < 64; ++key)
+        {
+            map.erase(key);
+        }
+    }
+    map.insert(7, 70);
+
+    EXPECT_EQ(map.find(7).value(), 70);
+    EXPECT_FALSE(map.find(8).has_value());
+}
+
+struct Order : IntrusiveListHook<>
+{
+    Order(uint8_t _id, int _quantity) : id(_id), quantity(_quantity)
+    {
+    }
+
+    uint8_t id;
+    int quantity;
+};
+
+TEST(IntrusiveUnorderedMapTest, InsertAndFindTheObjects)
+{
+    Order first(42, 1), second(100, 2);
+    IntrusiveUnorderedMap<Order, &Order::id> map;
+    EXPECT_EQ(map.insert(first), nullptr);
+    EXPECT_EQ(map.insert(second), nullptr);
+
+    EXPECT_EQ(map.find(42), &first);
+    EXPECT_EQ(map.find(100), &second);
+    EXPECT_EQ(map.find(200), nullptr);
+    EXPECT_EQ(map.getSize(), 2u);
+}
+
+TEST(IntrusiveUnorderedMapTest, DuplicateInsertReplacesObject)
+{
+    Order first(10, 1), second(10, 999);
+    IntrusiveUnorderedMap<Order, &Order::id> map;
+    map.insert(first);
+
+    EXPECT_EQ(map.insert(second), &first);
+    EXPECT_EQ(map.find(10), &second);
+    EXPECT_FALSE(first.isLinked());
+    EXPECT_EQ(map.getSize(), 1u);
+    EXPECT_THROW(map.insert(second), std::invalid_argument);
+}
+
+TEST(IntrusiveUnorderedMapTest, EraseByKeyAndByObject)
+{
+    Order a(5, 50), b(21, 60), c(6, 70);  // 5 and 21 share a bucket
+    IntrusiveUnorderedMap<Order, &Order::id> map;
+    map.insert(a);
+    map.insert(b);
+    map.insert(c);
+
+    EXPECT_EQ(map.erase(5), &a);
+    EXPECT_EQ(map.erase(5), nullptr);
+    map.erase(c);
+
+    EXPECT_EQ(map.find(5), nullptr);
+    EXPECT_EQ(map.find(6), nullptr);
+    EXPECT_EQ(map.find(21), &b);
+    EXPECT_EQ(map.getSize(), 1u);
+    EXPECT_THROW(map.erase(c), std::invalid_argument);
+}
+
+TEST(IntrusiveUnorderedMapTest, ObjectsMoveBetweenListAndMap)
+{
+    std::vector<Order> orders;
+    for (int i = 0; i < 64; ++i)
+    {
+        orders.emplace_back(static_cast<uint8_t>(i), i);
+    }
+    IntrusiveList<Order> pending;
+    IntrusiveUnorderedMap<Order, &Order::id, 4> map;
+    for (Order& order : orders)
+    {
+        pending.append(order);
+    }
+
+    while (!pending.isEmpty())
+    {
+        Order& order = *pending.begin();
+        pending.erase(pending.begin());
+        map.insert(order);
+    }
+
+    EXPECT_FLOAT_EQ(map.loadFactor(), 16.0f);
+    EXPECT_EQ(map.find(33)->quantity, 33);
+}
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <delete-duplicates.hpp>
+#include <insert-sort.hpp>
+#include <list.hpp>
+#include <memory_resource>
+#include <queue.hpp>
+#include <string>
+#include <unrolled-list.hpp>
+
+// Small nodes, so a few elements already span several nodes
+using SmallUnrolledList = UnrolledList<int, 4>;
+
+template <typename ListType>
+void expectElements(const ListType& list, std::initializer_list<typename ListType::value_type> expected)
+{
+    ASSERT_EQ(list.getSize(), static_cast<int>(expected.size()));
+    int index = 0;
+    for (const auto& item : expected)
+    {
+        EXPECT_EQ(list[index], item) << "at index " << index;
+        index++;
+    }
+}
+
+TEST(UnrolledListTest, DefaultConstructor)
+{
+    SmallUnrolledList list;
+    EXPECT_EQ(list.getSize(), 0);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.getNodeCount(), 0);
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(UnrolledListTest, AppendFillsNodes)
+{
+    SmallUnrolledList list;
+    for (int i = 0; i < 10; ++i)
+    {
+        list.append(i);
+    }
+
+    EXPECT_EQ(list.getSize(), 10);
+    EXPECT_EQ(list.getNodeCount(), 3);
+    expectElements(list, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+TEST(UnrolledListTest, Iterators)
+{
+    SmallUnrolledList list = {1, 2, 3, 4, 5, 6, 7};
+
+    int expected = 1;
+    for (int value : list)
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 8);
+
+    auto it = list.end();
+    for (int value = 7; value >= 1; --value)
+    {
+        --it;
+        EXPECT_EQ(*it, value);
+    }
+    EXPECT_EQ(it, list.begin());
+}
+
+TEST(UnrolledListTest, IteratorArithmetic)
+{
+    SmallUnrolledList list = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    EXPECT_EQ(*(list.begin() + 5), 5);
+    EXPECT_EQ(list.begin() + 10, list.end());
+    EXPECT_EQ(*(list.end() - 1), 9);
+    EXPECT_EQ(*(list.end() - 10), 0);
+    EXPECT_EQ(list.end() - list.begin(), 10);
+    EXPECT_EQ(list.begin() - list.end(), -10);
+    EXPECT_EQ((list.begin() + 7) - (list.begin() + 2), 5);
+    EXPECT_TRUE(list.begin() + 3 < list.begin() + 6);
+    EXPECT_FALSE(list.end() < list.begin());
+}
+
+TEST(UnrolledListTest, ConstIterator)
+{
+    const SmallUnrolledList list = {1, 2, 3};
+    SmallUnrolledList::const_iterator it = list.begin();
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(list.end() - it, 3);
+}
+
+TEST(UnrolledListTest, InsertSplitsFullNode)
+{
+    SmallUnrolledList list = {0, 1, 2, 3};
+    EXPECT_EQ(list.getNodeCount(), 1);
+
+    auto it = list.insert(10, 1);
+    EXPECT_EQ(*it, 10);
+    EXPECT_EQ(list.getNodeCount(), 2);
+    expectElements(list, {0, 10, 1, 2, 3});
+
+    list.insert(20, 4);
+    list.insert(30, 0);
+    list.insert(40, list.getSize());
+    expectElements(list, {30, 0, 10, 1, 2, 20, 3, 40});
+}
+
+TEST(UnrolledListTest, InsertOwnElement)
+{
+    UnrolledList<std::string, 4> list = {"a", "b", "c"};
+    list.insert(list[2], 0);
+    expectElements(list, {"c", "a", "b", "c"});
+}
+
+TEST(UnrolledListTest, InsertInvalidIndex)
+{
+    SmallUnrolledList list = {1, 2, 3};
+    EXPECT_THROW(list.insert(25, -1), std::out_of_range);
+    EXPECT_THROW(list.insert(25, 4), std::out_of_range);
+}
+
+TEST(UnrolledListTest, EraseReturnsNextElement)
+{
+    SmallUnrolledList list = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto it = list.erase(3);  // Last element of the first node
+    EXPECT_EQ(*it, 4);
+    it = list.erase(list.getSize() - 1);
+    EXPECT_EQ(it, list.end());
+    it = list.erase(0);
+    EXPECT_EQ(*it, 1);
+
+    expectElements(list, {1, 2, 4, 5, 6, 7, 8});
+    EXPECT_THROW(list.erase(7), std::out_of_range);
+}
+
+TEST(UnrolledListTest, EraseReleasesAndMergesNodes)
+{
+    UnrolledList<int, 8> list;
+    for (int i = 0; i < 32; ++i)
+    {
+        list.append(i);
+    }
+    EXPECT_EQ(list.getNodeCount(), 4);
+
+    // Empty the second node: it is released once its last element is gone
+    for (int i = 0; i < 8; ++i)
+    {
+        list.erase(8);
+    }
+    EXPECT_EQ(list.getNodeCount(), 3);
+
+    // Leave one element in the first node, it absorbs a half emptied successor
+    for (int i = 0; i < 4; ++i)
+    {
+        list.erase(8);
+    }
+    for (int i = 0; i < 7; ++i)
+    {
+        list.erase(0);
+    }
+    EXPECT_EQ(list.getNodeCount(), 2);
+    expectElements(list, {7, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31});
+
+    while (!list.isEmpty())
+    {
+        list.erase(0);
+    }
+    EXPECT_EQ(list.getNodeCount(), 0);
+    EXPECT_THROW(list.erase(0), std::out_of_range);
+}
+
+// Test against List with a random mix of operations, strings check that elements are constructed and destroyed
+TEST(UnrolledListTest, MatchesListUnderRandomOperations)
+{
+    UnrolledList<std::string, 6> unrolled;
+    List<std::string> reference;
+    unsigned state = 12345;
+    auto next = [&state]() { return state = state * 1103515245 + 12345, (state >> 8) & 0xFFFF; };
+
+    for (int step = 0; step < 5000; ++step)
+    {
+        const unsigned operation = next() % 4;
+        const int size = reference.getSize();
+        if (operation == 0 || size == 0)
+        {
+            unrolled.append(std::to_string(step));
+            reference.append(std::to_string(step));
+        }
+        else if (operation == 1)
+        {
+            const int pos = static_cast<int>(next() % (size + 1));
+            unrolled.insert(std::to_string(step), pos);
+            reference.insert(std::to_string(step), pos);
+        }
+        else
+        {
+            const int pos = static_cast<int>(next() % size);
+            unrolled.erase(pos);
+            reference.erase(pos);
+        }
+    }
+
+    ASSERT_EQ(unrolled.getSize(), reference.getSize());
+    int index = 0;
+    for (const auto& item : unrolled)
+    {
+        EXPECT_EQ(item, reference[index++]);
+    }
+}
+
+// Test the smallest nodes, where every split leaves a single element on each side
+TEST(UnrolledListTest, TwoElementNodes)
+{
+    UnrolledList<std::string, 2> unrolled;
+    unrolled.append("a");
+    unrolled.insert("b", 0);
+    unrolled.insert("c", 1);
+    unrolled.insert("d", 0);
+    unrolled.insert("e", 4);
+    expectElements(unrolled, {"d", "b", "c", "a", "e"});
+
+    unrolled.erase(1);
+    unrolled.erase(0);
+    expectElements(unrolled, {"c", "a", "e"});
+}
+
+TEST(UnrolledListTest, CopyAndMove)
+{
+    UnrolledList<std::string, 4> list = {"a", "b", "c", "d", "e"};
+
+    UnrolledList<std::string, 4> copy(list);
+    EXPECT_EQ(copy, list);
+
+    UnrolledList<std::string, 4> assigned = {"x"};
+    assigned = list;
+    EXPECT_EQ(assigned, list);
+
+    UnrolledList<std::string, 4> moved(std::move(copy));
+    EXPECT_EQ(moved, list);
+    EXPECT_TRUE(copy.isEmpty());
+
+    UnrolledList<std::string, 4> moveAssigned = {"y", "z"};
+    moveAssigned = std::move(moved);
+    EXPECT_EQ(moveAssigned, list);
+    EXPECT_TRUE(moved.isEmpty());
+
+    moved.append("reused");  // The moved-from list got the nodes of the target
+    EXPECT_EQ(moved[0], "reused");
+}
+
+TEST(UnrolledListTest, ClearKeepsNodesForReuse)
+{
+    std::byte buffer[4096];
+    // The null upstream makes any allocation outside the buffer throw std::bad_alloc
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    UnrolledList<int, 16, std::pmr::polymorphic_allocator<int>> list(&arena);
+    for (int round = 0; round < 1000; ++round)
+    {
+        for (int i = 0; i < 40; ++i)
+        {
+            list.append(i);
+        }
+        list.clear();
+    }
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.getAllocator().resource(), &arena);
+}
+
+TEST(UnrolledListTest, AccessPolicies)
+{
+    UnrolledList<int, 4, std::allocator<int>, CheckedAccess> checked = {1, 2, 3};
+    EXPECT_THROW(checked[3], std::out_of_range);
+    EXPECT_THROW(checked[-1], std::out_of_range);
+
+    UnrolledList<int, 4, std::allocator<int>, UncheckedAccess> unchecked = {1, 2, 3};
+    EXPECT_EQ(unchecked[2], 3);
+}
+
+TEST(UnrolledListTest, WorksWithQueueAndAlgorithms)
+{
+    Queue<int, UnrolledList<int, 4>> queue;
+    for (int i = 0; i < 10; ++i)
+    {
+        queue.push(i);
+    }
+    queue.pop();
+    EXPECT_EQ(queue.front(), 1);
+    EXPECT_EQ(queue.back(), 9);
+    EXPECT_EQ(queue.getSize(), 9);
+
+    SmallUnrolledList list = {5, 3, 5, 1, 3, 4, 2, 1};
+    deleteDuplicates(list);
+    insertSort(list.begin(), list.end());
+    expectElements(list, {1, 2, 3, 4, 5});
+}
+
+// Test that stepping back from the first element gives an iterator before every other one, as for List
+TEST(UnrolledListTest, IteratorBeforeBegin)
+{
+    SmallUnrolledList list = {1, 2, 3, 4, 5};
+
+    auto beforeBegin = list.begin();
+    --beforeBegin;
+    EXPECT_TRUE(beforeBegin < list.begin());
+    EXPECT_FALSE(beforeBegin >= list.begin());
+    EXPECT_FALSE(list.begin() < beforeBegin);
+
+    EXPECT_EQ(list.end() - 6, beforeBegin);
+    EXPECT_EQ(list.end() - 9, beforeBegin);
+}
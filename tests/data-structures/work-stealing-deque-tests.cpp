@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <work-stealing-deque.hpp>
+
+// Test the state of a new deque and the rounding of its capacity
+TEST(WorkStealingDequeTest, InitialState)
+{
+    WorkStealingDeque<int> deque(3);
+    EXPECT_TRUE(deque.isEmpty());
+    EXPECT_EQ(deque.getSize(), 0);
+    EXPECT_EQ(deque.getCapacity(), 4);
+    int value = 0;
+    EXPECT_FALSE(deque.pop(value));
+    EXPECT_FALSE(deque.steal(value));
+    EXPECT_THROW(WorkStealingDeque<int>(0), std::invalid_argument);
+}
+
+// Test that the owner pops newest first and thieves steal oldest first
+TEST(WorkStealingDequeTest, PopIsLifoStealIsFifo)
+{
+    WorkStealingDeque<int> deque(4);
+    for (int i = 0; i < 6; ++i)
+    {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.getSize(), 6);
+
+    int value = -1;
+    ASSERT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, 5);
+    ASSERT_TRUE(deque.steal(value));
+    EXPECT_EQ(value, 0);
+    ASSERT_TRUE(deque.steal(value));
+    EXPECT_EQ(value, 1);
+    ASSERT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, 4);
+    ASSERT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, 3);
+    ASSERT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(deque.pop(value));
+    EXPECT_FALSE(deque.steal(value));
+}
+
+// Test that the array grows past its capacity and wraps around when it does not need to
+TEST(WorkStealingDequeTest, GrowsAndWrapsAround)
+{
+    WorkStealingDeque<int> deque(4);
+    int value = 0;
+    for (int round = 0; round < 100; ++round)  // Never more than 3 elements: the array wraps, it does not grow
+    {
+        deque.push(round);
+        deque.push(round + 1);
+        deque.push(round + 2);
+        ASSERT_TRUE(deque.steal(value));
+        EXPECT_EQ(value, round);
+        ASSERT_TRUE(deque.pop(value));
+        ASSERT_TRUE(deque.pop(value));
+    }
+    EXPECT_EQ(deque.getCapacity(), 4);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.getCapacity(), 1024);
+    for (int i = 0; i < 500; ++i)
+    {
+        ASSERT_TRUE(deque.steal(value));
+        EXPECT_EQ(value, i);
+    }
+    for (int i = 999; i >= 500; --i)
+    {
+        ASSERT_TRUE(deque.pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+// Stress test: the owner pushes and pops while thieves steal; every element is taken exactly once, including the last
+// elements the owner and the thieves race for
+TEST(WorkStealingDequeTest, OwnerAndThievesTakeEachElementOnce)
+{
+    constexpr int thiefCount = 4;
+    constexpr int count = 200'000;
+    WorkStealingDeque<int> deque(8);
+    std::vector<std::atomic<int>> taken(count);
+    std::atomic<bool> done = false;
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < thiefCount; ++t)
+    {
+        thieves.emplace_back(
+            [&]
+            {
+                int value = 0;
+                while (!done.load())
+                {
+                    if (deque.steal(value))
+                    {
+                        taken[value].fetch_add(1);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    int value = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        deque.push(i);
+        if (i % 3 == 0 && deque.pop(value))
+        {
+            taken[value].fetch_add(1);
+        }
+    }
+    while (deque.pop(value))
+    {
+        taken[value].fetch_add(1);
+    }
+    done = true;
+    for (std::thread& thief : thieves)
+    {
+        thief.join();
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(taken[i].load(), 1) << "element " << i;
+    }
+}